@@ -0,0 +1,248 @@
+/**
+ * \file genererCatalogue.cpp
+ * \brief Outil en ligne de commande qui génère des catalogues synthétiques.
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ *
+ * Ce programme écrit, dans un fichier ou sur la sortie standard, un catalogue au format
+ * lu par chargerCatalogueDepuisFichier() : nom, date, puis une ligne par produit avec un
+ * code produit valide. Le catalogue est produit ligne par ligne, sans être conservé en
+ * mémoire : sa taille n'est limitée que par l'espace disque.
+ *
+ * Usage :
+ *   genererCatalogue [options] [fichier]
+ *
+ *   --produits N          nombre de lignes de produits (1000 par défaut)
+ *   --graine S            graine du générateur pseudo-aléatoire (42 par défaut)
+ *   --electronique P      part des produits électroniques, de 0 à 1 (0.5 par défaut)
+ *   --doublons T          part des lignes qui répètent un produit déjà écrit (0 par défaut)
+ *   --longueur MIN:MAX    bornes de la longueur des descriptions (10:30 par défaut)
+ *   --distribution LOI    fixe, uniforme ou normale (uniforme par défaut)
+ *   --nom NOM             nom du catalogue
+ *   --date JJ/MM/AAAA     date de dernière mise à jour
+ *
+ * Sans fichier, ou avec « - », le catalogue est écrit sur la sortie standard.
+ */
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Date.h"
+#include "GenerateurCatalogue.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+namespace
+{
+
+const size_t TAILLE_TAMPON_SORTIE = 1 << 20;
+
+/**
+ * \brief Affiche la syntaxe de la commande.
+ */
+void afficherUsage(ostream& p_os)
+{
+  p_os << "Usage : genererCatalogue [options] [fichier]" << endl
+       << "  --produits N          nombre de lignes de produits" << endl
+       << "  --graine S            graine du generateur pseudo-aleatoire" << endl
+       << "  --electronique P      part des produits electroniques (0 a 1)" << endl
+       << "  --doublons T          part des lignes qui repetent un produit deja ecrit (0 a 1)" << endl
+       << "  --longueur MIN:MAX    bornes de la longueur des descriptions (MIN >= 4)" << endl
+       << "  --distribution LOI    fixe, uniforme ou normale" << endl
+       << "  --nom NOM             nom du catalogue" << endl
+       << "  --date JJ/MM/AAAA     date de derniere mise a jour" << endl;
+}
+
+/**
+ * \brief Lit un nombre occupant toute la valeur d'une option.
+ * \exception invalid_argument si la valeur n'est pas un nombre
+ */
+template <typename T>
+T lireNombre(string_view p_option, string_view p_valeur)
+{
+  T nombre{};
+  auto [fin, erreur] = from_chars(p_valeur.data(), p_valeur.data() + p_valeur.size(), nombre);
+  if (erreur != errc() || fin != p_valeur.data() + p_valeur.size())
+    {
+      throw invalid_argument("valeur invalide pour " + string(p_option) + " : " + string(p_valeur));
+    }
+  return nombre;
+}
+
+/**
+ * \brief Lit une proportion comprise entre 0 et 1.
+ * \exception invalid_argument si la valeur n'est pas un nombre de [0, 1]
+ */
+double lireProportion(string_view p_option, string_view p_valeur)
+{
+  double proportion = lireNombre<double>(p_option, p_valeur);
+  if (proportion < 0 || proportion > 1)
+    {
+      throw invalid_argument(string(p_option) + " doit etre compris entre 0 et 1");
+    }
+  return proportion;
+}
+
+/**
+ * \brief Interprète les arguments de la commande.
+ * \param[out] p_parametres paramètres du catalogue à générer
+ * \param[out] p_nomFichier fichier de sortie (« - » pour la sortie standard)
+ * \exception invalid_argument si un argument est inconnu ou invalide
+ */
+void lireArguments(const vector<string_view>& p_arguments, ParametresGeneration& p_parametres, string& p_nomFichier)
+{
+  p_nomFichier = "-";
+  for (size_t i = 0; i < p_arguments.size(); ++i)
+    {
+      string_view option = p_arguments[i];
+      if (option.substr(0, 2) != "--")
+        {
+          p_nomFichier = string(option);
+          continue;
+        }
+      if (i + 1 == p_arguments.size())
+        {
+          throw invalid_argument("valeur manquante pour " + string(option));
+        }
+      string_view valeur = p_arguments[++i];
+
+      if (option == "--produits")
+        {
+          p_parametres.nbProduits = lireNombre<size_t>(option, valeur);
+        }
+      else if (option == "--graine")
+        {
+          p_parametres.graine = lireNombre<uint64_t>(option, valeur);
+        }
+      else if (option == "--electronique")
+        {
+          p_parametres.proportionElectronique = lireProportion(option, valeur);
+        }
+      else if (option == "--doublons")
+        {
+          p_parametres.tauxDoublons = lireProportion(option, valeur);
+        }
+      else if (option == "--longueur")
+        {
+          size_t separateur = valeur.find(':');
+          if (separateur == string_view::npos)
+            {
+              throw invalid_argument("--longueur attend MIN:MAX");
+            }
+          p_parametres.longueurDescriptionMin = lireNombre<size_t>(option, valeur.substr(0, separateur));
+          p_parametres.longueurDescriptionMax = lireNombre<size_t>(option, valeur.substr(separateur + 1));
+          if (p_parametres.longueurDescriptionMin < 4 ||
+              p_parametres.longueurDescriptionMin > p_parametres.longueurDescriptionMax)
+            {
+              throw invalid_argument("--longueur attend 4 <= MIN <= MAX");
+            }
+        }
+      else if (option == "--distribution")
+        {
+          if (valeur == "fixe")
+            {
+              p_parametres.distributionLongueur = DistributionLongueur::FIXE;
+            }
+          else if (valeur == "uniforme")
+            {
+              p_parametres.distributionLongueur = DistributionLongueur::UNIFORME;
+            }
+          else if (valeur == "normale")
+            {
+              p_parametres.distributionLongueur = DistributionLongueur::NORMALE;
+            }
+          else
+            {
+              throw invalid_argument("loi inconnue pour --distribution : " + string(valeur));
+            }
+        }
+      else if (option == "--nom")
+        {
+          if (valeur.empty())
+            {
+              throw invalid_argument("le nom du catalogue ne doit pas etre vide");
+            }
+          p_parametres.nomCatalogue = string(valeur);
+        }
+      else if (option == "--date")
+        {
+          size_t premier = valeur.find('/');
+          size_t second = valeur.find('/', premier == string_view::npos ? premier : premier + 1);
+          if (premier == string_view::npos || second == string_view::npos)
+            {
+              throw invalid_argument("--date attend JJ/MM/AAAA");
+            }
+          int jour = lireNombre<int>(option, valeur.substr(0, premier));
+          int mois = lireNombre<int>(option, valeur.substr(premier + 1, second - premier - 1));
+          int annee = lireNombre<int>(option, valeur.substr(second + 1));
+          if (!Date::validerDate(jour, mois, annee))
+            {
+              throw invalid_argument("date invalide : " + string(valeur));
+            }
+          p_parametres.date = Date(jour, mois, annee);
+        }
+      else
+        {
+          throw invalid_argument("option inconnue : " + string(option));
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  ParametresGeneration parametres;
+  string nomFichier;
+  try
+    {
+      lireArguments(vector<string_view>(argv + 1, argv + argc), parametres, nomFichier);
+    }
+  catch (const invalid_argument& e)
+    {
+      cerr << e.what() << endl;
+      afficherUsage(cerr);
+      return 1;
+    }
+
+  if (parametres.nbProduits > reqNombreMaximalProduitsDistincts())
+    {
+      cerr << "Attention : au-dela de " << reqNombreMaximalProduitsDistincts()
+           << " produits, les codes se repetent et le catalogue ne peut plus etre charge." << endl;
+    }
+
+  vector<char> tampon(TAILLE_TAMPON_SORTIE);
+  ofstream fichier;
+  ostream* sortie = &cout;
+  if (nomFichier != "-")
+    {
+      fichier.rdbuf()->pubsetbuf(tampon.data(), static_cast<streamsize>(tampon.size()));
+      fichier.open(nomFichier, ios::binary | ios::trunc);
+      if (!fichier)
+        {
+          cerr << "Impossible d'ouvrir le fichier " << nomFichier << endl;
+          return 1;
+        }
+      sortie = &fichier;
+    }
+  else
+    {
+      ios::sync_with_stdio(false);
+    }
+
+  genererCatalogue(parametres, *sortie);
+  sortie->flush();
+  if (!*sortie)
+    {
+      cerr << "Erreur d'ecriture du catalogue" << endl;
+      return 1;
+    }
+  return 0;
+}
@@ -2,7 +2,7 @@
  * \file AccueilForm.cpp
  * \author Omar Mahamat
  * \date 8 décembre 2025
- * \brief Implémentation de la classe AccueilForm et de la fonction de chargement de catalogue.
+ * \brief Implémentation de la classe AccueilForm.
  */
 
 
@@ -10,8 +10,11 @@
 #include "ElectroniqueForm.h"
 #include "VetementForm.h"
 #include "SupprimerProduitForm.h"
+#include "ChargementCatalogue.h"
 #include<QMessageBox>
 #include <QInputDialog>  
+#include <QHeaderView>
+#include <QStatusBar>
 
 
 
@@ -19,26 +22,42 @@ using namespace commerce;
 using namespace std;
 using namespace util;
 
-
-Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier);
-
 /**
      * \brief Constructeur par défaut.
      *
      * Initialise la fenêtre principale et le widget généré par Qt Designer.
-     * Le catalogue est initialisé avec un nom et la date d'aujourd'hui.
+     * Le catalogue est initialisé avec un nom et la date d'aujourd'hui, puis
+     * présenté dans la table par le modèle. Les lignes ont une hauteur fixe :
+     * la vue n'a donc pas à mesurer chaque ligne pour se dessiner. La recherche
+     * est relancée à chaque modification du texte saisi.
      */
-AccueilForm::AccueilForm(): m_catalogue("Automne 2025", util::Date())
+AccueilForm::AccueilForm(): m_catalogue("Automne 2025", util::Date()), m_modele(m_catalogue), m_progression(nullptr)
 {
 
     widget.setupUi(this);
+    widget.tableViewCatalogue->setModel(&m_modele);
+    widget.tableViewCatalogue->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    widget.tableViewCatalogue->horizontalHeader()->setStretchLastSection(true);
+
+    m_minuterieProgression.setInterval(100);
+    connect(&m_minuterieProgression, &QTimer::timeout, this, &AccueilForm::slotProgressionChargement);
+    connect(widget.lineEditRecherche, &QLineEdit::textChanged, this, &AccueilForm::slotRechercher);
+    connect(widget.listWidgetResultats, &QListWidget::itemClicked, this, &AccueilForm::slotAfficherResultat);
 
     
 }
  /**
    * \brief Destructeur virtuel.
+   *
+   * Un chargement encore en cours est annulé, puis attendu avant la destruction
+   * du catalogue et du suivi qu'il utilise.
    */
 AccueilForm::~AccueilForm() {
+    if (m_filChargement.joinable())
+    {
+        m_suiviChargement.annulationDemandee = true;
+        m_filChargement.join();
+    }
 }
  /**
      * \brief Slot déclenché pour l'ajout d'un produit de type Electronique.
@@ -59,9 +78,10 @@ void AccueilForm::slotElectronique()
       Electronique electro(electroniqueForm.reqDescription(), electroniqueForm.reqPrix(),electroniqueForm.reqCode(),electroniqueForm.reqGarantie(), electroniqueForm.reqRecontionne());
       try
         {
-        m_catalogue.ajouterProduit(electro);
+        m_modele.ajouterProduit(electro);
         
         m_catalogue.asgDerniereMiseAJour(util::Date());
+        slotRechercher();
         }
       catch(ProduitDejaPresentException &e)
         {
@@ -70,8 +90,6 @@ void AccueilForm::slotElectronique()
             QMessageBox::information(this, "ERREUR", message); 
         }
       
-      widget.textBrowserCatalogue->setPlainText(m_catalogue.reqCatalogueFormate().c_str());
-      
   }
 }
    /**
@@ -90,15 +108,14 @@ void AccueilForm::slotVetement()
         Vetement v(vetementForm.reqDescription(),vetementForm.reqPrix(),vetementForm.reqCode(),vetementForm.reqTaille(),vetementForm.reqCouleur());
 
         try {
-            m_catalogue.ajouterProduit(v);
+            m_modele.ajouterProduit(v);
             m_catalogue.asgDerniereMiseAJour(util::Date());
+            slotRechercher();
         }
         catch (ProduitDejaPresentException& e) {
             QString message = e.what();
             QMessageBox::information(this, "ERREUR", message);
         }
-
-        widget.textBrowserCatalogue->setPlainText(m_catalogue.reqCatalogueFormate().c_str());
     }
 }
    /**
@@ -119,11 +136,9 @@ void AccueilForm::slotSupprimerProduit()
         string code = supprimeform.reqCode();
 
         try {
-            m_catalogue.supprimerProduit(code);
+            m_modele.supprimerProduit(code);
             m_catalogue.asgDerniereMiseAJour(util::Date());
-            widget.textBrowserCatalogue->setPlainText(
-                m_catalogue.reqCatalogueFormate().c_str()
-            );
+            slotRechercher();
         }
         catch (ProduitAbsentException& e) {
             QString message = e.what();
@@ -134,113 +149,150 @@ void AccueilForm::slotSupprimerProduit()
    /**
      * \brief Slot permettant de charger un catalogue à partir d'un fichier.
      *
-     * Utilise la fonction libre chargerCatalogueDepuisFichier() pour
-     * remplacer le catalogue courant par celui décrit dans le fichier
-     * texte. L'affichage du catalogue est ensuite mis à jour.
+     * Lance commerce::chargerCatalogueDepuisFichier() sur un fil secondaire et
+     * affiche une boîte de progression modale, mise à jour toutes les 100 ms à
+     * partir des octets analysés. L'usager peut annuler le chargement. L'action
+     * de chargement est désactivée tant qu'un chargement est en cours. L'index des
+     * mots est construit sur le même fil : la première recherche n'attend pas.
      */
 void AccueilForm::slotChargerCatalogue()
 {
-    
-    m_catalogue = chargerCatalogueDepuisFichier("catalogue_produits_valide.txt");
-
-   
-    widget.textBrowserCatalogue->setPlainText(
-        m_catalogue.reqCatalogueFormate().c_str()
-    );
-}
-    
-/**
- * \brief Charge un catalogue à partir d'un fichier texte.
- *
- * Format attendu du fichier catalogue_produits_valide.txt :
- *  - Ligne 1 : nom du catalogue (ex.: "mon catalogue")
- *  - Ligne 2 : trois entiers "jour mois annee" (ex.: "21 8 2025")
- *  - Puis, une ligne par produit, au format CSV :
- *      Electronique,Description,prix,code,garantie,enRecond
- *      Vetement,Description,prix,code,taille,couleur
- *
- * Exemple :
- *  Electronique,Smartphone Galaxy,499.9,PRD-SMAR-60,24,0
- *  Vetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc
- *
- * \param[in] p_nomFichier nom du fichier catalogue à charger
- * \return Un objet Catalogue initialisé avec les produits lus
- */
-
-Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier)
-{
-  ifstream fichier(p_nomFichier.c_str());
-
-  if (!fichier)
+    if (m_filChargement.joinable())
     {
-      cerr << "Erreur : impossible d'ouvrir le fichier " << p_nomFichier << endl;
-      exit(1);
+        return;
     }
 
-  
-  string nomCatalogue;
-  std::getline(fichier, nomCatalogue);
+    m_suiviChargement.octetsLus = 0;
+    m_suiviChargement.octetsTotal = 0;
+    m_suiviChargement.annulationDemandee = false;
 
-  
-  int jour = 1;
-  int mois = 1;
-  int annee = 2000;
-  fichier >> jour >> mois >> annee;
-  fichier.ignore(numeric_limits<streamsize>::max(), '\n');
+    m_progression = new QProgressDialog("Chargement du catalogue...", "Annuler", 0, 1000, this);
+    m_progression->setWindowModality(Qt::WindowModal);
+    m_progression->setAutoReset(false);
+    m_progression->setAutoClose(false);
+    m_progression->setMinimumDuration(300);
+    connect(m_progression, &QProgressDialog::canceled, this, &AccueilForm::slotAnnulerChargement);
 
-  Date dateCatalogue(jour, mois, annee);
-  Catalogue catalogue(nomCatalogue, dateCatalogue);
+    widget.actionChargerCatalogue->setEnabled(false);
+    m_minuterieProgression.start();
 
-  
-  string ligne;
-  while (std::getline(fichier, ligne))
-    {
-      if (ligne.empty())
-        {
-          continue;
+    m_filChargement = std::thread([this]() {
+        std::shared_ptr<Catalogue> catalogue;
+        QString erreur;
+        bool annule = false;
+        try {
+            catalogue = std::make_shared<Catalogue>(
+                chargerCatalogueDepuisFichier("catalogue_produits_valide.txt", m_suiviChargement));
+            catalogue->construireIndex();
+        }
+        catch (ChargementAnnuleException&) {
+            annule = true;
         }
+        catch (std::exception& e) {
+            erreur = e.what();
+        }
+        QMetaObject::invokeMethod(this, [this, catalogue, erreur, annule]() {
+            terminerChargement(catalogue, erreur, annule);
+        }, Qt::QueuedConnection);
+    });
+}
 
-      stringstream ss(ligne);
-      string type;
-      string description;
-      string prixStr;
-      string code;
-      string champ5;
-      string champ6;
-
-      std::getline(ss, type, ',');
-      std::getline(ss, description, ',');
-      std::getline(ss, prixStr, ',');
-      std::getline(ss, code, ',');
-      
-      
-      replace(prixStr.begin(), prixStr.end(), '.' , ',');
-      double prix = stod(prixStr);
+   /**
+     * \brief Slot qui reporte dans la boîte de progression les octets déjà analysés.
+     */
+void AccueilForm::slotProgressionChargement()
+{
+    size_t total = m_suiviChargement.octetsTotal;
+    if (m_progression != nullptr && total > 0)
+    {
+        m_progression->setValue(static_cast<int>(m_suiviChargement.octetsLus * 1000 / total));
+    }
+}
 
-      if (type == "Electronique")
-        {
-          std::getline(ss, champ5, ','); 
-          std::getline(ss, champ6, ',');  
+   /**
+     * \brief Slot déclenché par le bouton Annuler de la boîte de progression.
+     *
+     * Le fil de chargement s'interrompt à sa prochaine vérification; le catalogue
+     * courant est conservé.
+     */
+void AccueilForm::slotAnnulerChargement()
+{
+    m_suiviChargement.annulationDemandee = true;
+}
 
-          int garantie = stoi(champ5);
-          bool reconditionne = (champ6 == "1");
+   /**
+     * \brief Termine un chargement, sur le fil de l'interface.
+     *
+     * Si le chargement a réussi, le catalogue chargé remplace le catalogue courant
+     * en une seule opération du modèle, sans copie de ses produits. Sinon, le
+     * catalogue courant est conservé et l'erreur est affichée à l'usager.
+     *
+     * \param[in] p_catalogue Catalogue chargé, ou nullptr en cas d'échec ou d'annulation.
+     * \param[in] p_erreur Message d'erreur du chargement, vide s'il n'y en a pas.
+     * \param[in] p_annule true si le chargement a été annulé par l'usager.
+     */
+void AccueilForm::terminerChargement(std::shared_ptr<Catalogue> p_catalogue, const QString& p_erreur, bool p_annule)
+{
+    m_filChargement.join();
+    m_minuterieProgression.stop();
+    m_progression->deleteLater();
+    m_progression = nullptr;
+    widget.actionChargerCatalogue->setEnabled(true);
 
-          Electronique e(description, prix, code, garantie, reconditionne);
-          catalogue.ajouterProduit(e);
-        }
-      else if (type == "Vetement")
-        {
-          std::getline(ss, champ5, ',');  
-          std::getline(ss, champ6, ',');  
+    if (p_catalogue)
+    {
+        m_modele.remplacerCatalogue(std::move(*p_catalogue));
+        slotRechercher();
+    }
+    else if (p_annule)
+    {
+        statusBar()->showMessage("Chargement annulé", 3000);
+    }
+    else
+    {
+        QMessageBox::information(this, "ERREUR", p_erreur);
+    }
+}
 
-          Vetement v(description, prix, code, champ5, champ6);
-          catalogue.ajouterProduit(v);
-        }
-      else
-        {
-    
-        }
+   /**
+     * \brief Slot qui affiche les produits les plus proches du texte de la zone de recherche.
+     *
+     * Appelé à chaque frappe, et après chaque modification du catalogue. Chaque
+     * résultat garde le code de son produit : les pointeurs retournés par
+     * Catalogue::rechercherApprox() ne survivent pas à une modification.
+     */
+void AccueilForm::slotRechercher()
+{
+    widget.listWidgetResultats->clear();
+    string texte = widget.lineEditRecherche->text().toStdString();
+    for (const Produit* produit : m_catalogue.rechercherApprox(texte, NB_RESULTATS_RECHERCHE))
+    {
+        QString code = QString::fromStdString(produit->reqCode());
+        QListWidgetItem* resultat = new QListWidgetItem(
+            QString::fromStdString(produit->reqDescription()) + " - " + code + " - "
+            + QString::number(produit->reqPrix(), 'f', 2), widget.listWidgetResultats);
+        resultat->setData(Qt::UserRole, code);
     }
+}
 
-  return catalogue;
-}
\ No newline at end of file
+   /**
+     * \brief Slot qui sélectionne dans la table la ligne du produit d'un résultat de recherche.
+     *
+     * Le produit a pu être retiré du catalogue depuis la recherche : le résultat,
+     * périmé, est alors ignoré plutôt que de laisser l'exception sortir du slot.
+     *
+     * \param[in] p_resultat Résultat choisi dans la liste.
+     */
+void AccueilForm::slotAfficherResultat(QListWidgetItem* p_resultat)
+{
+    string code = p_resultat->data(Qt::UserRole).toString().toStdString();
+    int ligne = 0;
+    try {
+        ligne = static_cast<int>(m_catalogue.reqPositionProduit(code));
+    }
+    catch (ProduitAbsentException&) {
+        return;
+    }
+    widget.tableViewCatalogue->selectRow(ligne);
+    widget.tableViewCatalogue->scrollTo(m_modele.index(ligne, 0));
+}
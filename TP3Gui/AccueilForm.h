@@ -16,6 +16,11 @@
 #include <string>
 #include <limits>
 #include <cctype>
+#include <memory>
+#include <thread>
+#include <QProgressDialog>
+#include <QTimer>
+#include <QListWidgetItem>
 
 
 #include "ui_AccueilForm.h"
@@ -24,6 +29,8 @@
 #include "Electronique.h"
 #include "Vetement.h"
 #include "ProduitException.h"
+#include "ModeleCatalogue.h"
+#include "ChargementCatalogue.h"
 
 /**
  * \class AccueilForm
@@ -33,6 +40,18 @@
  * principale. Elle gère un objet commerce::Catalogue et connecte les actions
  * de l'usager (menus, boutons, boîtes de dialogue) aux opérations offertes
  * par la classe Catalogue (ajout, suppression, chargement, affichage).
+ *
+ * Le catalogue est affiché dans une QTableView à travers un ModeleCatalogue :
+ * toutes les modifications du catalogue passent par ce modèle.
+ *
+ * Le chargement d'un catalogue depuis un fichier se fait sur un fil secondaire :
+ * la fenêtre reste réactive, une boîte de progression suit les octets analysés et
+ * permet d'annuler. Le catalogue chargé ne remplace le catalogue courant qu'une fois
+ * complet, sur le fil de l'interface.
+ *
+ * Une zone de recherche, au-dessus de la table, affiche à chaque frappe les
+ * NB_RESULTATS_RECHERCHE produits dont la description ressemble le plus au texte
+ * saisi (Catalogue::rechercherApprox()); choisir un résultat sélectionne sa ligne.
  */
 
 class AccueilForm : public QMainWindow {
@@ -46,11 +65,24 @@ private slots:
     void slotVetement();          
     void slotSupprimerProduit();   
     void slotChargerCatalogue();
+    void slotProgressionChargement();
+    void slotAnnulerChargement();
+    void slotRechercher();
+    void slotAfficherResultat(QListWidgetItem* p_resultat);
     
     
 private:
+    static constexpr std::size_t NB_RESULTATS_RECHERCHE = 10;
+
+    void terminerChargement(std::shared_ptr<commerce::Catalogue> p_catalogue, const QString& p_erreur, bool p_annule);
+
     Ui::AccueilForm widget;
     commerce::Catalogue m_catalogue;
+    ModeleCatalogue m_modele;
+    commerce::SuiviChargement m_suiviChargement;
+    std::thread m_filChargement;
+    QProgressDialog* m_progression;
+    QTimer m_minuterieProgression;
 };
 
 #endif /* _ACCUEILFORM_H */
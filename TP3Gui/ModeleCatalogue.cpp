@@ -0,0 +1,209 @@
+/**
+ * \file ModeleCatalogue.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe ModeleCatalogue.
+ */
+
+#include "ModeleCatalogue.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "ProduitException.h"
+
+using namespace commerce;
+using namespace std;
+
+/**
+ * \brief Constructeur.
+ *
+ * Le catalogue n'est pas copié : il doit survivre au modèle, et toute
+ * modification de sa liste de produits doit passer par le modèle.
+ *
+ * \param[in] p_catalogue Catalogue présenté par le modèle.
+ * \param[in] p_parent Objet Qt parent.
+ */
+ModeleCatalogue::ModeleCatalogue(Catalogue& p_catalogue, QObject* p_parent)
+    : QAbstractTableModel(p_parent), m_catalogue(p_catalogue)
+{
+}
+
+/**
+ * \brief Retourne le nombre de lignes, soit le nombre de produits du catalogue.
+ */
+int ModeleCatalogue::rowCount(const QModelIndex& p_parent) const
+{
+    return p_parent.isValid() ? 0 : static_cast<int>(m_catalogue.reqNombreProduits());
+}
+
+/**
+ * \brief Retourne le nombre de colonnes.
+ */
+int ModeleCatalogue::columnCount(const QModelIndex& p_parent) const
+{
+    return p_parent.isValid() ? 0 : NOMBRE_COLONNES;
+}
+
+/**
+ * \brief Retourne le contenu d'une cellule.
+ *
+ * Seul le rôle d'affichage est servi, ainsi que l'alignement à droite des
+ * colonnes numériques. Le produit est lu dans le catalogue à chaque appel :
+ * rien n'est conservé pour les lignes qui ne sont pas affichées.
+ *
+ * \param[in] p_index Cellule demandée.
+ * \param[in] p_role Rôle Qt demandé.
+ * \return Le texte de la cellule, ou un QVariant vide.
+ */
+QVariant ModeleCatalogue::data(const QModelIndex& p_index, int p_role) const
+{
+    if (!p_index.isValid() || p_index.row() >= rowCount())
+    {
+        return QVariant();
+    }
+
+    if (p_role == Qt::TextAlignmentRole)
+    {
+        if (p_index.column() == COLONNE_PRIX || p_index.column() == COLONNE_GARANTIE)
+        {
+            return QVariant(int(Qt::AlignRight | Qt::AlignVCenter));
+        }
+        return QVariant();
+    }
+    if (p_role != Qt::DisplayRole)
+    {
+        return QVariant();
+    }
+
+    const Produit& produit = m_catalogue.reqProduit(static_cast<size_t>(p_index.row()));
+    const Electronique* electronique = dynamic_cast<const Electronique*>(&produit);
+    const Vetement* vetement = dynamic_cast<const Vetement*>(&produit);
+
+    switch (p_index.column())
+    {
+    case COLONNE_TYPE:
+        return electronique ? QString("Electronique") : vetement ? QString("Vetement") : QString();
+    case COLONNE_DESCRIPTION:
+        return QString::fromStdString(produit.reqDescription());
+    case COLONNE_PRIX:
+        return QString::number(produit.reqPrix(), 'f', 2);
+    case COLONNE_CODE:
+        return QString::fromStdString(produit.reqCode());
+    case COLONNE_GARANTIE:
+        return electronique ? QVariant(QString::number(electronique->reqGarantieMois()) + " mois") : QVariant();
+    case COLONNE_RECONDITIONNE:
+        return electronique ? QVariant(QString(electronique->reqEstReconditionne() ? "Oui" : "Non")) : QVariant();
+    case COLONNE_TAILLE:
+        return vetement ? QVariant(QString::fromStdString(vetement->reqTaille())) : QVariant();
+    case COLONNE_COULEUR:
+        return vetement ? QVariant(QString::fromStdString(vetement->reqCouleur())) : QVariant();
+    default:
+        return QVariant();
+    }
+}
+
+/**
+ * \brief Retourne le titre d'une colonne, ou le numéro d'une ligne.
+ */
+QVariant ModeleCatalogue::headerData(int p_section, Qt::Orientation p_orientation, int p_role) const
+{
+    if (p_role != Qt::DisplayRole)
+    {
+        return QVariant();
+    }
+    if (p_orientation == Qt::Vertical)
+    {
+        return p_section + 1;
+    }
+
+    switch (p_section)
+    {
+    case COLONNE_TYPE:          return QString("Type");
+    case COLONNE_DESCRIPTION:   return QString("Description");
+    case COLONNE_PRIX:          return QString("Prix");
+    case COLONNE_CODE:          return QString("Code");
+    case COLONNE_GARANTIE:      return QString("Garantie");
+    case COLONNE_RECONDITIONNE: return QString::fromUtf8("Reconditionné");
+    case COLONNE_TAILLE:        return QString("Taille");
+    case COLONNE_COULEUR:       return QString("Couleur");
+    default:                    return QVariant();
+    }
+}
+
+/**
+ * \brief Ajoute un produit à la fin du catalogue et l'annonce à la vue.
+ *
+ * \param[in] p_produit Produit à ajouter (il est cloné par le catalogue).
+ *
+ * \exception ProduitDejaPresentException
+ *            Levée si le code du produit est déjà présent. La vérification précède
+ *            l'annonce de la nouvelle ligne : la vue n'est pas modifiée.
+ */
+void ModeleCatalogue::ajouterProduit(const Produit& p_produit)
+{
+    if (m_catalogue.contientProduit(p_produit.reqCode()))
+    {
+        throw ProduitDejaPresentException(
+            "Le produit suivant existe déjà. Voici son code: " + p_produit.reqCode());
+    }
+
+    int ligne = rowCount();
+    beginInsertRows(QModelIndex(), ligne, ligne);
+    m_catalogue.ajouterProduit(p_produit);
+    endInsertRows();
+}
+
+/**
+ * \brief Retire un produit du catalogue et annonce à la vue les lignes touchées.
+ *
+ * En mode ORDONNEE, seule la ligne du produit disparaît. En mode PERMUTATION,
+ * la dernière ligne disparaît et son produit prend la place du produit retiré.
+ *
+ * \param[in] p_codeProduit Code du produit à retirer.
+ *
+ * \exception ProduitAbsentException
+ *            Levée si aucun produit ne correspond au code; la vue n'est pas modifiée.
+ */
+void ModeleCatalogue::supprimerProduit(const string& p_codeProduit)
+{
+    int ligne = static_cast<int>(m_catalogue.reqPositionProduit(p_codeProduit));
+    int derniere = rowCount() - 1;
+
+    if (m_catalogue.reqModeSuppression() == Catalogue::ModeSuppression::PERMUTATION && ligne != derniere)
+    {
+        beginRemoveRows(QModelIndex(), derniere, derniere);
+        m_catalogue.supprimerProduit(p_codeProduit);
+        endRemoveRows();
+        emit dataChanged(index(ligne, 0), index(ligne, NOMBRE_COLONNES - 1));
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), ligne, ligne);
+    m_catalogue.supprimerProduit(p_codeProduit);
+    endRemoveRows();
+}
+
+/**
+ * \brief Remplace tout le contenu du catalogue, par exemple après un chargement.
+ *
+ * C'est la seule opération qui réinitialise entièrement la vue.
+ *
+ * \param[in] p_catalogue Nouveau contenu du catalogue.
+ */
+void ModeleCatalogue::remplacerCatalogue(const Catalogue& p_catalogue)
+{
+    beginResetModel();
+    m_catalogue = p_catalogue;
+    endResetModel();
+}
+
+/**
+ * \brief Remplace tout le contenu du catalogue sans en copier les produits.
+ *
+ * \param[in] p_catalogue Nouveau contenu du catalogue, déplacé dans le catalogue présenté.
+ */
+void ModeleCatalogue::remplacerCatalogue(Catalogue&& p_catalogue)
+{
+    beginResetModel();
+    m_catalogue = std::move(p_catalogue);
+    endResetModel();
+}
@@ -0,0 +1,64 @@
+/**
+ * \file ModeleCatalogue.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe ModeleCatalogue.
+ */
+
+#ifndef _MODELECATALOGUE_H
+#define _MODELECATALOGUE_H
+
+#include <string>
+#include <QAbstractTableModel>
+
+#include "Catalogue.h"
+
+/**
+ * \class ModeleCatalogue
+ * \brief Modèle Qt (une ligne par produit) qui présente un commerce::Catalogue à une QTableView.
+ *
+ * Le modèle ne copie aucun texte : data() lit directement le produit de la ligne
+ * demandée, si bien que la vue ne formate que les lignes visibles à l'écran.
+ *
+ * Les modifications du catalogue passent par le modèle (ajouterProduit(),
+ * supprimerProduit(), remplacerCatalogue()), qui annonce à la vue les seules
+ * lignes insérées ou retirées : la vue n'est pas reconstruite à chaque opération.
+ *
+ * Colonnes : type, description, prix, code, puis les attributs propres à chaque
+ * type de produit (garantie et reconditionnement, taille et couleur). Une cellule
+ * sans objet pour le type du produit reste vide.
+ *
+ * La classe ne déclare ni signal ni slot : elle n'a pas besoin de Q_OBJECT.
+ */
+
+class ModeleCatalogue : public QAbstractTableModel {
+public:
+    enum Colonne {
+        COLONNE_TYPE,
+        COLONNE_DESCRIPTION,
+        COLONNE_PRIX,
+        COLONNE_CODE,
+        COLONNE_GARANTIE,
+        COLONNE_RECONDITIONNE,
+        COLONNE_TAILLE,
+        COLONNE_COULEUR,
+        NOMBRE_COLONNES
+    };
+
+    explicit ModeleCatalogue(commerce::Catalogue& p_catalogue, QObject* p_parent = nullptr);
+
+    int rowCount(const QModelIndex& p_parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& p_parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& p_index, int p_role = Qt::DisplayRole) const override;
+    QVariant headerData(int p_section, Qt::Orientation p_orientation, int p_role = Qt::DisplayRole) const override;
+
+    void ajouterProduit(const commerce::Produit& p_produit);
+    void supprimerProduit(const std::string& p_codeProduit);
+    void remplacerCatalogue(const commerce::Catalogue& p_catalogue);
+    void remplacerCatalogue(commerce::Catalogue&& p_catalogue);
+
+private:
+    commerce::Catalogue& m_catalogue;
+};
+
+#endif /* _MODELECATALOGUE_H */
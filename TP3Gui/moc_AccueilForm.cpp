@@ -1,133 +0,0 @@
-/****************************************************************************
-** Meta object code from reading C++ file 'AccueilForm.h'
-**
-** Created by: The Qt Meta Object Compiler version 67 (Qt 5.15.13)
-**
-** WARNING! All changes made in this file will be lost!
-*****************************************************************************/
-
-#include <memory>
-#include "AccueilForm.h"
-#include <QtCore/qbytearray.h>
-#include <QtCore/qmetatype.h>
-#if !defined(Q_MOC_OUTPUT_REVISION)
-#error "The header file 'AccueilForm.h' doesn't include <QObject>."
-#elif Q_MOC_OUTPUT_REVISION != 67
-#error "This file was generated using the moc from 5.15.13. It"
-#error "cannot be used with the include files from this version of Qt."
-#error "(The moc has changed too much.)"
-#endif
-
-QT_BEGIN_MOC_NAMESPACE
-QT_WARNING_PUSH
-QT_WARNING_DISABLE_DEPRECATED
-struct qt_meta_stringdata_AccueilForm_t {
-    QByteArrayData data[6];
-    char stringdata0[85];
-};
-#define QT_MOC_LITERAL(idx, ofs, len) \
-    Q_STATIC_BYTE_ARRAY_DATA_HEADER_INITIALIZER_WITH_OFFSET(len, \
-    qptrdiff(offsetof(qt_meta_stringdata_AccueilForm_t, stringdata0) + ofs \
-        - idx * sizeof(QByteArrayData)) \
-    )
-static const qt_meta_stringdata_AccueilForm_t qt_meta_stringdata_AccueilForm = {
-    {
-QT_MOC_LITERAL(0, 0, 11), // "AccueilForm"
-QT_MOC_LITERAL(1, 12, 16), // "slotElectronique"
-QT_MOC_LITERAL(2, 29, 0), // ""
-QT_MOC_LITERAL(3, 30, 12), // "slotVetement"
-QT_MOC_LITERAL(4, 43, 20), // "slotSupprimerProduit"
-QT_MOC_LITERAL(5, 64, 20) // "slotChargerCatalogue"
-
-    },
-    "AccueilForm\0slotElectronique\0\0"
-    "slotVetement\0slotSupprimerProduit\0"
-    "slotChargerCatalogue"
-};
-#undef QT_MOC_LITERAL
-
-static const uint qt_meta_data_AccueilForm[] = {
-
- // content:
-       8,       // revision
-       0,       // classname
-       0,    0, // classinfo
-       4,   14, // methods
-       0,    0, // properties
-       0,    0, // enums/sets
-       0,    0, // constructors
-       0,       // flags
-       0,       // signalCount
-
- // slots: name, argc, parameters, tag, flags
-       1,    0,   34,    2, 0x08 /* Private */,
-       3,    0,   35,    2, 0x08 /* Private */,
-       4,    0,   36,    2, 0x08 /* Private */,
-       5,    0,   37,    2, 0x08 /* Private */,
-
- // slots: parameters
-    QMetaType::Void,
-    QMetaType::Void,
-    QMetaType::Void,
-    QMetaType::Void,
-
-       0        // eod
-};
-
-void AccueilForm::qt_static_metacall(QObject *_o, QMetaObject::Call _c, int _id, void **_a)
-{
-    if (_c == QMetaObject::InvokeMetaMethod) {
-        auto *_t = static_cast<AccueilForm *>(_o);
-        (void)_t;
-        switch (_id) {
-        case 0: _t->slotElectronique(); break;
-        case 1: _t->slotVetement(); break;
-        case 2: _t->slotSupprimerProduit(); break;
-        case 3: _t->slotChargerCatalogue(); break;
-        default: ;
-        }
-    }
-    (void)_a;
-}
-
-QT_INIT_METAOBJECT const QMetaObject AccueilForm::staticMetaObject = { {
-    QMetaObject::SuperData::link<QMainWindow::staticMetaObject>(),
-    qt_meta_stringdata_AccueilForm.data,
-    qt_meta_data_AccueilForm,
-    qt_static_metacall,
-    nullptr,
-    nullptr
-} };
-
-
-const QMetaObject *AccueilForm::metaObject() const
-{
-    return QObject::d_ptr->metaObject ? QObject::d_ptr->dynamicMetaObject() : &staticMetaObject;
-}
-
-void *AccueilForm::qt_metacast(const char *_clname)
-{
-    if (!_clname) return nullptr;
-    if (!strcmp(_clname, qt_meta_stringdata_AccueilForm.stringdata0))
-        return static_cast<void*>(this);
-    return QMainWindow::qt_metacast(_clname);
-}
-
-int AccueilForm::qt_metacall(QMetaObject::Call _c, int _id, void **_a)
-{
-    _id = QMainWindow::qt_metacall(_c, _id, _a);
-    if (_id < 0)
-        return _id;
-    if (_c == QMetaObject::InvokeMetaMethod) {
-        if (_id < 4)
-            qt_static_metacall(this, _c, _id, _a);
-        _id -= 4;
-    } else if (_c == QMetaObject::RegisterMethodArgumentMetaType) {
-        if (_id < 4)
-            *reinterpret_cast<int*>(_a[0]) = -1;
-        _id -= 4;
-    }
-    return _id;
-}
-QT_WARNING_POP
-QT_END_MOC_NAMESPACE
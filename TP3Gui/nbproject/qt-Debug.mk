@@ -54,6 +54,7 @@ OBJECTS_DIR   = build/Debug/GNU-Linux/
 
 SOURCES       = AccueilForm.cpp \
 		ElectroniqueForm.cpp \
+		ModeleCatalogue.cpp \
 		SupprimerProduitForm.cpp \
 		VetementForm.cpp \
 		main.cpp moc_AccueilForm.cpp \
@@ -62,6 +63,7 @@ SOURCES       = AccueilForm.cpp \
 		moc_VetementForm.cpp
 OBJECTS       = build/Debug/GNU-Linux/AccueilForm.o \
 		build/Debug/GNU-Linux/ElectroniqueForm.o \
+		build/Debug/GNU-Linux/ModeleCatalogue.o \
 		build/Debug/GNU-Linux/SupprimerProduitForm.o \
 		build/Debug/GNU-Linux/VetementForm.o \
 		build/Debug/GNU-Linux/main.o \
@@ -152,9 +154,11 @@ DIST          = /usr/lib/x86_64-linux-gnu/qt5/mkspecs/features/spec_pre.prf \
 		/usr/lib/x86_64-linux-gnu/qt5/mkspecs/features/lex.prf \
 		nbproject/nbproject/qt-Debug.pro AccueilForm.h \
 		ElectroniqueForm.h \
+		ModeleCatalogue.h \
 		SupprimerProduitForm.h \
 		VetementForm.h AccueilForm.cpp \
 		ElectroniqueForm.cpp \
+		ModeleCatalogue.cpp \
 		SupprimerProduitForm.cpp \
 		VetementForm.cpp \
 		main.cpp
@@ -462,6 +466,7 @@ build/Debug/GNU-Linux/AccueilForm.o: AccueilForm.cpp AccueilForm.h \
 		../TP3Sources/Electronique.h \
 		../TP3Sources/Vetement.h \
 		../TP3Sources/ProduitException.h \
+		ModeleCatalogue.h \
 		ElectroniqueForm.h \
 		ui_ElectroniqueForm.h \
 		VetementForm.h \
@@ -478,6 +483,17 @@ build/Debug/GNU-Linux/ElectroniqueForm.o: ElectroniqueForm.cpp ElectroniqueForm.
 		../TP3Sources/validationFormat.h
 	$(CXX) -c $(CXXFLAGS) $(INCPATH) -o build/Debug/GNU-Linux/ElectroniqueForm.o ElectroniqueForm.cpp
 
+build/Debug/GNU-Linux/ModeleCatalogue.o: ModeleCatalogue.cpp ModeleCatalogue.h \
+		../TP3Sources/Catalogue.h \
+		../TP3Sources/Produit.h \
+		../TP3Sources/ContratException.h \
+		../TP3Sources/validationFormat.h \
+		../TP3Sources/Date.h \
+		../TP3Sources/Electronique.h \
+		../TP3Sources/Vetement.h \
+		../TP3Sources/ProduitException.h
+	$(CXX) -c $(CXXFLAGS) $(INCPATH) -o build/Debug/GNU-Linux/ModeleCatalogue.o ModeleCatalogue.cpp
+
 build/Debug/GNU-Linux/SupprimerProduitForm.o: SupprimerProduitForm.cpp SupprimerProduitForm.h \
 		ui_SupprimerProduitForm.h
 	$(CXX) -c $(CXXFLAGS) $(INCPATH) -o build/Debug/GNU-Linux/SupprimerProduitForm.o SupprimerProduitForm.cpp
@@ -8,8 +8,8 @@ CONFIG -= debug_and_release app_bundle lib_bundle
 CONFIG += release 
 PKGCONFIG +=
 QT = core gui widgets
-SOURCES += AccueilForm.cpp ElectroniqueForm.cpp SupprimerProduitForm.cpp VetementForm.cpp main.cpp
-HEADERS += AccueilForm.h ElectroniqueForm.h SupprimerProduitForm.h VetementForm.h
+SOURCES += AccueilForm.cpp ElectroniqueForm.cpp ModeleCatalogue.cpp SupprimerProduitForm.cpp VetementForm.cpp main.cpp
+HEADERS += AccueilForm.h ElectroniqueForm.h ModeleCatalogue.h SupprimerProduitForm.h VetementForm.h
 FORMS += AccueilForm.ui ElectroniqueForm.ui SupprimerProduitForm.ui VetementForm.ui
 RESOURCES +=
 TRANSLATIONS +=
@@ -20,6 +20,7 @@
 #include <cctype>
 
 #include "Catalogue.h"
+#include "ChargementCatalogue.h"
 #include "Vetement.h"
 #include "Electronique.h"
 #include "Date.h"
@@ -31,99 +32,6 @@ using namespace std;
 using namespace commerce;
 using namespace util;
 
-/**
- * \brief Charge un catalogue à partir d'un fichier texte.
- *
- * Format attendu du fichier catalogue_produits_valide.txt :
- *  - Ligne 1 : nom du catalogue (ex.: "mon catalogue")
- *  - Ligne 2 : trois entiers "jour mois annee" (ex.: "21 8 2025")
- *  - Puis, une ligne par produit, au format CSV :
- *      Electronique,Description,prix,code,garantie,enRecond
- *      Vetement,Description,prix,code,taille,couleur
- *
- * Exemple :
- *  Electronique,Smartphone Galaxy,499.9,PRD-SMAR-60,24,0
- *  Vetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc
- *
- * \param[in] p_nomFichier nom du fichier catalogue à charger
- * \return Un objet Catalogue initialisé avec les produits lus
- */
-Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier)
-{
-  ifstream fichier(p_nomFichier.c_str());
-
-  if (!fichier)
-    {
-      cerr << "Erreur : impossible d'ouvrir le fichier " << p_nomFichier << endl;
-      exit(1);
-    }
-
-  // Lecture du nom du catalogue
-  string nomCatalogue;
-  std::getline(fichier, nomCatalogue);
-
-  // Lecture de la date (jour mois annee)
-  int jour = 1;
-  int mois = 1;
-  int annee = 2000;
-  fichier >> jour >> mois >> annee;
-  fichier.ignore(numeric_limits<streamsize>::max(), '\n');
-
-  Date dateCatalogue(jour, mois, annee);
-  Catalogue catalogue(nomCatalogue, dateCatalogue);
-
-  // Lecture des produits
-  string ligne;
-  while (std::getline(fichier, ligne))
-    {
-      if (ligne.empty())
-        {
-          continue;
-        }
-
-      stringstream ss(ligne);
-      string type;
-      string description;
-      string prixStr;
-      string code;
-      string champ5;
-      string champ6;
-
-      std::getline(ss, type, ',');
-      std::getline(ss, description, ',');
-      std::getline(ss, prixStr, ',');
-      std::getline(ss, code, ',');
-
-      double prix = stod(prixStr);
-
-      if (type == "Electronique")
-        {
-          std::getline(ss, champ5, ',');  // garantie
-          std::getline(ss, champ6, ',');  // reconditionné (0/1)
-
-          int garantie = stoi(champ5);
-          bool reconditionne = (champ6 == "1");
-
-          Electronique e(description, prix, code, garantie, reconditionne);
-          catalogue.ajouterProduit(e);
-        }
-      else if (type == "Vetement")
-        {
-          std::getline(ss, champ5, ',');  // taille
-          std::getline(ss, champ6, ',');  // couleur
-
-          Vetement v(description, prix, code, champ5, champ6);
-          catalogue.ajouterProduit(v);
-        }
-      else
-        {
-          // Type de produit inconnu : on ignore la ligne
-        }
-    }
-
-  return catalogue;
-}
-
 /**
  * \brief Valide si une taille de vêtement est parmi les valeurs admises.
  *
@@ -437,10 +345,20 @@ Electronique saisirElectronique()
 int main()
 {
   // Chargement du catalogue initial
-  Catalogue catalogue = chargerCatalogueDepuisFichier("catalogue_produits_valide.txt");
+  string nomFichier = "catalogue_produits_valide.txt";
+  Catalogue catalogue("catalogue vide", Date());
+  try
+  {
+    catalogue = chargerCatalogueDepuisFichier(nomFichier);
+  }
+  catch (std::exception& e)
+  {
+    cerr << "Erreur : impossible de charger le fichier " << nomFichier << " : " << e.what() << endl;
+    return 1;
+  }
 
   // Affichage du catalogue initial
-  cout << catalogue.reqCatalogueFormate();
+  catalogue.formater(cout);
   
   Electronique electro("Smartphone Galaxy", 499.90, "PRD-SMAR-60", 24, false);
   
@@ -0,0 +1,59 @@
+/**
+ * \file ArenaProduits.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe ArenaProduits
+ */
+
+#include "ArenaProduits.h"
+
+using namespace std;
+
+namespace commerce
+{
+
+namespace
+{
+
+// Taille de la première plaque; les suivantes doublent à chaque fois
+const size_t TAILLE_PREMIERE_PLAQUE = 4096;
+
+} // namespace
+
+/**
+ * \brief Construit une arène vide; la première plaque n’est allouée qu’au premier objet.
+ */
+ArenaProduits::ArenaProduits() : m_ressource(TAILLE_PREMIERE_PLAQUE), m_nbObjets(0), m_octetsUtilises(0)
+{
+}
+
+/**
+ * \brief Retourne le nombre d’objets créés dans l’arène, y compris ceux déjà détruits.
+ */
+size_t ArenaProduits::reqNombreObjets() const
+{
+    return m_nbObjets;
+}
+
+/**
+ * \brief Retourne le nombre d’octets réservés aux objets créés dans l’arène.
+ */
+size_t ArenaProduits::reqOctetsUtilises() const
+{
+    return m_octetsUtilises;
+}
+
+/**
+ * \brief Réserve un emplacement dans la plaque courante, ou dans une nouvelle plaque.
+ *
+ * \param[in] p_taille Nombre d’octets demandés.
+ * \param[in] p_alignement Alignement demandé.
+ * \return L’adresse de l’emplacement.
+ */
+void* ArenaProduits::allouer(size_t p_taille, size_t p_alignement)
+{
+    m_octetsUtilises += p_taille;
+    return m_ressource.allocate(p_taille, p_alignement);
+}
+
+} // namespace commerce
@@ -0,0 +1,130 @@
+/**
+ * \file ArenaProduits.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe ArenaProduits
+ */
+
+#ifndef ARENAPRODUITS_H
+#define ARENAPRODUITS_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace commerce
+{
+
+/**
+ * \class ArenaProduits
+ * \brief Zone mémoire dans laquelle un catalogue construit ses produits.
+ *
+ * Les produits sont placés les uns à la suite des autres dans de grandes plaques
+ * (std::pmr::monotonic_buffer_resource) dont la taille double à chaque nouvelle plaque :
+ * un catalogue de N produits ne fait qu’environ log2(N) allocations pour les loger,
+ * et ses produits se suivent en mémoire dans l’ordre où ils ont été ajoutés.
+ *
+ * creer() retourne un std::shared_ptr dont le bloc de contrôle est logé avec le produit,
+ * et qui garde l’arène en vie : un produit partagé avec une copie du catalogue reste
+ * valide après la destruction du catalogue qui l’a créé. La mémoire d’un produit détruit
+ * n’est pas réutilisée; toutes les plaques sont libérées d’un coup avec l’arène, quand
+ * son dernier produit disparaît.
+ *
+ * creer() ne doit être appelée que par un seul fil à la fois. Les produits déjà créés
+ * peuvent, eux, être détruits depuis n’importe quel fil.
+ */
+class ArenaProduits : public std::enable_shared_from_this<ArenaProduits>
+{
+public:
+    ArenaProduits();
+    ArenaProduits(const ArenaProduits&) = delete;
+    ArenaProduits& operator=(const ArenaProduits&) = delete;
+
+    template<typename T, typename... Args>
+    std::shared_ptr<T> creer(Args&&... p_args);
+
+    std::size_t reqNombreObjets() const;
+    std::size_t reqOctetsUtilises() const;
+
+private:
+    template<typename T>
+    class Allocateur;
+
+    void* allouer(std::size_t p_taille, std::size_t p_alignement);
+
+    std::pmr::monotonic_buffer_resource m_ressource;
+    std::size_t m_nbObjets;
+    std::size_t m_octetsUtilises;
+};
+
+/**
+ * \brief Allocateur standard qui puise dans une arène et la garde en vie.
+ *
+ *        Il n’est utilisé que par std::allocate_shared, qui y loge ensemble le produit
+ *        et son bloc de contrôle. La libération ne fait rien : la mémoire est rendue
+ *        avec l’arène.
+ */
+template<typename T>
+class ArenaProduits::Allocateur
+{
+public:
+    using value_type = T;
+
+    explicit Allocateur(std::shared_ptr<ArenaProduits> p_arena) : m_arena(std::move(p_arena))
+    {
+    }
+
+    template<typename U>
+    Allocateur(const Allocateur<U>& p_autre) : m_arena(p_autre.m_arena)
+    {
+    }
+
+    T* allocate(std::size_t p_nombre)
+    {
+        return static_cast<T*>(m_arena->allouer(p_nombre * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t)
+    {
+    }
+
+    template<typename U>
+    bool operator==(const Allocateur<U>& p_autre) const
+    {
+        return m_arena == p_autre.m_arena;
+    }
+
+    template<typename U>
+    bool operator!=(const Allocateur<U>& p_autre) const
+    {
+        return m_arena != p_autre.m_arena;
+    }
+
+private:
+    template<typename U>
+    friend class Allocateur;
+
+    std::shared_ptr<ArenaProduits> m_arena;
+};
+
+/**
+ * \brief Construit un objet dans l’arène.
+ *
+ * \param[in] p_args Arguments transmis au constructeur de T.
+ * \return L’objet, qui garde l’arène en vie tant qu’il existe.
+ *
+ * \pre L’arène est détenue par un std::shared_ptr.
+ */
+template<typename T, typename... Args>
+std::shared_ptr<T> ArenaProduits::creer(Args&&... p_args)
+{
+    std::shared_ptr<T> objet = std::allocate_shared<T>(Allocateur<T>(shared_from_this()),
+                                                       std::forward<Args>(p_args)...);
+    ++m_nbObjets;
+    return objet;
+}
+
+} // namespace commerce
+
+#endif /* ARENAPRODUITS_H */
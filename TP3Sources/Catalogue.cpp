@@ -9,18 +9,186 @@
 
 
 #include "Catalogue.h"
+#include "ArenaProduits.h"
 #include "ContratException.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
 #include <sstream>
 #include "ProduitException.h"
+#include "TamponTexte.h"
 using namespace std;
 using namespace util; 
 
 namespace commerce {
+
+namespace {
+
+/**
+ * \brief Convertit un code textuel en clé de l'index des codes.
+ *
+ *        Un texte mal formé donne le code vide, qui n'est associé à aucun produit
+ *        puisque ajouterProduit() refuse les produits de code vide : la recherche
+ *        échoue alors comme pour un code absent.
+ */
+CodeProduit cleIndex(const std::string& p_codeProduit)
+{
+    return CodeProduit::analyser(p_codeProduit).value_or(CodeProduit());
+}
+
+/**
+ * \brief Numéro du sous-index qui contient un code, parmi p_nbSousIndex (une puissance de 2).
+ *
+ *        Les bits de poids fort d'un hachage multiplicatif répartissent uniformément
+ *        les codes, même lorsque leurs valeurs compactées se suivent.
+ */
+size_t numeroSousIndex(const CodeProduit& p_code, size_t p_nbSousIndex)
+{
+    uint64_t valeur = p_code.reqValeur() * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(valeur >> 40) & (p_nbSousIndex - 1);
+}
+
+/**
+ * \brief Nombre de sous-index (une puissance de 2) pour qu'aucun ne dépasse p_taille entrées en moyenne.
+ */
+size_t nombreSousIndexPour(size_t p_nbProduits, size_t p_taille)
+{
+    size_t nombre = 1;
+    while (nombre * p_taille < p_nbProduits) {
+        nombre *= 2;
+    }
+    return nombre;
+}
+
+/**
+ * \brief Marque les rangs d'une colonne de prix dont la valeur est dans [p_prixMin, p_prixMax].
+ *
+ *        Les 64 comparaisons d'un mot du bitmap donnent d'abord 64 octets valant 0 ou 1,
+ *        une boucle sans branchement que le compilateur vectorise; chaque groupe de huit
+ *        octets est ensuite réduit à huit bits par une seule multiplication, qui range
+ *        l'octet i au bit 56 + i.
+ */
+IndexAttributs::Bitmap masquePrix(const vector<double>& p_prix, double p_prixMin, double p_prixMax)
+{
+    IndexAttributs::Bitmap masque{};
+    for (size_t debut = 0; debut < p_prix.size(); debut += 64) {
+        size_t nombre = std::min<size_t>(64, p_prix.size() - debut);
+        uint8_t dansIntervalle[64] = {};
+        for (size_t i = 0; i < nombre; ++i) {
+            dansIntervalle[i] = (p_prix[debut + i] >= p_prixMin) & (p_prix[debut + i] <= p_prixMax);
+        }
+        uint64_t mot = 0;
+        for (size_t octet = 0; octet < 8; ++octet) {
+            uint64_t huit;
+            memcpy(&huit, dansIntervalle + 8 * octet, sizeof huit);
+            mot |= (huit * 0x0102040810204080ULL) >> 56 << (8 * octet);
+        }
+        masque[debut / 64] = mot;
+    }
+    return masque;
+}
+
+/**
+ * \brief Produits retenus par une requête : au plus une limite, dans l'ordre demandé.
+ *
+ *        Sans tri, ou si les candidats arrivent déjà dans l'ordre demandé, les produits
+ *        sont gardés tels quels et la sélection est complète à la limite. Sinon, avec une
+ *        limite, seuls les meilleurs sont gardés : à deux fois la limite, nth_element()
+ *        écarte les moins bons, et tout candidat qui ne précède pas le dernier gardé est
+ *        rejeté sans être copié. La mémoire reste ainsi proportionnelle à la limite, et le
+ *        tri final ne porte que sur les produits gardés.
+ */
+class Selection
+{
+public:
+    Selection(RequeteCatalogue::Tri p_tri, size_t p_limite, bool p_ordreDesCandidats)
+        : m_tri(p_tri), m_limite(p_limite), m_ordreDesCandidats(p_ordreDesCandidats)
+    {
+    }
+
+    bool estComplete() const
+    {
+        return m_ordreDesCandidats && m_produits.size() >= m_limite;
+    }
+
+    void retenir(double p_prix, const CodeProduit& p_code, const shared_ptr<Produit>& p_produit)
+    {
+        if (m_ordreDesCandidats) {
+            m_produits.push_back(p_produit.get());
+            return;
+        }
+        Resultat resultat{p_prix, p_code, p_produit.get()};
+        if (m_seuil && !precede(resultat, *m_seuil)) {
+            return;
+        }
+        m_resultats.push_back(resultat);
+        if (m_limite <= numeric_limits<size_t>::max() / 2 && m_resultats.size() >= 2 * m_limite) {
+            auto dernier = m_resultats.begin() + static_cast<ptrdiff_t>(m_limite - 1);
+            nth_element(m_resultats.begin(), dernier, m_resultats.end(),
+                        [this](const Resultat& p_a, const Resultat& p_b) { return precede(p_a, p_b); });
+            m_resultats.resize(m_limite);
+            m_seuil = m_resultats.back();
+        }
+    }
+
+    vector<const Produit*> produits()
+    {
+        if (!m_ordreDesCandidats) {
+            sort(m_resultats.begin(), m_resultats.end(),
+                 [this](const Resultat& p_a, const Resultat& p_b) { return precede(p_a, p_b); });
+            m_produits.reserve(std::min(m_limite, m_resultats.size()));
+            for (const Resultat& resultat : m_resultats) {
+                m_produits.push_back(resultat.produit);
+            }
+        }
+        if (m_produits.size() > m_limite) {
+            m_produits.resize(m_limite);
+        }
+        return std::move(m_produits);
+    }
+
+private:
+    struct Resultat
+    {
+        double prix;
+        CodeProduit code;
+        const Produit* produit;
+    };
+
+    bool precede(const Resultat& p_a, const Resultat& p_b) const
+    {
+        switch (m_tri) {
+        case RequeteCatalogue::Tri::PRIX_CROISSANT:
+            return p_a.prix < p_b.prix || (p_a.prix == p_b.prix && p_a.code < p_b.code);
+        case RequeteCatalogue::Tri::PRIX_DECROISSANT:
+            return p_b.prix < p_a.prix || (p_a.prix == p_b.prix && p_b.code < p_a.code);
+        case RequeteCatalogue::Tri::DESCRIPTION: {
+            int comparaison = p_a.produit->reqDescription().compare(p_b.produit->reqDescription());
+            return comparaison < 0 || (comparaison == 0 && p_a.code < p_b.code);
+        }
+        case RequeteCatalogue::Tri::AUCUN:
+            break;
+        }
+        return false;
+    }
+
+    RequeteCatalogue::Tri m_tri;
+    size_t m_limite;
+    bool m_ordreDesCandidats;
+    vector<Resultat> m_resultats;
+    optional<Resultat> m_seuil;
+    vector<const Produit*> m_produits;
+};
+
+} // namespace
     
 /**
    * \brief Constructeur avec paramètres.
    *
    *        Initialise un catalogue avec un nom et une date de dernière mise à jour.
+   *        Les suppressions conservent l'ordre d'insertion par défaut.
    *        Le nom du catalogue doit être non vide. En cas de violation, une erreur
    *        de précondition est générée.
    *
@@ -32,7 +200,8 @@ namespace commerce {
    * \post m_dateDerniereMiseAJour == p_dateDerniereMiseAJour
    */
     
-Catalogue::Catalogue(const std::string& p_nom, const util::Date& p_dateDerniereMiseAJour): m_nom(p_nom), m_dateDerniereMiseAJour(p_dateDerniereMiseAJour) {
+Catalogue::Catalogue(const std::string& p_nom, const util::Date& p_dateDerniereMiseAJour): m_nom(p_nom), m_dateDerniereMiseAJour(p_dateDerniereMiseAJour),
+        m_nbProduits(0), m_sousIndex(1), m_modeSuppression(ModeSuppression::ORDONNEE) {
     
     PRECONDITION (!p_nom.empty());
     
@@ -45,28 +214,47 @@ Catalogue::Catalogue(const std::string& p_nom, const util::Date& p_dateDerniereM
  /**
    * \brief Constructeur de copie.
    *
-   *        Copie en profondeur un catalogue existant. Tous les produits sont clonés
-   *        individuellement via la méthode polymorphique Produit::clone().
+   *        La copie partage les blocs de produits et les sous-index du catalogue copié :
+   *        seules les deux tables de pointeurs sont recopiées, sans cloner aucun produit.
+   *        Le premier des deux catalogues qui modifie un bloc ou un sous-index partagé
+   *        en fait d'abord sa propre copie (voir blocModifiable()). La copie n'utilise
+   *        pas l'arène du catalogue copié : ses propres produits iront dans une autre.
    *
    * \param[in] p_catalogue Catalogue à copier.
    *
-   * \post Le nouvel objet contient une copie complète et indépendante
-   *       des produits du catalogue passé en paramètre.
+   * \post Le nouvel objet se comporte comme une copie complète et indépendante
+   *       du catalogue passé en paramètre.
    */
-Catalogue::Catalogue(const Catalogue& p_catalogue): m_nom(p_catalogue.m_nom), m_dateDerniereMiseAJour(p_catalogue.m_dateDerniereMiseAJour) {
-        for (const auto& produit : p_catalogue.m_produits) {
-            m_produits.push_back(produit->clone());
-        }
+Catalogue::Catalogue(const Catalogue& p_catalogue): m_nom(p_catalogue.m_nom), m_dateDerniereMiseAJour(p_catalogue.m_dateDerniereMiseAJour),
+        m_nbProduits(p_catalogue.m_nbProduits), m_blocs(p_catalogue.m_blocs), m_sousIndex(p_catalogue.m_sousIndex),
+        m_indexPrix(p_catalogue.m_indexPrix), m_indexTexte(p_catalogue.m_indexTexte), m_modeSuppression(p_catalogue.m_modeSuppression) {
         INVARIANTS();
 }
 
+/**
+ * \brief Constructeur de déplacement.
+ *
+ *        Reprend les blocs de produits et les sous-index d'un autre catalogue
+ *        sans rien copier. Permet notamment de remettre à un autre fil un catalogue
+ *        chargé en arrière-plan.
+ *
+ * \param[in] p_catalogue Catalogue déplacé; il ne peut ensuite qu'être détruit ou assigné.
+ */
+Catalogue::Catalogue(Catalogue&& p_catalogue) noexcept: m_nom(std::move(p_catalogue.m_nom)),
+        m_dateDerniereMiseAJour(p_catalogue.m_dateDerniereMiseAJour), m_nbProduits(p_catalogue.m_nbProduits),
+        m_blocs(std::move(p_catalogue.m_blocs)), m_sousIndex(std::move(p_catalogue.m_sousIndex)),
+        m_arena(std::move(p_catalogue.m_arena)), m_indexPrix(std::move(p_catalogue.m_indexPrix)),
+        m_indexTexte(std::move(p_catalogue.m_indexTexte)),
+        m_modeSuppression(p_catalogue.m_modeSuppression) {
+    p_catalogue.m_nbProduits = 0;
+}
+
 /**
  * \brief Opérateur d’assignation par copie.
  *
- *        Remplace le contenu du catalogue courant par une copie en profondeur
- *        d’un autre catalogue. Tous les produits du catalogue source sont
- *        clonés individuellement (via Produit::clone()) afin de préserver
- *        le polymorphisme et d’éviter tout partage de pointeurs.
+ *        Remplace le contenu du catalogue courant par celui d’un autre catalogue.
+ *        Comme pour le constructeur de copie, les blocs de produits et les
+ *        sous-index sont partagés jusqu’à leur première modification.
  *
  * \param[in] p_catalogue Catalogue source à copier.
  *
@@ -82,16 +270,44 @@ Catalogue& Catalogue::operator=(const Catalogue& p_catalogue)
     if (this != &p_catalogue) {
         m_nom = p_catalogue.m_nom;
         m_dateDerniereMiseAJour = p_catalogue.m_dateDerniereMiseAJour;
-
-        m_produits.clear();
-        for (const auto& produit : p_catalogue.m_produits) {
-            m_produits.push_back(produit->clone());
-        }
+        m_nbProduits = p_catalogue.m_nbProduits;
+        m_blocs = p_catalogue.m_blocs;
+        m_sousIndex = p_catalogue.m_sousIndex;
+        m_arena.reset();
+        m_indexPrix = p_catalogue.m_indexPrix;
+        m_indexTexte = p_catalogue.m_indexTexte;
+        m_modeSuppression = p_catalogue.m_modeSuppression;
 
         INVARIANTS();
     }
     return *this;
 }
+
+/**
+ * \brief Opérateur d’assignation par déplacement.
+ *
+ *        Remplace le contenu du catalogue courant par celui d'un autre catalogue,
+ *        sans cloner ses produits.
+ *
+ * \param[in] p_catalogue Catalogue déplacé; il ne peut ensuite qu'être détruit ou assigné.
+ * \return Une référence vers le catalogue courant.
+ */
+Catalogue& Catalogue::operator=(Catalogue&& p_catalogue) noexcept
+{
+    if (this != &p_catalogue) {
+        m_nom = std::move(p_catalogue.m_nom);
+        m_dateDerniereMiseAJour = p_catalogue.m_dateDerniereMiseAJour;
+        m_nbProduits = p_catalogue.m_nbProduits;
+        m_blocs = std::move(p_catalogue.m_blocs);
+        m_sousIndex = std::move(p_catalogue.m_sousIndex);
+        m_arena = std::move(p_catalogue.m_arena);
+        m_indexPrix = std::move(p_catalogue.m_indexPrix);
+        m_indexTexte = std::move(p_catalogue.m_indexTexte);
+        m_modeSuppression = p_catalogue.m_modeSuppression;
+        p_catalogue.m_nbProduits = 0;
+    }
+    return *this;
+}
  
  /**
    * \brief Retourne le nom du catalogue.
@@ -123,14 +339,19 @@ void Catalogue::asgDerniereMiseAJour(const util::Date& p_date)
 /**
  * \brief Ajoute un produit au catalogue.
  *
- *        Le produit passé en paramètre est cloné à l'aide de la méthode
- *        polymorphique Produit::clone(), afin d'éviter toute dépendance
- *        envers l'objet original. Avant l'ajout, la méthode vérifie que
- *        le code du produit n'est pas déjà présent dans le catalogue.
+ *        Le produit passé en paramètre est cloné dans l'arène du catalogue à
+ *        l'aide de la méthode polymorphique Produit::cloneDans(), afin d'éviter
+ *        toute dépendance envers l'objet original. Avant l'ajout, la méthode vérifie (en temps
+ *        constant, via l'index des codes) que le code du produit n'est pas
+ *        déjà présent dans le catalogue.
  *        En cas de doublon, une ProduitDejaPresentException est levée.
  *
  * \param[in] p_nouveauProduit Le produit à ajouter au catalogue.
  *
+ * \exception ProduitException
+ *            Levée si le code du produit est vide : un code mal formé donné au
+ *            constructeur du produit est remplacé par le code vide lorsque NDEBUG
+ *            est défini, et un tel produit serait retrouvé par tout code mal formé.
  * \exception ProduitDejaPresentException
  *            Levée si un produit possédant le même code est déjà présent.
  */
@@ -138,22 +359,166 @@ void Catalogue::asgDerniereMiseAJour(const util::Date& p_date)
 
 void Catalogue::ajouterProduit (const Produit& p_nouveauProduit)
 {
-    if (produitEstDejaPresent(p_nouveauProduit.reqCode())) {
+    if (p_nouveauProduit.reqCodeProduit().estVide()) {
+        throw ProduitException("Le code du produit suivant est invalide : " + p_nouveauProduit.reqDescription());
+    }
+    if (produitEstDejaPresent(p_nouveauProduit.reqCodeProduit())) {
         throw ProduitDejaPresentException(
             "Le produit suivant existe déjà. Voici son code: " + p_nouveauProduit.reqCode());
     }
 
-    m_produits.push_back(p_nouveauProduit.clone());
+    ajouterEnFin(p_nouveauProduit.cloneDans(arena()));
+    INVARIANT(produitIndexeValide(m_nbProduits - 1));
+}
+
+/**
+ * \brief Ajoute au catalogue un produit déjà alloué, sans le cloner.
+ *
+ *        Le catalogue prend possession du produit et le déplace dans son arène :
+ *        ses chaînes sont reprises sans copie. Les chargeurs, qui construisent
+ *        chaque produit une seule fois, évitent ainsi une copie par produit.
+ *
+ * \param[in] p_nouveauProduit Le produit à ajouter au catalogue.
+ *
+ * \pre p_nouveauProduit n'est pas nul.
+ *
+ * \exception ProduitException
+ *            Levée si le code du produit est vide, comme pour l'autre ajouterProduit();
+ *            le produit est alors détruit.
+ * \exception ProduitDejaPresentException
+ *            Levée si un produit possédant le même code est déjà présent; le
+ *            produit est alors détruit.
+ */
+void Catalogue::ajouterProduit (std::unique_ptr<Produit> p_nouveauProduit)
+{
+    PRECONDITION(p_nouveauProduit != nullptr);
+
+    if (p_nouveauProduit->reqCodeProduit().estVide()) {
+        throw ProduitException("Le code du produit suivant est invalide : " + p_nouveauProduit->reqDescription());
+    }
+
+    if (produitEstDejaPresent(p_nouveauProduit->reqCodeProduit())) {
+        throw ProduitDejaPresentException(
+            "Le produit suivant existe déjà. Voici son code: " + p_nouveauProduit->reqCode());
+    }
+
+    ajouterEnFin(p_nouveauProduit->deplacerDans(arena()));
+    INVARIANT(produitIndexeValide(m_nbProduits - 1));
+}
+
+/**
+ * \brief Ajoute au catalogue, dans l'ordre, des produits déjà alloués, sans les cloner.
+ *
+ *        Le résultat est celui d'un appel à ajouterProduit() pour chaque produit, mais
+ *        l'index des codes n'est réparti qu'une fois, puis rempli un sous-index après
+ *        l'autre : chaque code n'y est cherché qu'une fois, et les insertions dans un
+ *        même sous-index se suivent. Les chargeurs fusionnent ainsi leurs tronçons.
+ *
+ * \param[in] p_nouveauxProduits Les produits à ajouter, dans l'ordre voulu.
+ *
+ * \pre Aucun des produits n'est nul.
+ *
+ * \exception ProduitException
+ *            Levée pour le premier produit dont le code est vide, comme par
+ *            ajouterProduit(); les produits qui le précèdent sont ajoutés, les
+ *            suivants sont détruits.
+ * \exception ProduitDejaPresentException
+ *            Levée pour le premier produit dont le code est déjà présent, dans le
+ *            catalogue ou plus tôt dans p_nouveauxProduits; les produits qui le
+ *            précèdent sont ajoutés, les suivants sont détruits.
+ */
+void Catalogue::ajouterProduits (std::vector<std::unique_ptr<Produit>> p_nouveauxProduits)
+{
+    // Les codes sont relevés une seule fois : les passes suivantes ne suivent aucun pointeur.
+    vector<CodeProduit> codes;
+    codes.reserve(p_nouveauxProduits.size());
+    for (const auto& produit : p_nouveauxProduits) {
+        PRECONDITION(produit != nullptr);
+        if (produit->reqCodeProduit().estVide()) {
+            break;
+        }
+        codes.push_back(produit->reqCodeProduit());
+    }
+    size_t nbAValider = codes.size();
+    reserver(m_nbProduits + nbAValider);
+
+    // Tri par sous-index (stable, donc dans l'ordre des produits) des rangs à indexer.
+    size_t nbSousIndex = m_sousIndex.size();
+    vector<size_t> numeros(nbAValider);
+    vector<size_t> debuts(nbSousIndex + 1, 0);
+    for (size_t i = 0; i < nbAValider; ++i) {
+        numeros[i] = numeroSousIndex(codes[i], nbSousIndex);
+        ++debuts[numeros[i] + 1];
+    }
+    for (size_t numero = 0; numero < nbSousIndex; ++numero) {
+        debuts[numero + 1] += debuts[numero];
+    }
+    vector<size_t> rangs(nbAValider);
+    vector<size_t> suivants(debuts.begin(), debuts.end() - 1);
+    for (size_t i = 0; i < nbAValider; ++i) {
+        rangs[suivants[numeros[i]]++] = i;
+    }
+
+    size_t nbAjoutes = nbAValider;
+    for (size_t numero = 0; numero < nbSousIndex; ++numero) {
+        if (debuts[numero] == debuts[numero + 1]) {
+            continue;
+        }
+        SousIndex& table = *sousIndex(codes[rangs[debuts[numero]]]);
+        for (size_t j = debuts[numero]; j < debuts[numero + 1]; ++j) {
+            if (!table.emplace(codes[rangs[j]], m_nbProduits + rangs[j]).second) {
+                nbAjoutes = min(nbAjoutes, rangs[j]);
+            }
+        }
+    }
+    // Après un doublon, les codes des produits refusés qui ont été indexés sont retirés.
+    for (size_t i = nbAjoutes; i < nbAValider; ++i) {
+        SousIndex& table = *m_sousIndex[numeros[i]];
+        auto entree = table.find(codes[i]);
+        if (entree != table.end() && entree->second == m_nbProduits + i) {
+            table.erase(entree);
+        }
+    }
+
+    for (size_t i = 0; i < nbAjoutes; ++i) {
+        rangerEnFin(p_nouveauxProduits[i]->deplacerDans(arena()));
+    }
     INVARIANTS();
+
+    if (nbAjoutes < nbAValider) {
+        throw ProduitDejaPresentException(
+            "Le produit suivant existe déjà. Voici son code: " + p_nouveauxProduits[nbAjoutes]->reqCode());
+    }
+    if (nbAjoutes < p_nouveauxProduits.size()) {
+        throw ProduitException("Le code du produit suivant est invalide : " + p_nouveauxProduits[nbAjoutes]->reqDescription());
+    }
+}
+
+/**
+ * \brief Prévoit l'espace nécessaire pour un nombre donné de produits.
+ *
+ *        Évite les réallocations successives de la table des blocs et des
+ *        sous-index lorsque le nombre de produits à ajouter est connu d'avance.
+ *
+ * \param[in] p_nbProduits Nombre total de produits attendu.
+ */
+
+void Catalogue::reserver (size_t p_nbProduits)
+{
+    m_blocs.reserve((p_nbProduits + TAILLE_BLOC - 1) / TAILLE_BLOC);
+    size_t nbSousIndex = nombreSousIndexPour(p_nbProduits, TAILLE_SOUS_INDEX);
+    if (nbSousIndex > m_sousIndex.size()) {
+        repartirIndex(nbSousIndex);
+    }
 }
 
 /**
  * \brief Supprime un produit du catalogue à partir de son code.
  *
- *        Parcourt la liste des produits et recherche un produit dont le
- *        code correspond à celui passé en paramètre. Si un tel produit
- *        est trouvé, il est supprimé du catalogue. Dans le cas contraire,
- *        une ProduitAbsentException est levée.
+ *        Recherche la position du produit dans l'index des codes. Si un
+ *        tel produit est trouvé, il est supprimé du catalogue selon le mode
+ *        de suppression du catalogue (voir asgModeSuppression()).
+ *        Dans le cas contraire, une ProduitAbsentException est levée.
  *
  * \param[in] p_codeProduit Code du produit à supprimer.
  *
@@ -163,68 +528,1229 @@ void Catalogue::ajouterProduit (const Produit& p_nouveauProduit)
 
 void Catalogue::supprimerProduit (const std::string& p_codeProduit)
 {
-    for (auto iter = m_produits.begin(); iter != m_produits.end(); ++iter) {
-        if ((*iter)->reqCode() == p_codeProduit) {
-            m_produits.erase(iter);
-            INVARIANTS();
-            return;
-        }
+    supprimerProduit(p_codeProduit, m_modeSuppression);
+}
+
+/**
+ * \brief Supprime un produit du catalogue selon un mode de suppression donné.
+ *
+ *        Permet de choisir, pour un appel précis, un mode différent de celui
+ *        du catalogue (voir ModeSuppression).
+ *
+ * \param[in] p_codeProduit Code du produit à supprimer.
+ * \param[in] p_mode Façon de retirer le produit de la liste.
+ *
+ * \exception ProduitAbsentException
+ *            Levée si aucun produit dans le catalogue ne correspond au code fourni.
+ */
+
+void Catalogue::supprimerProduit (const std::string& p_codeProduit, ModeSuppression p_mode)
+{
+    size_t position = 0;
+    if (!chercherPosition(cleIndex(p_codeProduit), position)) {
+        throw ProduitAbsentException("Aucun produit avec le code : " + p_codeProduit);
     }
 
-   
-    throw ProduitAbsentException("Aucun produit avec le code : " + p_codeProduit);
+    retirerProduit(position, p_mode);
+    INVARIANT(listeValide() && !produitEstDejaPresent(cleIndex(p_codeProduit)));
+    INVARIANT(position == m_nbProduits || produitIndexeValide(position));
 }
 
- /**
-   * \brief Retourne une version textuelle formatée du catalogue.
-   *
-   *        Cette représentation inclut :
-   *        - le nom du catalogue ;
-   *        - la date de dernière mise à jour ;
-   *        - la liste des produits avec leur propre formatage.
-   *
-   * \return Une chaîne contenant la représentation formatée.
-   */    
-    
-std::string Catalogue::reqCatalogueFormate() const{
-    ostringstream oss;
-    oss << "Catalogue " << m_nom << endl
-    << "Dernière mise a jour : " << m_dateDerniereMiseAJour << endl;
-    
-    for (const auto& produit : m_produits) {
-            oss << produit->reqProduitFormate() << endl;
+/**
+ * \brief Supprime un lot de produits du catalogue.
+ *
+ *        Tous les codes sont d'abord vérifiés : si l'un d'eux est absent,
+ *        une exception est levée et le catalogue n'est pas modifié.
+ *        En mode ORDONNEE, la liste est compactée en une seule passe, ce qui
+ *        évite de décaler les produits une fois par code. En mode PERMUTATION,
+ *        chaque produit est retiré en temps constant.
+ *        Un code présent plusieurs fois dans le lot n'est retiré qu'une fois.
+ *
+ * \param[in] p_codesProduits Codes des produits à supprimer.
+ *
+ * \exception ProduitAbsentException
+ *            Levée si un des codes ne correspond à aucun produit du catalogue.
+ */
+
+void Catalogue::supprimerProduits (const std::vector<std::string>& p_codesProduits)
+{
+    for (const auto& code : p_codesProduits) {
+        if (!produitEstDejaPresent(cleIndex(code))) {
+            throw ProduitAbsentException("Aucun produit avec le code : " + code);
+        }
+    }
+
+    if (m_modeSuppression == ModeSuppression::PERMUTATION) {
+        for (const auto& code : p_codesProduits) {
+            size_t position = 0;
+            if (chercherPosition(cleIndex(code), position)) {
+                retirerProduit(position, ModeSuppression::PERMUTATION);
+            }
+        }
+        INVARIANTS();
+        return;
+    }
+
+    vector<bool> aRetirer(m_nbProduits, false);
+    for (const auto& code : p_codesProduits) {
+        CodeProduit cle = cleIndex(code);
+        size_t position = 0;
+        if (chercherPosition(cle, position)) {
+            aRetirer[position] = true;
+            desindexerRequetes(position);
+            desindexer(cle);
+        }
+    }
+
+    size_t destination = 0;
+    for (size_t source = 0; source < m_nbProduits; ++source) {
+        if (aRetirer[source]) {
+            continue;
         }
-    return oss.str();
+        if (destination != source) {
+            deplacerProduit(source, destination);
+        }
+        ++destination;
+    }
+    tronquer(destination);
+    INVARIANTS();
 }
 
 /**
- * \brief Vérifie si un produit avec un code donné est déjà présent dans le catalogue.
+ * \brief Retourne le mode de suppression utilisé par défaut par le catalogue.
+ * \return Le mode de suppression courant.
+ */
+
+Catalogue::ModeSuppression Catalogue::reqModeSuppression() const
+{
+    return m_modeSuppression;
+}
+
+/**
+ * \brief Change le mode de suppression utilisé par défaut par le catalogue.
+ * \param[in] p_mode Le nouveau mode de suppression.
+ * \post reqModeSuppression() == p_mode
+ */
+
+void Catalogue::asgModeSuppression(ModeSuppression p_mode)
+{
+    m_modeSuppression = p_mode;
+    POSTCONDITION(m_modeSuppression == p_mode);
+    INVARIANTS();
+}
+
+/**
+ * \brief Retrouve un produit du catalogue à partir de son code.
  *
- *        Parcourt la collection de produits et compare le code de chacun
- *        d’eux avec le code reçu en paramètre. La recherche s’arrête dès
- *        qu’un produit correspondant est trouvé.
+ *        La recherche se fait en temps constant grâce à l'index des codes.
+ *        Le produit retourné appartient au catalogue : la référence reste
+ *        valide tant que le produit n'en est pas retiré ni son prix modifié.
  *
- * \param[in] p_codeProduit Code du produit à rechercher.
+ * \param[in] p_codeProduit Code du produit recherché.
  *
+ * \return Une référence constante vers le produit correspondant.
+ *
+ * \exception ProduitAbsentException
+ *            Levée si aucun produit dans le catalogue ne correspond au code fourni.
+ */
+
+const Produit& Catalogue::trouverProduit (const std::string& p_codeProduit) const
+{
+    size_t position = 0;
+    if (!chercherPosition(cleIndex(p_codeProduit), position)) {
+        throw ProduitAbsentException("Aucun produit avec le code : " + p_codeProduit);
+    }
+    return reqProduit(position);
+}
+
+/**
+ * \brief Retrouve un produit du catalogue à partir de son code compacté.
+ *
+ *        Évite l'analyse du code textuel lorsque l'appelant dispose déjà d'un
+ *        util::CodeProduit (par exemple celui d'un autre produit).
+ *
+ * \param[in] p_codeProduit Code du produit recherché.
+ *
+ * \return Une référence constante vers le produit correspondant.
+ *
+ * \exception ProduitAbsentException
+ *            Levée si aucun produit dans le catalogue ne correspond au code fourni.
+ */
+
+const Produit& Catalogue::trouverProduit (const util::CodeProduit& p_codeProduit) const
+{
+    size_t position = 0;
+    if (!chercherPosition(p_codeProduit, position)) {
+        throw ProduitAbsentException("Aucun produit avec le code : " + p_codeProduit.reqTexte());
+    }
+    return reqProduit(position);
+}
+
+/**
+ * \brief Retourne le nombre de produits du catalogue.
+ * \return Le nombre de produits.
+ */
+
+size_t Catalogue::reqNombreProduits() const
+{
+    return m_nbProduits;
+}
+
+/**
+ * \brief Retourne le produit situé à une position donnée.
+ *
+ *        Les positions vont de 0 à reqNombreProduits() - 1 et suivent l'ordre
+ *        de la liste des produits (voir ModeSuppression).
+ *
+ * \param[in] p_position Position du produit.
+ * \return Une référence constante vers le produit.
+ *
+ * \pre p_position < reqNombreProduits()
+ */
+
+const Produit& Catalogue::reqProduit(size_t p_position) const
+{
+    PRECONDITION(p_position < m_nbProduits);
+    return *m_blocs[p_position / TAILLE_BLOC]->produits[p_position % TAILLE_BLOC];
+}
+
+/**
+ * \brief Indique si un produit du catalogue possède un code donné.
+ *
+ *        Permet de vérifier un ajout avant de le faire, sans recourir à une exception.
+ *
+ * \param[in] p_codeProduit Code du produit recherché.
  * \return true si un produit du catalogue possède ce code, false sinon.
  */
 
-bool Catalogue::produitEstDejaPresent(const std::string& p_codeProduit) const
+bool Catalogue::contientProduit(const std::string& p_codeProduit) const
 {
-    for (auto iter = m_produits.begin(); iter != m_produits.end(); ++iter) {
-        if ((*iter)->reqCode() == p_codeProduit) {
-            return true;
-        }
+    return produitEstDejaPresent(cleIndex(p_codeProduit));
+}
+
+/**
+ * \brief Retourne la position d'un produit dans la liste à partir de son code.
+ *
+ *        La recherche se fait en temps constant grâce à l'index des codes. Permet,
+ *        par exemple, à une vue de savoir quelle ligne retirer avant une suppression.
+ *
+ * \param[in] p_codeProduit Code du produit recherché.
+ * \return La position du produit, de 0 à reqNombreProduits() - 1.
+ *
+ * \exception ProduitAbsentException
+ *            Levée si aucun produit dans le catalogue ne correspond au code fourni.
+ */
+
+size_t Catalogue::reqPositionProduit(const std::string& p_codeProduit) const
+{
+    size_t position = 0;
+    if (!chercherPosition(cleIndex(p_codeProduit), position)) {
+        throw ProduitAbsentException("Aucun produit avec le code : " + p_codeProduit);
     }
-    return false;
+    return position;
 }
- /**
-   * \brief Vérifie les invariants de la classe Catalogue.
-   *
-   * \invariant !m_nom.empty()
-   */
-void Catalogue::verifieInvariant() const{
-    INVARIANT(!m_nom.empty());
+
+/**
+ * \brief Modifie le prix d'un produit du catalogue.
+ *
+ *        Le code d'un produit dépend de son prix (voir Produit::asgPrix()) :
+ *        l'index des codes est mis à jour avec le nouveau code, et le texte
+ *        formaté du produit est retiré du cache. Si le nouveau code est déjà
+ *        celui d'un autre produit, le catalogue n'est pas modifié. Un produit
+ *        partagé avec une copie du catalogue est d'abord cloné : la copie
+ *        conserve l'ancien prix.
+ *
+ * \param[in] p_codeProduit Code actuel du produit.
+ * \param[in] p_prix Nouveau prix du produit.
+ *
+ * \pre p_prix >= 0
+ * \post trouverProduit(nouveau code).reqPrix() == p_prix
+ *
+ * \exception ProduitAbsentException
+ *            Levée si aucun produit dans le catalogue ne correspond au code fourni.
+ * \exception ProduitDejaPresentException
+ *            Levée si le nouveau code est celui d'un autre produit du catalogue.
+ */
+
+void Catalogue::asgPrixProduit (const std::string& p_codeProduit, double p_prix)
+{
+    PRECONDITION(p_prix >= 0);
+
+    CodeProduit ancienCode = cleIndex(p_codeProduit);
+    size_t position = 0;
+    if (!chercherPosition(ancienCode, position)) {
+        throw ProduitAbsentException("Aucun produit avec le code : " + p_codeProduit);
+    }
+
+    CodeProduit nouveauCode = CodeProduit::generer(reqProduit(position).reqDescription(), p_prix);
+    if (nouveauCode != ancienCode && produitEstDejaPresent(nouveauCode)) {
+        throw ProduitDejaPresentException(
+            "Le produit suivant existe déjà. Voici son code: " + nouveauCode.reqTexte());
+    }
+
+    desindexerRequetes(position);
+    Bloc& bloc = blocModifiable(position / TAILLE_BLOC);
+    shared_ptr<Produit>& produit = bloc.produits[position % TAILLE_BLOC];
+    if (produit.use_count() > 1) {
+        produit = produit->cloneDans(arena());
+    }
+
+    desindexer(ancienCode);
+    produit->asgPrix(p_prix);
+    indexer(produit->reqCodeProduit(), position);
+    bloc.prix[position % TAILLE_BLOC] = p_prix;
+    bloc.codes[position % TAILLE_BLOC] = produit->reqCodeProduit();
+    indexerRequetes(*produit);
+    bloc.textes[position % TAILLE_BLOC].clear();
+
+    POSTCONDITION(produit->reqPrix() == p_prix);
+    INVARIANT(produitIndexeValide(position));
+}
+
+/**
+ * \brief Retourne la somme des prix des produits du catalogue.
+ *
+ *        Seule la colonne des prix de chaque bloc est parcourue.
+ *
+ * \return La valeur totale du catalogue, 0 s'il est vide.
+ */
+
+double Catalogue::reqValeurTotale() const
+{
+    double total = 0;
+    for (const auto& bloc : m_blocs) {
+        for (double prix : bloc->prix) {
+            total += prix;
+        }
+    }
+    return total;
+}
+
+/**
+ * \brief Retourne la position des produits dont le prix est dans une fourchette.
+ *
+ *        Seule la colonne des prix de chaque bloc est parcourue; les produits
+ *        eux-mêmes s'obtiennent ensuite par reqProduit().
+ *
+ * \param[in] p_prixMin Prix minimal, inclus.
+ * \param[in] p_prixMax Prix maximal, inclus.
+ * \return Les positions, en ordre croissant.
+ *
+ * \pre p_prixMin <= p_prixMax
+ */
+
+vector<size_t> Catalogue::trouverPositionsParPrix(double p_prixMin, double p_prixMax) const
+{
+    PRECONDITION(p_prixMin <= p_prixMax);
+
+    vector<size_t> positions;
+    for (size_t numBloc = 0; numBloc < m_blocs.size(); ++numBloc) {
+        const vector<double>& colonne = m_blocs[numBloc]->prix;
+        for (size_t rang = 0; rang < colonne.size(); ++rang) {
+            if (colonne[rang] >= p_prixMin && colonne[rang] <= p_prixMax) {
+                positions.push_back(numBloc * TAILLE_BLOC + rang);
+            }
+        }
+    }
+    return positions;
+}
+
+/**
+ * \brief Retourne les produits dont le prix est dans un intervalle, du moins cher au plus cher.
+ *
+ *        La requête passe par l'index des prix, construit au premier appel; les
+ *        produits sont retournés sans copie. À prix égal, ils sont rangés par code.
+ *        Les pointeurs restent valides tant que le catalogue n'est pas modifié.
+ *
+ * \param[in] p_prixMin Prix minimal, inclus.
+ * \param[in] p_prixMax Prix maximal, inclus.
+ * \return Les produits de l'intervalle.
+ *
+ * \pre p_prixMin <= p_prixMax
+ */
+
+vector<const Produit*> Catalogue::produitsDansIntervallePrix(double p_prixMin, double p_prixMax) const
+{
+    PRECONDITION(p_prixMin <= p_prixMax);
+    return indexPrix().dansIntervalle(p_prixMin, p_prixMax);
+}
+
+/**
+ * \brief Retourne les p_nombre produits les moins chers, du moins cher au plus cher.
+ *
+ *        Comme produitsDansIntervallePrix(), la requête passe par l'index des prix.
+ *
+ * \param[in] p_nombre Nombre maximal de produits retournés.
+ * \return Les produits, au plus p_nombre.
+ */
+
+vector<const Produit*> Catalogue::moinsChers(size_t p_nombre) const
+{
+    return indexPrix().moinsChers(p_nombre);
+}
+
+/**
+ * \brief Retourne les p_nombre produits les plus chers, du plus cher au moins cher.
+ *
+ *        Comme produitsDansIntervallePrix(), la requête passe par l'index des prix.
+ *
+ * \param[in] p_nombre Nombre maximal de produits retournés.
+ * \return Les produits, au plus p_nombre.
+ */
+
+vector<const Produit*> Catalogue::plusChers(size_t p_nombre) const
+{
+    return indexPrix().plusChers(p_nombre);
+}
+
+/**
+ * \brief Retourne les produits dont la description contient tous les mots d'une requête.
+ *
+ * \param[in] p_requete Mots recherchés (voir l'autre surcharge).
+ * \return Les produits, dans un ordre non spécifié.
+ */
+
+vector<const Produit*> Catalogue::rechercherProduits(const string& p_requete) const
+{
+    return rechercherProduits(p_requete, OperateurRecherche::ET);
+}
+
+/**
+ * \brief Retourne les produits dont la description répond à une requête.
+ *
+ *        Les mots sont comparés sans tenir compte des majuscules ni des accents :
+ *        « ecran » trouve « Écran ». Un mot terminé par « * » trouve tous les mots qui
+ *        commencent ainsi. La requête passe par l'index des mots, construit au premier
+ *        appel; les produits sont retournés sans copie, et les pointeurs restent valides
+ *        tant que le catalogue n'est pas modifié.
+ *
+ * \param[in] p_requete Mots recherchés, par exemple « chemise lin » ou « chauss* ».
+ * \param[in] p_operateur ET pour exiger tous les mots, OU pour en exiger au moins un.
+ * \return Les produits, dans un ordre non spécifié; aucun si la requête ne contient aucun mot.
+ */
+
+vector<const Produit*> Catalogue::rechercherProduits(const string& p_requete, OperateurRecherche p_operateur) const
+{
+    return indexTexte().rechercher(p_requete, p_operateur);
+}
+
+/**
+ * \brief Retourne les produits dont la description ressemble le plus à un texte saisi.
+ *
+ *        Chaque mot du texte peut contenir une faute de frappe (deux au-delà de sept
+ *        lettres), et le dernier peut être incomplet : « chemse l » trouve « Chemise lin ».
+ *        Les candidats sont tirés de l'index des trigrammes des mots, puis classés par
+ *        distance d'édition; la recherche passe par l'index des mots, construit au premier
+ *        appel, et est assez rapide pour suivre la frappe.
+ *
+ * \param[in] p_texte Texte saisi.
+ * \param[in] p_nombre Nombre maximal de produits retournés.
+ * \return Au plus p_nombre produits, du plus proche au moins proche, sans copie.
+ */
+vector<const Produit*> Catalogue::rechercherApprox(const string& p_texte, size_t p_nombre) const
+{
+    return indexTexte().rechercherApprox(p_texte, p_nombre);
+}
+
+/**
+ * \brief Construit l'index des prix et l'index des mots s'ils n'existent pas encore.
+ *
+ *        Les requêtes les construisent sinon au premier appel; les construire d'avance
+ *        évite ce délai à la première recherche. Les index sont ensuite tenus à jour et
+ *        partagés avec les copies du catalogue, comme s'ils avaient été construits par une requête.
+ */
+void Catalogue::construireIndex() const
+{
+    indexPrix();
+    indexTexte();
+}
+
+/**
+ * \brief Retourne les produits dont les attributs satisfont un filtre.
+ *
+ *        Le filtre est appliqué bloc par bloc aux bitmaps d'attributs, tenus à jour à
+ *        chaque modification : ni le type ni les attributs d'aucun produit ne sont lus.
+ *        Les produits sont retournés sans copie; les pointeurs restent valides tant que
+ *        le catalogue n'est pas modifié.
+ *
+ * \param[in] p_filtre Critères, par exemple FiltreAttributs().taille("XL").couleur("Noir").
+ * \return Les produits, dans l'ordre du catalogue.
+ */
+vector<const Produit*> Catalogue::filtrerProduits(const FiltreAttributs& p_filtre) const
+{
+    vector<const Produit*> produits;
+    vector<size_t> rangs;
+    for (const auto& bloc : m_blocs) {
+        rangs.clear();
+        bloc->attributs.selectionner(p_filtre, rangs);
+        for (size_t rang : rangs) {
+            produits.push_back(bloc->produits[rang].get());
+        }
+    }
+    return produits;
+}
+
+/**
+ * \brief Retourne le nombre de produits dont les attributs satisfont un filtre.
+ *
+ *        Comme filtrerProduits(), sans énumérer les produits : les bitmaps résultants
+ *        sont seulement comptés.
+ *
+ * \param[in] p_filtre Critères du filtre.
+ * \return Le nombre de produits retenus.
+ */
+size_t Catalogue::compterProduits(const FiltreAttributs& p_filtre) const
+{
+    size_t nombre = 0;
+    for (const auto& bloc : m_blocs) {
+        nombre += bloc->attributs.compter(p_filtre);
+    }
+    return nombre;
+}
+
+/**
+ * \brief Retourne les produits qui répondent à une requête composée.
+ *
+ *        Le plan est choisi par planifierRequete() :
+ *        - avec un index (INDEX_TEXTE ou INDEX_PRIX), chaque candidat est situé par
+ *          l'index des codes, puis son prix est lu dans la colonne de son bloc et ses
+ *          attributs dans le bitmap du filtre, calculé une fois par bloc visité ;
+ *        - sinon (PARCOURS_BLOCS), le bitmap des attributs de chaque bloc est intersecté
+ *          avec un bitmap tiré de la colonne des prix, et seuls les rangs restants sont
+ *          confrontés aux résultats de la recherche par mots, s'il y en a.
+ *        Quand l'ordre du plan est celui demandé (aucun tri, ou le tri par prix d'un plan
+ *        INDEX_PRIX), l'exécution s'arrête dès que la limite est atteinte; sinon, seuls
+ *        les meilleurs produits, jusqu'à la limite, sont gardés puis triés.
+ *
+ *        Les produits sont retournés sans copie; les pointeurs restent valides tant que
+ *        le catalogue n'est pas modifié.
+ *
+ * \param[in] p_requete Critères, ordre et limite.
+ * \return Au plus p_requete.reqLimite() produits, dans l'ordre demandé.
+ */
+vector<const Produit*> Catalogue::executerRequete(const RequeteCatalogue& p_requete) const
+{
+    using Plan = RequeteCatalogue::Plan;
+    using Tri = RequeteCatalogue::Tri;
+
+    const bool filtrePrix = p_requete.filtrePrix();
+    const double prixMin = p_requete.reqPrixMin();
+    const double prixMax = p_requete.reqPrixMax();
+    const FiltreAttributs& filtre = p_requete.reqAttributs();
+    const size_t limite = p_requete.reqLimite();
+    if (limite == 0 || (filtrePrix && prixMin > prixMax)) {
+        return {};
+    }
+
+    vector<const Produit*> parTexte;
+    if (p_requete.filtreTexte()) {
+        parTexte = indexTexte().rechercher(p_requete.reqTexte(), OperateurRecherche::ET);
+        if (!is_sorted(parTexte.begin(), parTexte.end())) {
+            sort(parTexte.begin(), parTexte.end());
+        }
+    }
+    const Plan plan = choisirPlan(p_requete, parTexte.size());
+    const bool triParPrix = p_requete.reqTri() == Tri::PRIX_CROISSANT || p_requete.reqTri() == Tri::PRIX_DECROISSANT;
+    Selection selection(p_requete.reqTri(), limite,
+                        p_requete.reqTri() == Tri::AUCUN || (plan == Plan::INDEX_PRIX && triParPrix));
+
+    if (plan == Plan::PARCOURS_BLOCS) {
+        vector<size_t> rangs;
+        for (size_t numBloc = 0; numBloc < m_blocs.size() && !selection.estComplete(); ++numBloc) {
+            const Bloc& bloc = *m_blocs[numBloc];
+            IndexAttributs::Bitmap retenus = bloc.attributs.bitmap(filtre);
+            if (filtrePrix) {
+                IndexAttributs::Bitmap prix = masquePrix(bloc.prix, prixMin, prixMax);
+                for (size_t i = 0; i < retenus.size(); ++i) {
+                    retenus[i] &= prix[i];
+                }
+            }
+            rangs.clear();
+            IndexAttributs::ajouterRangs(retenus, rangs);
+            for (size_t i = 0; i < rangs.size() && !selection.estComplete(); ++i) {
+                const shared_ptr<Produit>& produit = bloc.produits[rangs[i]];
+                if (!p_requete.filtreTexte() || binary_search(parTexte.begin(), parTexte.end(), produit.get())) {
+                    selection.retenir(bloc.prix[rangs[i]], bloc.codes[rangs[i]], produit);
+                }
+            }
+        }
+    }
+    else {
+        vector<const Produit*> candidats;
+        if (plan == Plan::INDEX_TEXTE) {
+            candidats.swap(parTexte);
+        }
+        else {
+            candidats = indexPrix().dansIntervalle(prixMin, prixMax);
+            if (p_requete.reqTri() == Tri::PRIX_DECROISSANT) {
+                reverse(candidats.begin(), candidats.end());
+            }
+        }
+
+        const bool verifierTexte = plan == Plan::INDEX_PRIX && p_requete.filtreTexte();
+        vector<IndexAttributs::Bitmap> retenusParBloc;
+        vector<char> blocVisite;
+        if (!filtre.estVide()) {
+            retenusParBloc.resize(m_blocs.size());
+            blocVisite.resize(m_blocs.size(), false);
+        }
+        for (const Produit* produit : candidats) {
+            if (selection.estComplete()) {
+                break;
+            }
+            if (verifierTexte && !binary_search(parTexte.begin(), parTexte.end(), produit)) {
+                continue;
+            }
+            CodeProduit code = produit->reqCodeProduit();
+            size_t position = 0;
+            if (!chercherPosition(code, position)) {
+                continue;
+            }
+            size_t numBloc = position / TAILLE_BLOC;
+            size_t rang = position % TAILLE_BLOC;
+            const Bloc& bloc = *m_blocs[numBloc];
+            double prix = bloc.prix[rang];
+            if (filtrePrix && (prix < prixMin || prix > prixMax)) {
+                continue;
+            }
+            if (!filtre.estVide()) {
+                if (!blocVisite[numBloc]) {
+                    retenusParBloc[numBloc] = bloc.attributs.bitmap(filtre);
+                    blocVisite[numBloc] = true;
+                }
+                if (!IndexAttributs::contient(retenusParBloc[numBloc], rang)) {
+                    continue;
+                }
+            }
+            selection.retenir(prix, code, bloc.produits[rang]);
+        }
+    }
+    return selection.produits();
+}
+
+/**
+ * \brief Retourne le plan que executerRequete() suivrait pour une requête.
+ *
+ *        Un index fournit les candidats s'il en donne au plus un produit sur
+ *        SELECTIVITE_INDEX, et moins que tout autre index disponible; sinon, les blocs
+ *        sont parcourus. Le nombre de candidats de l'index des mots est exact : la
+ *        recherche est faite dès qu'une requête porte sur des mots. Celui de l'index des
+ *        prix est estimé, et n'est considéré que si l'index a déjà été construit : pour une
+ *        seule requête, parcourir la colonne des prix coûte moins cher que de le construire.
+ *
+ * \param[in] p_requete Requête à planifier.
+ * \return Le plan choisi.
+ */
+RequeteCatalogue::Plan Catalogue::planifierRequete(const RequeteCatalogue& p_requete) const
+{
+    size_t nbParTexte = 0;
+    if (p_requete.filtreTexte()) {
+        nbParTexte = indexTexte().rechercher(p_requete.reqTexte(), OperateurRecherche::ET).size();
+    }
+    return choisirPlan(p_requete, nbParTexte);
+}
+
+ /**
+   * \brief Retourne une version textuelle formatée du catalogue.
+   *
+   *        Cette représentation inclut :
+   *        - le nom du catalogue ;
+   *        - la date de dernière mise à jour ;
+   *        - la liste des produits avec leur propre formatage.
+   *
+   *        Le texte est celui que produit formater().
+   *
+   * \return Une chaîne contenant la représentation formatée.
+   */    
+    
+std::string Catalogue::reqCatalogueFormate() const{
+    TamponTexte tampon;
+    formater(tampon);
+    return tampon.prendreTexte();
+}
+
+/**
+   * \brief Écrit la version textuelle formatée du catalogue dans un flux.
+   *
+   *        Le texte est composé par blocs d'environ 64 Kio dans un util::TamponTexte,
+   *        puis chaque bloc est écrit d'un seul coup dans le flux : la mémoire utilisée
+   *        ne dépend pas de la taille du catalogue et le flux n'est jamais vidé.
+   *
+   * \param[out] p_os flux qui reçoit le texte
+   */
+
+void Catalogue::formater(std::ostream& p_os) const{
+    const size_t TAILLE_ECRITURE = 64 * 1024;
+    TamponTexte tampon(TAILLE_ECRITURE + 1024);
+    ecrireEntete(tampon);
+    for (size_t numBloc = 0; numBloc < m_blocs.size(); ++numBloc) {
+        for (size_t rang = 0; rang < m_blocs[numBloc]->produits.size(); ++rang) {
+            ecrireTexteFormate(numBloc, rang, tampon);
+            tampon.ajouter('\n');
+            if (tampon.reqTaille() >= TAILLE_ECRITURE) {
+                p_os.write(tampon.reqTexte().data(), static_cast<streamsize>(tampon.reqTaille()));
+                tampon.vider();
+            }
+        }
+    }
+    p_os.write(tampon.reqTexte().data(), static_cast<streamsize>(tampon.reqTaille()));
+}
+
+/**
+   * \brief Ajoute la version textuelle formatée du catalogue à un tampon.
+   *
+   *        Écrit le nom du catalogue, la date de dernière mise à jour, puis chaque
+   *        produit (voir Produit::ecrireFormate()) suivi d'une ligne vide. Seuls les
+   *        produits absents du cache des textes formatés sont formatés. Le tampon
+   *        peut être réutilisé d'un appel à l'autre (après util::TamponTexte::vider())
+   *        pour éviter toute nouvelle allocation.
+   *
+   * \param[out] p_tampon tampon qui reçoit le texte
+   */
+
+void Catalogue::formater(util::TamponTexte& p_tampon) const{
+    ecrireEntete(p_tampon);
+    for (size_t numBloc = 0; numBloc < m_blocs.size(); ++numBloc) {
+        for (size_t rang = 0; rang < m_blocs[numBloc]->produits.size(); ++rang) {
+            ecrireTexteFormate(numBloc, rang, p_tampon);
+            p_tampon.ajouter('\n');
+        }
+    }
+}
+
+/**
+   * \brief Libère le cache des textes formatés des produits.
+   *
+   *        Le prochain formatage du catalogue formatera de nouveau chaque produit.
+   *        Utile pour rendre la mémoire d'un grand catalogue qui ne sera plus affiché.
+   *        Les blocs partagés avec une copie gardent leurs textes pour cette copie.
+   */
+
+void Catalogue::viderCacheFormate(){
+    for (auto& bloc : m_blocs) {
+        if (bloc.use_count() > 1) {
+            auto vide = make_shared<Bloc>();
+            vide->produits = bloc->produits;
+            vide->prix = bloc->prix;
+            vide->codes = bloc->codes;
+            vide->attributs = bloc->attributs;
+            vide->textes.resize(vide->produits.size());
+            bloc = std::move(vide);
+            continue;
+        }
+        for (auto& texte : bloc->textes) {
+            texte = std::string();
+        }
+    }
+}
+
+/**
+   * \brief Ajoute l'en-tête du catalogue (nom et date de dernière mise à jour) à un tampon.
+   *
+   * \param[out] p_tampon tampon qui reçoit le texte
+   */
+
+void Catalogue::ecrireEntete(util::TamponTexte& p_tampon) const{
+    p_tampon.ajouter("Catalogue ").ajouter(m_nom).ajouter('\n');
+    p_tampon.ajouter("Dernière mise a jour : ").ajouterDate(m_dateDerniereMiseAJour).ajouter('\n');
+}
+
+/**
+   * \brief Ajoute à un tampon le texte formaté d'un produit.
+   *
+   *        Le texte est lu dans le cache du bloc; un texte vide signifie que le produit a
+   *        été ajouté ou modifié depuis son dernier formatage : il est alors formaté et,
+   *        si le bloc n'est partagé avec aucune copie du catalogue, conservé pour les
+   *        appels suivants.
+   *
+   * \param[in] p_numBloc Numéro du bloc du produit.
+   * \param[in] p_rang Rang du produit dans son bloc.
+   * \param[out] p_tampon tampon qui reçoit le texte de Produit::ecrireFormate(), sans saut de ligne final
+   */
+
+void Catalogue::ecrireTexteFormate(size_t p_numBloc, size_t p_rang, util::TamponTexte& p_tampon) const{
+    Bloc& bloc = *m_blocs[p_numBloc];
+    std::string& texte = bloc.textes[p_rang];
+    if (!texte.empty()) {
+        p_tampon.ajouter(texte);
+        return;
+    }
+
+    size_t debut = p_tampon.reqTaille();
+    bloc.produits[p_rang]->ecrireFormate(p_tampon);
+    if (m_blocs[p_numBloc].use_count() == 1) {
+        texte.assign(p_tampon.reqTexte().substr(debut));
+    }
+}
+
+/**
+ * \brief Vérifie si un produit avec un code donné est déjà présent dans le catalogue.
+ *
+ *        Consulte l'index des codes, ce qui évite de parcourir la
+ *        collection de produits.
+ *
+ * \param[in] p_codeProduit Code du produit à rechercher.
+ *
+ * \return true si un produit du catalogue possède ce code, false sinon.
+ */
+
+bool Catalogue::produitEstDejaPresent(const util::CodeProduit& p_codeProduit) const
+{
+    size_t position = 0;
+    return chercherPosition(p_codeProduit, position);
+}
+
+/**
+ * \brief Cherche la position d'un produit dans la liste à partir de son code.
+ *
+ * \param[in] p_codeProduit Code du produit recherché.
+ * \param[out] p_position Position du produit, si le code est présent.
+ * \return true si un produit du catalogue possède ce code, false sinon.
+ */
+
+bool Catalogue::chercherPosition(const util::CodeProduit& p_codeProduit, size_t& p_position) const
+{
+    if (m_sousIndex.empty()) {
+        return false;  // catalogue dont le contenu a été déplacé
+    }
+    const shared_ptr<SousIndex>& table = sousIndex(p_codeProduit);
+    if (!table) {
+        return false;
+    }
+    auto entree = table->find(p_codeProduit);
+    if (entree == table->end()) {
+        return false;
+    }
+    p_position = entree->second;
+    return true;
+}
+
+/**
+ * \brief Retourne le sous-index qui contient un code (nul tant qu'il est vide).
+ */
+
+const shared_ptr<Catalogue::SousIndex>& Catalogue::sousIndex(const util::CodeProduit& p_codeProduit) const
+{
+    return m_sousIndex[numeroSousIndex(p_codeProduit, m_sousIndex.size())];
+}
+
+/**
+ * \brief Retourne, pour le modifier, le sous-index qui contient un code.
+ *
+ *        Le sous-index est créé s'il n'existe pas encore, et dupliqué s'il est
+ *        partagé avec une copie du catalogue.
+ */
+
+shared_ptr<Catalogue::SousIndex>& Catalogue::sousIndex(const util::CodeProduit& p_codeProduit)
+{
+    shared_ptr<SousIndex>& table = m_sousIndex[numeroSousIndex(p_codeProduit, m_sousIndex.size())];
+    if (!table) {
+        table = make_shared<SousIndex>();
+    }
+    else if (table.use_count() > 1) {
+        table = make_shared<SousIndex>(*table);
+    }
+    return table;
+}
+
+/**
+ * \brief Associe un code à une position dans l'index des codes.
+ */
+
+void Catalogue::indexer(const util::CodeProduit& p_codeProduit, size_t p_position)
+{
+    (*sousIndex(p_codeProduit))[p_codeProduit] = p_position;
+}
+
+/**
+ * \brief Retire un code de l'index des codes.
+ */
+
+void Catalogue::desindexer(const util::CodeProduit& p_codeProduit)
+{
+    sousIndex(p_codeProduit)->erase(p_codeProduit);
+}
+
+/**
+ * \brief Répartit l'index des codes sur un nouveau nombre de sous-index.
+ *
+ *        Toutes les entrées sont recopiées dans de nouveaux sous-index, qui ne sont
+ *        partagés avec aucune copie. Comme le nombre de sous-index double à chaque
+ *        répartition, leur coût reste proportionnel au nombre de produits ajoutés.
+ *
+ * \param[in] p_nbSousIndex Nouveau nombre de sous-index, une puissance de 2.
+ */
+
+void Catalogue::repartirIndex(size_t p_nbSousIndex)
+{
+    vector<shared_ptr<SousIndex>> nouveaux(p_nbSousIndex);
+    size_t parSousIndex = max(m_nbProduits, p_nbSousIndex * TAILLE_SOUS_INDEX / 2) / p_nbSousIndex + 1;
+    for (auto& table : nouveaux) {
+        table = make_shared<SousIndex>();
+        table->reserve(parSousIndex);
+    }
+    for (const auto& table : m_sousIndex) {
+        if (table) {
+            for (const auto& entree : *table) {
+                nouveaux[numeroSousIndex(entree.first, p_nbSousIndex)]->emplace(entree);
+            }
+        }
+    }
+    m_sousIndex = std::move(nouveaux);
+}
+
+/**
+ * \brief Retourne, pour le modifier, un bloc de produits.
+ *
+ *        Un bloc partagé avec une copie du catalogue est d'abord dupliqué : seuls ses
+ *        pointeurs et ses textes sont recopiés, les produits restent partagés.
+ *
+ * \param[in] p_numBloc Numéro du bloc.
+ * \return Le bloc, qui n'appartient plus qu'à ce catalogue.
+ */
+
+Catalogue::Bloc& Catalogue::blocModifiable(size_t p_numBloc)
+{
+    shared_ptr<Bloc>& bloc = m_blocs[p_numBloc];
+    if (bloc.use_count() > 1) {
+        bloc = make_shared<Bloc>(*bloc);
+    }
+    return *bloc;
+}
+
+/**
+ * \brief Retourne l'index des prix, après l'avoir construit s'il n'existe pas encore.
+ *
+ *        L'index est construit à partir des colonnes de prix et de codes des blocs.
+ *        Il est partagé avec les copies du catalogue faites ensuite.
+ */
+
+const IndexPrix& Catalogue::indexPrix() const
+{
+    if (!m_indexPrix) {
+        vector<IndexPrix::Entree> entrees;
+        entrees.reserve(m_nbProduits);
+        for (const auto& bloc : m_blocs) {
+            for (size_t rang = 0; rang < bloc->produits.size(); ++rang) {
+                entrees.push_back({bloc->prix[rang], bloc->codes[rang], bloc->produits[rang].get()});
+            }
+        }
+        m_indexPrix = make_shared<IndexPrix>(std::move(entrees));
+    }
+    return *m_indexPrix;
+}
+
+/**
+ * \brief Retourne, pour le modifier, l'index des prix s'il a été construit.
+ *
+ *        Un index partagé avec une copie du catalogue est d'abord dupliqué.
+ *
+ * \return L'index, ou nullptr s'il n'a pas encore été construit : il n'y a alors
+ *         rien à tenir à jour.
+ */
+
+IndexPrix* Catalogue::indexPrixModifiable()
+{
+    if (m_indexPrix && m_indexPrix.use_count() > 1) {
+        m_indexPrix = make_shared<IndexPrix>(*m_indexPrix);
+    }
+    return m_indexPrix.get();
+}
+
+/**
+ * \brief Retourne l'index des mots des descriptions, après l'avoir construit s'il n'existe pas encore.
+ *
+ *        Comme l'index des prix, il est partagé avec les copies du catalogue faites ensuite.
+ */
+
+const IndexTexte& Catalogue::indexTexte() const
+{
+    if (!m_indexTexte) {
+        vector<const Produit*> produits;
+        produits.reserve(m_nbProduits);
+        for (const auto& bloc : m_blocs) {
+            for (const auto& produit : bloc->produits) {
+                produits.push_back(produit.get());
+            }
+        }
+        m_indexTexte = make_shared<IndexTexte>(produits);
+    }
+    return *m_indexTexte;
+}
+
+/**
+ * \brief Choisit le plan d'une requête, connaissant le nombre de produits qui contiennent ses mots (voir planifierRequete()).
+ */
+
+RequeteCatalogue::Plan Catalogue::choisirPlan(const RequeteCatalogue& p_requete, size_t p_nbParTexte) const
+{
+    RequeteCatalogue::Plan plan = RequeteCatalogue::Plan::PARCOURS_BLOCS;
+    size_t nbCandidats = m_nbProduits / SELECTIVITE_INDEX;
+    if (p_requete.filtreTexte() && p_nbParTexte <= nbCandidats) {
+        plan = RequeteCatalogue::Plan::INDEX_TEXTE;
+        nbCandidats = p_nbParTexte;
+    }
+    if (p_requete.filtrePrix() && m_indexPrix && p_requete.reqPrixMin() <= p_requete.reqPrixMax()) {
+        size_t nbParPrix = m_indexPrix->estimerDansIntervalle(p_requete.reqPrixMin(), p_requete.reqPrixMax());
+        if (nbParPrix < nbCandidats || (nbParPrix == nbCandidats && plan == RequeteCatalogue::Plan::PARCOURS_BLOCS)) {
+            plan = RequeteCatalogue::Plan::INDEX_PRIX;
+        }
+    }
+    return plan;
+}
+
+/**
+ * \brief Retourne, pour le modifier, l'index des mots s'il a été construit (voir indexPrixModifiable()).
+ */
+
+IndexTexte* Catalogue::indexTexteModifiable()
+{
+    if (m_indexTexte && m_indexTexte.use_count() > 1) {
+        m_indexTexte = make_shared<IndexTexte>(*m_indexTexte);
+    }
+    return m_indexTexte.get();
+}
+
+/**
+ * \brief Ajoute un produit aux index de requêtes (prix, mots) qui ont été construits.
+ *
+ * \param[in] p_produit Produit du catalogue, avec son prix et son code actuels.
+ */
+
+void Catalogue::indexerRequetes(const Produit& p_produit)
+{
+    if (IndexPrix* index = indexPrixModifiable()) {
+        index->ajouter({p_produit.reqPrix(), p_produit.reqCodeProduit(), &p_produit});
+    }
+    if (IndexTexte* index = indexTexteModifiable()) {
+        index->ajouter(p_produit);
+    }
+}
+
+/**
+ * \brief Retire des index de requêtes qui ont été construits le produit situé à une position.
+ */
+
+void Catalogue::desindexerRequetes(size_t p_position)
+{
+    const Bloc& bloc = *m_blocs[p_position / TAILLE_BLOC];
+    if (IndexPrix* index = indexPrixModifiable()) {
+        index->retirer(bloc.prix[p_position % TAILLE_BLOC], bloc.codes[p_position % TAILLE_BLOC]);
+    }
+    if (IndexTexte* index = indexTexteModifiable()) {
+        index->retirer(*bloc.produits[p_position % TAILLE_BLOC]);
+    }
+}
+
+/**
+ * \brief Retourne l'arène dans laquelle le catalogue construit ses produits.
+ *
+ *        L'arène est créée au premier produit ajouté ou cloné par ce catalogue.
+ */
+
+ArenaProduits& Catalogue::arena()
+{
+    if (!m_arena) {
+        m_arena = make_shared<ArenaProduits>();
+    }
+    return *m_arena;
+}
+
+/**
+ * \brief Ajoute un produit à la fin de la liste et l'indexe.
+ *
+ *        L'index des codes est d'abord réparti sur deux fois plus de sous-index
+ *        lorsqu'il est plein; le produit est ensuite rangé par rangerEnFin().
+ *
+ * \param[in] p_produit Produit à ajouter; son code ne doit pas déjà être présent.
+ */
+
+void Catalogue::ajouterEnFin(std::shared_ptr<Produit> p_produit)
+{
+    if (m_nbProduits >= m_sousIndex.size() * TAILLE_SOUS_INDEX) {
+        repartirIndex(max<size_t>(1, m_sousIndex.size() * 2));
+    }
+    indexer(p_produit->reqCodeProduit(), m_nbProduits);
+    rangerEnFin(std::move(p_produit));
+}
+
+/**
+ * \brief Range un produit à la fin de la liste, sans l'indexer.
+ *
+ *        Un nouveau bloc est commencé lorsque le dernier est plein.
+ *
+ * \param[in] p_produit Produit à ranger; son code doit déjà être associé à la
+ *            position m_nbProduits dans l'index des codes.
+ */
+
+void Catalogue::rangerEnFin(std::shared_ptr<Produit> p_produit)
+{
+    if (m_nbProduits % TAILLE_BLOC == 0) {
+        m_blocs.push_back(make_shared<Bloc>());
+        if (m_blocs.size() > 1) {
+            m_blocs.back()->produits.reserve(TAILLE_BLOC);
+            m_blocs.back()->prix.reserve(TAILLE_BLOC);
+            m_blocs.back()->codes.reserve(TAILLE_BLOC);
+            m_blocs.back()->textes.reserve(TAILLE_BLOC);
+        }
+    }
+    Bloc& bloc = blocModifiable(m_blocs.size() - 1);
+    bloc.prix.push_back(p_produit->reqPrix());
+    bloc.codes.push_back(p_produit->reqCodeProduit());
+    bloc.attributs.ajouter(*p_produit);
+    indexerRequetes(*p_produit);
+    bloc.produits.push_back(std::move(p_produit));
+    bloc.textes.emplace_back();
+    ++m_nbProduits;
+}
+
+/**
+ * \brief Déplace un produit et son texte formaté d'une position à une autre.
+ *
+ *        Le produit qui occupait la position de destination doit déjà avoir été
+ *        retiré de l'index; la position source est laissée vide.
+ *
+ * \param[in] p_source Position actuelle du produit.
+ * \param[in] p_destination Nouvelle position du produit.
+ */
+
+void Catalogue::deplacerProduit(size_t p_source, size_t p_destination)
+{
+    Bloc& source = blocModifiable(p_source / TAILLE_BLOC);
+    Bloc& destination = blocModifiable(p_destination / TAILLE_BLOC);
+    size_t rangSource = p_source % TAILLE_BLOC;
+    size_t rangDestination = p_destination % TAILLE_BLOC;
+
+    destination.produits[rangDestination] = std::move(source.produits[rangSource]);
+    destination.prix[rangDestination] = source.prix[rangSource];
+    destination.codes[rangDestination] = source.codes[rangSource];
+    destination.textes[rangDestination] = std::move(source.textes[rangSource]);
+    destination.attributs.copier(rangDestination, source.attributs, rangSource);
+    indexer(destination.codes[rangDestination], p_destination);
+}
+
+/**
+ * \brief Raccourcit la liste à un nombre donné de produits.
+ *
+ *        Les produits au-delà doivent déjà avoir été retirés de l'index ou déplacés.
+ *
+ * \param[in] p_nbProduits Nouveau nombre de produits.
+ */
+
+void Catalogue::tronquer(size_t p_nbProduits)
+{
+    m_blocs.resize((p_nbProduits + TAILLE_BLOC - 1) / TAILLE_BLOC);
+    if (p_nbProduits % TAILLE_BLOC != 0) {
+        Bloc& dernier = blocModifiable(m_blocs.size() - 1);
+        dernier.produits.resize(p_nbProduits % TAILLE_BLOC);
+        dernier.prix.resize(p_nbProduits % TAILLE_BLOC);
+        dernier.codes.resize(p_nbProduits % TAILLE_BLOC);
+        dernier.textes.resize(p_nbProduits % TAILLE_BLOC);
+        dernier.attributs.tronquer(p_nbProduits % TAILLE_BLOC);
+    }
+    m_nbProduits = p_nbProduits;
+}
+
+/**
+ * \brief Retire le produit situé à une position donnée et met l'index à jour.
+ *
+ *        En mode ORDONNEE, les produits suivants reculent d'une position, bloc
+ *        par bloc, puis sont réindexés. En mode PERMUTATION, le dernier produit
+ *        est déplacé à la position libérée, puis la liste est raccourcie.
+ *
+ * \param[in] p_position Position du produit à retirer.
+ * \param[in] p_mode Façon de retirer le produit de la liste.
+ */
+
+void Catalogue::retirerProduit(size_t p_position, ModeSuppression p_mode)
+{
+    desindexerRequetes(p_position);
+    desindexer(reqProduit(p_position).reqCodeProduit());
+
+    if (p_mode == ModeSuppression::PERMUTATION) {
+        size_t derniere = m_nbProduits - 1;
+        if (p_position != derniere) {
+            deplacerProduit(derniere, p_position);
+        }
+        tronquer(derniere);
+        return;
+    }
+
+    size_t rang = p_position % TAILLE_BLOC;
+    for (size_t numBloc = p_position / TAILLE_BLOC; numBloc < m_blocs.size(); ++numBloc, rang = 0) {
+        Bloc& bloc = blocModifiable(numBloc);
+        std::move(bloc.produits.begin() + rang + 1, bloc.produits.end(), bloc.produits.begin() + rang);
+        std::copy(bloc.prix.begin() + rang + 1, bloc.prix.end(), bloc.prix.begin() + rang);
+        std::copy(bloc.codes.begin() + rang + 1, bloc.codes.end(), bloc.codes.begin() + rang);
+        std::move(bloc.textes.begin() + rang + 1, bloc.textes.end(), bloc.textes.begin() + rang);
+        bloc.attributs.retirer(rang);
+        if (numBloc + 1 < m_blocs.size()) {
+            Bloc& suivant = blocModifiable(numBloc + 1);
+            bloc.produits.back() = std::move(suivant.produits.front());
+            bloc.prix.back() = suivant.prix.front();
+            bloc.codes.back() = suivant.codes.front();
+            bloc.textes.back() = std::move(suivant.textes.front());
+            bloc.attributs.copier(TAILLE_BLOC - 1, suivant.attributs, 0);
+        }
+    }
+    tronquer(m_nbProduits - 1);
+    for (size_t position = p_position; position < m_nbProduits; ++position) {
+        indexer(m_blocs[position / TAILLE_BLOC]->codes[position % TAILLE_BLOC], position);
+    }
+}
+/**
+ * \brief Indique si la liste est cohérente : nom non vide, nombre de sous-index, blocs
+ *        et colonnes du dernier bloc, et taille de l'index des prix s'il est construit.
+ *
+ *        Ces vérifications ne dépendent pas du nombre de produits.
+ */
+bool Catalogue::listeValide() const
+{
+    return !m_nom.empty()
+           && (m_sousIndex.size() & (m_sousIndex.size() - 1)) == 0
+           && m_blocs.size() == (m_nbProduits + TAILLE_BLOC - 1) / TAILLE_BLOC
+           && (m_blocs.empty()
+               || (m_blocs.back()->produits.size() == (m_nbProduits - 1) % TAILLE_BLOC + 1
+                   && m_blocs.back()->textes.size() == m_blocs.back()->produits.size()
+                   && m_blocs.back()->prix.size() == m_blocs.back()->produits.size()
+                   && m_blocs.back()->codes.size() == m_blocs.back()->produits.size()
+                   && m_blocs.back()->attributs.reqNombreProduits() == m_blocs.back()->produits.size()))
+           && (!m_indexPrix || m_indexPrix->reqNombreProduits() == m_nbProduits);
+}
+
+/**
+ * \brief Indique si les invariants tiennent pour le produit qui vient d'être ajouté,
+ *        déplacé ou modifié à une position : la liste est cohérente, et le sous-index
+ *        de son code associe ce code à cette position.
+ *
+ *        ajouterProduit(), supprimerProduit() et asgPrixProduit() se contentent de cette
+ *        vérification : totaliser les entrées de tous les sous-index après chaque
+ *        modification rendrait leur coût proportionnel au nombre de produits.
+ */
+bool Catalogue::produitIndexeValide(size_t p_position) const
+{
+    size_t position = 0;
+    return listeValide() && p_position < m_nbProduits
+           && chercherPosition(m_blocs[p_position / TAILLE_BLOC]->codes[p_position % TAILLE_BLOC], position)
+           && position == p_position;
+}
+
+ /**
+   * \brief Vérifie les invariants de la classe Catalogue.
+   *
+   * \invariant !m_nom.empty()
+   * \invariant le nombre de sous-index est une puissance de 2 (ou nul après un déplacement), et ils totalisent m_nbProduits entrées
+   * \invariant le dernier bloc n'est pas vide et les blocs contiennent m_nbProduits produits
+   * \invariant le dernier bloc a un texte formaté (éventuellement vide), un prix, un code et des attributs par produit
+   * \invariant l'index des prix, s'il a été construit, contient une entrée par produit
+   */
+void Catalogue::verifieInvariant() const{
+    INVARIANT(listeValide());
+    size_t nbEntrees = 0;
+    for (const auto& table : m_sousIndex) {
+        nbEntrees += table ? table->size() : 0;
+    }
+    INVARIANT(nbEntrees == m_nbProduits);
 }
 
 } //namespace commerce
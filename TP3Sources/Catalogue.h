@@ -11,9 +11,16 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include "Produit.h"
 #include <memory>
+#include <ostream>
 #include "Date.h"
+#include "CodeProduit.h"
+#include "IndexPrix.h"
+#include "IndexTexte.h"
+#include "IndexAttributs.h"
+#include "RequeteCatalogue.h"
 namespace commerce{
     
 /**
@@ -30,35 +37,188 @@ namespace commerce{
  *
  * La classe Catalogue permet :
  * - de consulter son nom et sa date de dernière mise à jour ;
- * - d’ajouter de nouveaux produits au catalogue, tout en conservant leur comportement polymorphique ;
- * - de produire une représentation textuelle bien formatée de son contenu ;
- * - de dupliquer un catalogue grâce au constructeur de copie (copie profonde des produits).
+ * - d’ajouter de nouveaux produits au catalogue, tout en conservant leur comportement polymorphique,
+ *   soit par clonage, soit en prenant possession d’un produit déjà alloué ;
+ * - de retrouver un produit à partir de son code en temps constant grâce à un index
+ *   code → position maintenu en parallèle de la liste des produits ; les codes y sont
+ *   rangés sous forme compactée (util::CodeProduit), une clé de 8 octets par produit ;
+ * - de retirer des produits un par un ou par lot, soit en conservant l’ordre d’insertion,
+ *   soit en temps constant par permutation avec le dernier produit ;
+ * - de produire une représentation textuelle bien formatée de son contenu, sous forme de
+ *   chaîne, dans un flux ou dans un util::TamponTexte réutilisable (formater()) ; le texte
+ *   de chaque produit est conservé en cache, si bien qu’après une modification seuls les
+ *   produits ajoutés ou changés sont formatés de nouveau ;
+ * - de modifier le prix d’un produit du catalogue (asgPrixProduit()) ;
+ * - de calculer la valeur totale du catalogue ou de trouver les produits d’une fourchette
+ *   de prix, en parcourant une colonne contiguë de prix plutôt que les produits ;
+ * - d’interroger les produits par prix (produitsDansIntervallePrix(), moinsChers(),
+ *   plusChers()) grâce à un index trié par prix (IndexPrix), construit à la première
+ *   requête puis tenu à jour à chaque ajout, suppression ou changement de prix ;
+ * - de rechercher des produits par mots de leur description (rechercherProduits()),
+ *   sans tenir compte des majuscules ni des accents, grâce à un index inversé
+ *   (IndexTexte) construit et tenu à jour de la même façon, ou de retrouver les produits
+ *   les plus proches d’un texte saisi avec des fautes de frappe (rechercherApprox()) ;
+ *   construireIndex() construit d’avance ces deux index, par exemple dans le fil qui
+ *   charge le catalogue, pour que la première requête n’en paie pas le coût ;
+ * - de filtrer les vêtements par taille et couleur, et les produits électroniques par
+ *   reconditionnement et durée de garantie (filtrerProduits(), compterProduits()), sans
+ *   examiner le type d’aucun produit, grâce aux bitmaps d’attributs de chaque bloc ;
+ * - d’exécuter une requête qui combine mots, intervalle de prix et attributs, triée par
+ *   prix ou par description et limitée à quelques produits (executerRequete()) : le
+ *   critère le plus sélectif parmi les index disponibles fournit les candidats, et les
+ *   autres critères sont vérifiés sur les colonnes et les bitmaps des blocs ;
+ * - de dupliquer un catalogue, par exemple pour en garder un instantané, ou de le déplacer
+ *   sans copier aucun produit ; un catalogue déplacé ne peut plus qu’être détruit ou
+ *   recevoir une assignation.
+ *
+ * La copie d’un catalogue se fait par copie sur écriture. Les produits sont rangés par
+ * blocs de TAILLE_BLOC, et l’index des codes est réparti selon le code en sous-index
+ * d’environ TAILLE_SOUS_INDEX entrées, dont le nombre double à mesure que le catalogue
+ * grandit; blocs et sous-index sont partagés entre un catalogue et ses copies.
+ * Une copie ne duplique donc que ces deux tables de pointeurs, quel que soit le nombre
+ * de produits. Une modification ne duplique que le bloc et les sous-index touchés, et
+ * un produit partagé n’est cloné que si son prix change. Comme les produits ne sont
+ * accessibles qu’en lecture, cette copie se comporte exactement comme une copie profonde.
+ *
+ * Les produits ajoutés ou clonés par un catalogue sont construits dans son arène
+ * (ArenaProduits) : ils se suivent en mémoire, et leur bloc de contrôle est logé avec
+ * eux. Une copie ne partage pas l’arène du catalogue copié, elle crée la sienne à son
+ * premier ajout; l’arène est libérée d’un coup quand plus aucun catalogue n’en utilise
+ * les produits. La mémoire d’un produit retiré n’est rendue qu’avec son arène.
  * 
  * Les invariants de cette classe garantissent :
  * - le nom du catalogue n’est jamais vide ;
  * - la date de dernière mise à jour est toujours valide ;
- * - la liste des produits ne contient que des pointeurs valides et non nuls.
+ * - la liste des produits ne contient que des pointeurs valides et non nuls ;
+ * - l’index des codes contient exactement une entrée par produit, associée à sa position ;
+ * - le cache des textes formatés contient exactement une entrée par produit ;
+ * - les colonnes de prix et de codes, et l’index des attributs de chaque bloc, ont
+ *   exactement une entrée par produit.
+ *
+ * Le cache est rempli par les méthodes de formatage, et les index des prix et des mots
+ * construits par les requêtes, qui sont const : deux threads ne doivent pas formater ou
+ * interroger un même catalogue en même temps, ni copier un catalogue pendant qu’un
+ * autre thread le formate ou l’interroge. Les copies déjà faites peuvent, elles, être formatées
+ * en parallèle : le cache d’un bloc partagé n’est jamais modifié.
  */
     
 class Catalogue {
 public:
+    /**
+     * \brief Façon de retirer un produit de la liste.
+     *
+     * - ORDONNEE : les produits suivants sont décalés, l’ordre d’insertion est conservé (O(N)) ;
+     * - PERMUTATION : le dernier produit prend la place du produit retiré (O(1)).
+     */
+    enum class ModeSuppression { ORDONNEE, PERMUTATION };
+    using OperateurRecherche = IndexTexte::Operateur;
+
     Catalogue(const std::string& p_nom, const util::Date& p_dateDerniereMiseAJour);
     Catalogue(const Catalogue& p_catalogue);
+    Catalogue(Catalogue&& p_catalogue) noexcept;
     
     Catalogue& operator=(const Catalogue& p_catalogue);
+    Catalogue& operator=(Catalogue&& p_catalogue) noexcept;
     const std::string& reqNom() const;
     const util::Date& reqDateDerniereMiseAJour() const;
     void asgDerniereMiseAJour(const util::Date& p_date);
     void ajouterProduit (const Produit& p_nouveauProduit);
+    void ajouterProduit (std::unique_ptr<Produit> p_nouveauProduit);
+    void ajouterProduits (std::vector<std::unique_ptr<Produit>> p_nouveauxProduits);
+    void reserver (std::size_t p_nbProduits);
     void supprimerProduit (const std::string& p_codeProduit);
+    void supprimerProduit (const std::string& p_codeProduit, ModeSuppression p_mode);
+    void supprimerProduits (const std::vector<std::string>& p_codesProduits);
+    ModeSuppression reqModeSuppression() const;
+    void asgModeSuppression(ModeSuppression p_mode);
+    const Produit& trouverProduit (const std::string& p_codeProduit) const;
+    const Produit& trouverProduit (const util::CodeProduit& p_codeProduit) const;
+    std::size_t reqNombreProduits() const;
+    const Produit& reqProduit(std::size_t p_position) const;
+    bool contientProduit(const std::string& p_codeProduit) const;
+    std::size_t reqPositionProduit(const std::string& p_codeProduit) const;
+    void asgPrixProduit (const std::string& p_codeProduit, double p_prix);
+    double reqValeurTotale() const;
+    std::vector<std::size_t> trouverPositionsParPrix(double p_prixMin, double p_prixMax) const;
+    std::vector<const Produit*> produitsDansIntervallePrix(double p_prixMin, double p_prixMax) const;
+    std::vector<const Produit*> moinsChers(std::size_t p_nombre) const;
+    std::vector<const Produit*> plusChers(std::size_t p_nombre) const;
+    std::vector<const Produit*> rechercherProduits(const std::string& p_requete) const;
+    std::vector<const Produit*> rechercherProduits(const std::string& p_requete, OperateurRecherche p_operateur) const;
+    std::vector<const Produit*> rechercherApprox(const std::string& p_texte, std::size_t p_nombre) const;
+    void construireIndex() const;
+    std::vector<const Produit*> filtrerProduits(const FiltreAttributs& p_filtre) const;
+    std::size_t compterProduits(const FiltreAttributs& p_filtre) const;
+    std::vector<const Produit*> executerRequete(const RequeteCatalogue& p_requete) const;
+    RequeteCatalogue::Plan planifierRequete(const RequeteCatalogue& p_requete) const;
     
     std::string reqCatalogueFormate() const;
+    void formater(std::ostream& p_os) const;
+    void formater(util::TamponTexte& p_tampon) const;
+    void viderCacheFormate();
 private:
+    static constexpr std::size_t TAILLE_BLOC = 1024;
+    static constexpr std::size_t TAILLE_SOUS_INDEX = 4096;
+    static constexpr std::size_t SELECTIVITE_INDEX = 64;
+
+    /**
+     * \brief Tranche d’au plus TAILLE_BLOC produits consécutifs, avec leurs textes formatés.
+     *
+     * Le prix et le code de chaque produit sont aussi rangés en colonnes contiguës,
+     * parallèles à produits : les parcours qui ne lisent que ces champs (valeur totale,
+     * filtre par prix, réindexation) ne suivent aucun pointeur vers un produit. De même,
+     * les attributs propres aux vêtements et aux produits électroniques sont indexés
+     * par rang dans des bitmaps (IndexAttributs).
+     *
+     * Tous les blocs sont pleins, sauf le dernier. Un bloc partagé avec une copie du
+     * catalogue est dupliqué avant d’être modifié (voir blocModifiable()).
+     */
+    struct Bloc
+    {
+        std::vector<std::shared_ptr<Produit>> produits;
+        std::vector<double> prix;
+        std::vector<util::CodeProduit> codes;
+        std::vector<std::string> textes;
+        IndexAttributs attributs;
+    };
+    static_assert(TAILLE_BLOC <= IndexAttributs::CAPACITE, "un bloc doit tenir dans les bitmaps de son index d’attributs");
+    using SousIndex = std::unordered_map<util::CodeProduit, std::size_t>;
+
     std::string m_nom;
     util::Date m_dateDerniereMiseAJour;
-    std::vector<std::unique_ptr<Produit>> m_produits;
+    std::size_t m_nbProduits;
+    std::vector<std::shared_ptr<Bloc>> m_blocs;
+    std::vector<std::shared_ptr<SousIndex>> m_sousIndex;
+    std::shared_ptr<ArenaProduits> m_arena;
+    mutable std::shared_ptr<IndexPrix> m_indexPrix;
+    mutable std::shared_ptr<IndexTexte> m_indexTexte;
+    ModeSuppression m_modeSuppression;
     
-    bool produitEstDejaPresent(const std::string& p_codeProduit) const;
+    bool produitEstDejaPresent(const util::CodeProduit& p_codeProduit) const;
+    bool chercherPosition(const util::CodeProduit& p_codeProduit, std::size_t& p_position) const;
+    std::shared_ptr<SousIndex>& sousIndex(const util::CodeProduit& p_codeProduit);
+    const std::shared_ptr<SousIndex>& sousIndex(const util::CodeProduit& p_codeProduit) const;
+    void indexer(const util::CodeProduit& p_codeProduit, std::size_t p_position);
+    void desindexer(const util::CodeProduit& p_codeProduit);
+    void repartirIndex(std::size_t p_nbSousIndex);
+    const IndexPrix& indexPrix() const;
+    IndexPrix* indexPrixModifiable();
+    const IndexTexte& indexTexte() const;
+    IndexTexte* indexTexteModifiable();
+    RequeteCatalogue::Plan choisirPlan(const RequeteCatalogue& p_requete, std::size_t p_nbParTexte) const;
+    void indexerRequetes(const Produit& p_produit);
+    void desindexerRequetes(std::size_t p_position);
+    ArenaProduits& arena();
+    Bloc& blocModifiable(std::size_t p_numBloc);
+    void ajouterEnFin(std::shared_ptr<Produit> p_produit);
+    void rangerEnFin(std::shared_ptr<Produit> p_produit);
+    void deplacerProduit(std::size_t p_source, std::size_t p_destination);
+    void tronquer(std::size_t p_nbProduits);
+    void retirerProduit(std::size_t p_position, ModeSuppression p_mode);
+    void ecrireEntete(util::TamponTexte& p_tampon) const;
+    void ecrireTexteFormate(std::size_t p_numBloc, std::size_t p_rang, util::TamponTexte& p_tampon) const;
+    bool listeValide() const;
+    bool produitIndexeValide(std::size_t p_position) const;
     void verifieInvariant() const;
     
 
@@ -0,0 +1,686 @@
+/**
+ * \file ChargementCatalogue.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation du chargement d’un catalogue à partir de sa représentation texte.
+ *
+ * Le fichier est projeté en mémoire puis découpé en lignes et en champs à l’aide de
+ * std::string_view : aucune chaîne intermédiaire n’est créée avant la construction
+ * des produits. Les nombres sont lus avec std::from_chars, indépendamment de la locale.
+ * La section des produits peut aussi être analysée par tronçons sur plusieurs fils,
+ * ou validée champ par champ en même temps que le catalogue est construit. Le chargement
+ * séquentiel peut enfin publier sa progression et être annulé depuis un autre fil.
+ */
+
+#include "ChargementCatalogue.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "Date.h"
+#include "FichierMappe.h"
+#include "validationFormat.h"
+#include "ProduitException.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace commerce {
+
+namespace {
+
+/**
+ * \brief Retire les espaces et tabulations en début et en fin de vue.
+ */
+string_view rogner(string_view p_texte)
+{
+    size_t debut = p_texte.find_first_not_of(" \t");
+    if (debut == string_view::npos) {
+        return string_view();
+    }
+    size_t fin = p_texte.find_last_not_of(" \t");
+    return p_texte.substr(debut, fin - debut + 1);
+}
+
+/**
+ * \brief Extrait la prochaine ligne du texte, sans son '\n' ni un éventuel '\r' final.
+ * \param[in,out] p_reste texte restant à lire, avancé après la ligne extraite.
+ */
+string_view prochaineLigne(string_view& p_reste)
+{
+    size_t fin = p_reste.find('\n');
+    string_view ligne = p_reste.substr(0, fin);
+    p_reste.remove_prefix(fin == string_view::npos ? p_reste.size() : fin + 1);
+    if (!ligne.empty() && ligne.back() == '\r') {
+        ligne.remove_suffix(1);
+    }
+    return ligne;
+}
+
+/**
+ * \brief Extrait le prochain champ d’une ligne CSV.
+ * \param[in,out] p_reste reste de la ligne, avancé après la virgule qui suit le champ.
+ */
+string_view prochainChamp(string_view& p_reste)
+{
+    size_t fin = p_reste.find(',');
+    string_view champ = p_reste.substr(0, fin);
+    p_reste.remove_prefix(fin == string_view::npos ? p_reste.size() : fin + 1);
+    return champ;
+}
+
+/**
+ * \brief Lit un nombre (entier ou réel) occupant tout le champ.
+ * \return true si le champ contient exactement un nombre valide.
+ */
+template <typename T>
+bool lireNombre(string_view p_champ, T& p_valeur)
+{
+    p_champ = rogner(p_champ);
+    const char* fin = p_champ.data() + p_champ.size();
+    auto resultat = from_chars(p_champ.data(), fin, p_valeur);
+    return resultat.ec == errc() && resultat.ptr == fin;
+}
+
+/**
+ * \brief Lit un prix : un nombre fini et positif ou nul occupant tout le champ.
+ * \return true si le champ contient un prix valide; from_chars accepte aussi « nan »,
+ *         « inf » et les nombres négatifs, qui sont refusés ici.
+ */
+bool lirePrix(string_view p_champ, double& p_prix)
+{
+    return lireNombre(p_champ, p_prix) && isfinite(p_prix) && p_prix >= 0;
+}
+
+ChargementCatalogueException erreurLigne(size_t p_numLigne, const string& p_raison)
+{
+    return ChargementCatalogueException("Ligne " + to_string(p_numLigne) + " : " + p_raison);
+}
+
+/**
+ * \brief Erreur de format détectée dans une ligne de produit.
+ *
+ * Le numéro de ligne est ajouté par l’appelant, qui est seul à le connaître
+ * lorsque l’analyse se fait par tronçons.
+ */
+struct LigneInvalide
+{
+    const char* raison;
+};
+
+/**
+ * \brief Construit le produit décrit par une ligne du fichier.
+ * \return Le produit construit, ou nullptr si le type de produit est inconnu.
+ * \exception LigneInvalide si la description est vide, si le prix, la garantie, la taille
+ *            ou le code est invalide : la ligne est vérifiée ici plutôt que par les
+ *            préconditions des produits, qui disparaissent lorsque NDEBUG est défini.
+ */
+unique_ptr<Produit> analyserProduit(string_view p_ligne)
+{
+    string_view type = prochainChamp(p_ligne);
+    if (type != "Electronique" && type != "Vetement") {
+        return nullptr;
+    }
+    string_view description = prochainChamp(p_ligne);
+    string_view prixTexte = prochainChamp(p_ligne);
+    string_view code = prochainChamp(p_ligne);
+    string_view champ5 = prochainChamp(p_ligne);
+    string_view champ6 = prochainChamp(p_ligne);
+
+    if (description.empty()) {
+        throw LigneInvalide{"description absente"};
+    }
+    double prix = 0.0;
+    if (!lirePrix(prixTexte, prix)) {
+        throw LigneInvalide{"prix invalide"};
+    }
+    if (!util::validerCodeProduit(code, description, prix)) {
+        throw LigneInvalide{"code produit invalide"};
+    }
+
+    if (type == "Electronique") {
+        int garantie = 0;
+        if (!lireNombre(champ5, garantie) || garantie < 0) {
+            throw LigneInvalide{"garantie invalide"};
+        }
+        return make_unique<Electronique>(string(description), prix, string(code), garantie, champ6 == "1");
+    }
+    string taille(champ5);
+    for (char& c : taille) {
+        c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+    if (!(taille == "XS" || taille == "S" || taille == "M" ||
+          taille == "L" || taille == "XL" || taille == "XXL")) {
+        throw LigneInvalide{"taille invalide"};
+    }
+    return make_unique<Vetement>(string(description), prix, string(code), taille, string(champ6));
+}
+
+/**
+ * \brief Lit les deux lignes d’en-tête (nom, puis date) et crée le catalogue vide.
+ * \param[in,out] p_contenu texte du fichier, avancé au début de la première ligne de produit.
+ * \exception ChargementCatalogueException si le nom est absent ou la date invalide.
+ */
+Catalogue analyserEntete(string_view& p_contenu)
+{
+    string_view nomCatalogue = prochaineLigne(p_contenu);
+    if (nomCatalogue.empty()) {
+        throw erreurLigne(1, "nom du catalogue absent");
+    }
+
+    // Lecture de la date (jour mois annee)
+    string_view ligneDate = prochaineLigne(p_contenu);
+    int valeurs[3] = {0, 0, 0};
+    for (int& valeur : valeurs) {
+        ligneDate = ligneDate.substr(min(ligneDate.size(), ligneDate.find_first_not_of(" \t")));
+        auto resultat = from_chars(ligneDate.data(), ligneDate.data() + ligneDate.size(), valeur);
+        if (resultat.ec != errc()) {
+            throw erreurLigne(2, "date invalide");
+        }
+        ligneDate.remove_prefix(resultat.ptr - ligneDate.data());
+    }
+    if (!Date::validerDate(valeurs[0], valeurs[1], valeurs[2])) {
+        throw erreurLigne(2, "date invalide");
+    }
+
+    return Catalogue(string(nomCatalogue), Date(valeurs[0], valeurs[1], valeurs[2]));
+}
+
+/**
+ * \brief Analyse séquentielle commune aux deux versions de chargerCatalogueDepuisTexte().
+ * \param[in] p_suivi suivi à mettre à jour, ou nullptr si personne ne suit le chargement.
+ */
+Catalogue chargerCatalogue(string_view p_contenu, SuiviChargement* p_suivi)
+{
+    const size_t PAS_SUIVI = 64 * 1024;
+    const size_t taille = p_contenu.size();
+    size_t prochainSuivi = 0;
+    if (p_suivi != nullptr) {
+        p_suivi->octetsTotal.store(taille, memory_order_relaxed);
+        p_suivi->octetsLus.store(0, memory_order_relaxed);
+    }
+
+    Catalogue catalogue = analyserEntete(p_contenu);
+
+    // Lecture des produits
+    size_t numLigne = 2;
+    while (!p_contenu.empty()) {
+        if (p_suivi != nullptr && taille - p_contenu.size() >= prochainSuivi) {
+            if (p_suivi->annulationDemandee.load(memory_order_relaxed)) {
+                throw ChargementAnnuleException("Chargement du catalogue annulé");
+            }
+            p_suivi->octetsLus.store(taille - p_contenu.size(), memory_order_relaxed);
+            prochainSuivi = taille - p_contenu.size() + PAS_SUIVI;
+        }
+
+        string_view ligne = prochaineLigne(p_contenu);
+        ++numLigne;
+        if (ligne.empty()) {
+            continue;
+        }
+        try {
+            unique_ptr<Produit> produit = analyserProduit(ligne);
+            if (produit) {
+                catalogue.ajouterProduit(std::move(produit));
+            }
+        }
+        catch (const LigneInvalide& e) {
+            throw erreurLigne(numLigne, e.raison);
+        }
+    }
+
+    if (p_suivi != nullptr) {
+        p_suivi->octetsLus.store(taille, memory_order_relaxed);
+    }
+    return catalogue;
+}
+
+/**
+ * \brief Portion de la section des produits analysée par un seul fil d’exécution.
+ *
+ * L’analyse s’arrête à la première erreur : les produits déjà lus sont conservés
+ * afin que la fusion reproduise exactement le comportement du chargement séquentiel.
+ */
+struct Troncon
+{
+    string_view texte;
+    vector<unique_ptr<Produit>> produits;
+    size_t nbLignes = 0;
+    size_t ligneErreur = 0;
+    const char* raisonErreur = nullptr;
+    exception_ptr exception;
+};
+
+void analyserTroncon(Troncon& p_troncon)
+{
+    string_view reste = p_troncon.texte;
+    try {
+        while (!reste.empty()) {
+            string_view ligne = prochaineLigne(reste);
+            ++p_troncon.nbLignes;
+            if (ligne.empty()) {
+                continue;
+            }
+            unique_ptr<Produit> produit = analyserProduit(ligne);
+            if (produit) {
+                p_troncon.produits.push_back(std::move(produit));
+            }
+        }
+    }
+    catch (const LigneInvalide& e) {
+        p_troncon.ligneErreur = p_troncon.nbLignes;
+        p_troncon.raisonErreur = e.raison;
+    }
+    catch (...) {
+        p_troncon.exception = current_exception();
+    }
+}
+
+/**
+ * \brief Fils d’analyse des tronçons, tous joints à la destruction.
+ *
+ *        Si le lancement d’un fil échoue, ceux qui ont déjà démarré sont joints
+ *        pendant la remontée de l’exception au lieu d’appeler std::terminate().
+ */
+class FilsAnalyse
+{
+public:
+    explicit FilsAnalyse(size_t p_nbFils)
+    {
+        m_fils.reserve(p_nbFils);
+    }
+
+    FilsAnalyse(const FilsAnalyse&) = delete;
+    FilsAnalyse& operator=(const FilsAnalyse&) = delete;
+
+    ~FilsAnalyse()
+    {
+        for (auto& fil : m_fils) {
+            fil.join();
+        }
+    }
+
+    void lancer(Troncon& p_troncon)
+    {
+        m_fils.emplace_back(analyserTroncon, std::ref(p_troncon));
+    }
+
+private:
+    vector<thread> m_fils;
+};
+
+/**
+ * \brief Découpe le texte en tronçons d’environ la même taille, alignés sur les fins de ligne.
+ */
+vector<Troncon> decouperEnTroncons(string_view p_texte, size_t p_nbTroncons)
+{
+    vector<Troncon> troncons;
+    size_t debut = 0;
+    for (size_t i = 1; i <= p_nbTroncons && debut < p_texte.size(); ++i) {
+        size_t fin = p_texte.size();
+        if (i < p_nbTroncons) {
+            fin = p_texte.find('\n', max(debut, p_texte.size() / p_nbTroncons * i));
+            fin = (fin == string_view::npos) ? p_texte.size() : fin + 1;
+        }
+        Troncon troncon;
+        troncon.texte = p_texte.substr(debut, fin - debut);
+        troncons.push_back(std::move(troncon));
+        debut = fin;
+    }
+    return troncons;
+}
+
+} // namespace
+
+/**
+ * \brief Charge un catalogue à partir d’un fichier texte.
+ *
+ *        Le fichier est projeté en mémoire (voir util::FichierMappe) puis analysé
+ *        par chargerCatalogueDepuisTexte().
+ *
+ * \param[in] p_nomFichier nom du fichier catalogue à charger
+ * \return Un objet Catalogue initialisé avec les produits lus
+ *
+ * \exception std::runtime_error Levée si le fichier ne peut pas être ouvert.
+ * \exception ChargementCatalogueException Levée si le contenu est mal formé.
+ * \exception ProduitDejaPresentException Levée si deux produits ont le même code.
+ */
+Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier)
+{
+    FichierMappe fichier(p_nomFichier);
+    return chargerCatalogueDepuisTexte(fichier.reqContenu());
+}
+
+/**
+ * \brief Charge un catalogue à partir de son contenu texte déjà en mémoire.
+ *
+ * \param[in] p_contenu contenu complet du catalogue (en-tête et produits)
+ * \return Un objet Catalogue initialisé avec les produits lus
+ *
+ * \exception ChargementCatalogueException Levée si le contenu est mal formé.
+ * \exception ProduitDejaPresentException Levée si deux produits ont le même code.
+ */
+Catalogue chargerCatalogueDepuisTexte(std::string_view p_contenu)
+{
+    return chargerCatalogue(p_contenu, nullptr);
+}
+
+/**
+ * \brief Charge un catalogue à partir d’un fichier texte en publiant sa progression.
+ *
+ *        Destinée à être appelée sur un fil secondaire : voir chargerCatalogueDepuisTexte()
+ *        avec suivi.
+ *
+ * \param[in] p_nomFichier nom du fichier catalogue à charger
+ * \param[in,out] p_suivi progression publiée et demande d’annulation
+ * \return Un objet Catalogue initialisé avec les produits lus
+ *
+ * \exception std::runtime_error Levée si le fichier ne peut pas être ouvert.
+ * \exception ChargementCatalogueException Levée si le contenu est mal formé.
+ * \exception ProduitDejaPresentException Levée si deux produits ont le même code.
+ * \exception ChargementAnnuleException Levée si l’annulation a été demandée.
+ */
+Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier, SuiviChargement& p_suivi)
+{
+    FichierMappe fichier(p_nomFichier);
+    return chargerCatalogueDepuisTexte(fichier.reqContenu(), p_suivi);
+}
+
+/**
+ * \brief Charge un catalogue à partir de son contenu texte en publiant sa progression.
+ *
+ *        Le résultat est identique à celui de chargerCatalogueDepuisTexte(). La taille
+ *        du contenu est publiée dans p_suivi avant l’analyse, puis le nombre d’octets
+ *        analysés environ tous les 64 Kio; l’annulation est vérifiée à la même fréquence.
+ *
+ * \param[in] p_contenu contenu complet du catalogue (en-tête et produits)
+ * \param[in,out] p_suivi progression publiée et demande d’annulation
+ * \return Un objet Catalogue initialisé avec les produits lus
+ *
+ * \exception ChargementCatalogueException Levée si le contenu est mal formé.
+ * \exception ProduitDejaPresentException Levée si deux produits ont le même code.
+ * \exception ChargementAnnuleException Levée si l’annulation a été demandée.
+ */
+Catalogue chargerCatalogueDepuisTexte(std::string_view p_contenu, SuiviChargement& p_suivi)
+{
+    return chargerCatalogue(p_contenu, &p_suivi);
+}
+
+/**
+ * \brief Charge un catalogue à partir d’un fichier texte en répartissant l’analyse sur plusieurs fils.
+ *
+ *        Le fichier est projeté en mémoire puis analysé par
+ *        chargerCatalogueDepuisTexteEnParallele().
+ *
+ * \param[in] p_nomFichier nom du fichier catalogue à charger
+ * \param[in] p_nbFils nombre de fils d’exécution; 0 pour en choisir un selon la machine
+ * \return Un objet Catalogue identique à celui de chargerCatalogueDepuisFichier()
+ *
+ * \exception std::runtime_error Levée si le fichier ne peut pas être ouvert.
+ * \exception ChargementCatalogueException Levée si le contenu est mal formé.
+ * \exception ProduitDejaPresentException Levée si deux produits ont le même code.
+ */
+Catalogue chargerCatalogueEnParallele(const std::string& p_nomFichier, unsigned int p_nbFils)
+{
+    FichierMappe fichier(p_nomFichier);
+    return chargerCatalogueDepuisTexteEnParallele(fichier.reqContenu(), p_nbFils);
+}
+
+/**
+ * \brief Charge un catalogue à partir de son contenu texte en répartissant l’analyse sur plusieurs fils.
+ *
+ *        Après l’en-tête, la section des produits est découpée en tronçons alignés
+ *        sur les fins de ligne. Chaque tronçon est analysé, et ses produits construits,
+ *        par son propre fil. Les produits sont ensuite ajoutés d’un bloc au catalogue,
+ *        dans l’ordre du fichier, par Catalogue::ajouterProduits(). Le catalogue obtenu,
+ *        tout comme la première erreur signalée, est identique à celui du chargement
+ *        séquentiel.
+ *
+ *        Lorsque le nombre de fils est choisi automatiquement, chaque tronçon compte
+ *        au moins 64 Kio afin que les petits fichiers restent analysés par un seul fil.
+ *
+ * \param[in] p_contenu contenu complet du catalogue (en-tête et produits)
+ * \param[in] p_nbFils nombre de fils d’exécution; 0 pour en choisir un selon la machine
+ * \return Un objet Catalogue identique à celui de chargerCatalogueDepuisTexte()
+ *
+ * \exception ChargementCatalogueException Levée si le contenu est mal formé.
+ * \exception ProduitDejaPresentException Levée si deux produits ont le même code.
+ */
+Catalogue chargerCatalogueDepuisTexteEnParallele(std::string_view p_contenu, unsigned int p_nbFils)
+{
+    Catalogue catalogue = analyserEntete(p_contenu);
+
+    size_t nbTroncons = p_nbFils;
+    if (nbTroncons == 0) {
+        const size_t TAILLE_MIN_TRONCON = 64 * 1024;
+        nbTroncons = max(1u, thread::hardware_concurrency());
+        nbTroncons = max<size_t>(1, min(nbTroncons, p_contenu.size() / TAILLE_MIN_TRONCON));
+    }
+
+    vector<Troncon> troncons = decouperEnTroncons(p_contenu, nbTroncons);
+    if (troncons.empty()) {
+        return catalogue;
+    }
+    {
+        FilsAnalyse fils(troncons.size() - 1);
+        for (size_t i = 1; i < troncons.size(); ++i) {
+            fils.lancer(troncons[i]);
+        }
+        analyserTroncon(troncons[0]);
+    }
+
+    // Seuls les produits qui précèdent la première erreur d’analyse sont ajoutés.
+    size_t dernier = 0;
+    while (dernier + 1 < troncons.size() && troncons[dernier].raisonErreur == nullptr && !troncons[dernier].exception) {
+        ++dernier;
+    }
+    size_t nbProduits = 0;
+    for (size_t i = 0; i <= dernier; ++i) {
+        nbProduits += troncons[i].produits.size();
+    }
+    vector<unique_ptr<Produit>> produits;
+    produits.reserve(nbProduits);
+    size_t premiereLigne = 2;
+    for (size_t i = 0; i <= dernier; ++i) {
+        move(troncons[i].produits.begin(), troncons[i].produits.end(), back_inserter(produits));
+        if (i < dernier) {
+            premiereLigne += troncons[i].nbLignes;
+        }
+    }
+    catalogue.ajouterProduits(std::move(produits));
+
+    if (troncons[dernier].raisonErreur != nullptr) {
+        throw erreurLigne(premiereLigne + troncons[dernier].ligneErreur, troncons[dernier].raisonErreur);
+    }
+    if (troncons[dernier].exception) {
+        rethrow_exception(troncons[dernier].exception);
+    }
+
+    return catalogue;
+}
+
+/**
+ * \brief Valide un fichier catalogue et construit le catalogue en une seule lecture.
+ *
+ *        Le fichier est projeté en mémoire puis traité par
+ *        validerEtChargerCatalogueDepuisTexte().
+ *
+ * \param[in] p_nomFichier nom du fichier catalogue à valider et charger
+ * \return Le catalogue construit, ou la liste des erreurs détectées. Un fichier
+ *         impossible à ouvrir donne une seule erreur, à la ligne 0.
+ */
+ResultatChargement validerEtChargerCatalogueDepuisFichier(const std::string& p_nomFichier)
+{
+    try {
+        FichierMappe fichier(p_nomFichier);
+        return validerEtChargerCatalogueDepuisTexte(fichier.reqContenu());
+    }
+    catch (const runtime_error& e) {
+        ResultatChargement resultat;
+        resultat.erreurs.push_back({0, "fichier", e.what()});
+        return resultat;
+    }
+}
+
+/**
+ * \brief Valide un catalogue lu d’un flux et le construit en une seule lecture.
+ *
+ *        Le flux est lu en entier puis traité par validerEtChargerCatalogueDepuisTexte().
+ *
+ * \param[in] p_is flux contenant le catalogue
+ * \return Le catalogue construit, ou la liste des erreurs détectées.
+ */
+ResultatChargement validerEtChargerCatalogue(std::istream& p_is)
+{
+    if (!p_is.good()) {
+        ResultatChargement resultat;
+        resultat.erreurs.push_back({0, "fichier", "flux invalide"});
+        return resultat;
+    }
+    string contenu((istreambuf_iterator<char>(p_is)), istreambuf_iterator<char>());
+    return validerEtChargerCatalogueDepuisTexte(contenu);
+}
+
+/**
+ * \brief Valide un catalogue déjà en mémoire et le construit en une seule passe.
+ *
+ *        Applique les mêmes règles que util::validerFormatFichier(), mais construit
+ *        les produits au fur et à mesure au lieu de devoir relire le fichier, et
+ *        relève toutes les erreurs au lieu de s’arrêter à la première :
+ *        - la ligne 1 (nom) n’est pas vide ;
+ *        - la ligne 2 contient une date « jour mois annee » valide ;
+ *        - chaque ligne suivante est non vide et contient exactement six champs ;
+ *        - le type est Electronique ou Vetement, le prix un nombre, et le code est
+ *          valide pour la description et le prix (util::validerCodeProduit) ;
+ *        - pour un vêtement, la taille (sans égard à la casse) est XS, S, M, L, XL ou XXL,
+ *          et la couleur n’est pas vide ;
+ *        - pour un produit électronique, la garantie est un entier positif ou nul
+ *          et l’indicateur de reconditionnement vaut 0 ou 1 ;
+ *        - aucun code n’apparaît deux fois.
+ *        Les champs sont débarrassés de leurs espaces de début et de fin, et un champ
+ *        numérique doit être entièrement occupé par le nombre.
+ *
+ * \param[in] p_contenu contenu complet du catalogue
+ * \return Le catalogue construit, ou la liste des erreurs détectées.
+ */
+ResultatChargement validerEtChargerCatalogueDepuisTexte(std::string_view p_contenu)
+{
+    ResultatChargement resultat;
+    auto signaler = [&resultat](size_t p_ligne, const char* p_champ, const char* p_raison) {
+        resultat.erreurs.push_back({p_ligne, p_champ, p_raison});
+    };
+
+    string_view nomCatalogue = rogner(prochaineLigne(p_contenu));
+    if (nomCatalogue.empty()) {
+        signaler(1, "nom", "nom du catalogue absent");
+    }
+
+    string_view ligneDate = rogner(prochaineLigne(p_contenu));
+    int valeurs[3] = {0, 0, 0};
+    bool dateValide = true;
+    for (int& valeur : valeurs) {
+        ligneDate = ligneDate.substr(min(ligneDate.size(), ligneDate.find_first_not_of(" \t")));
+        auto lecture = from_chars(ligneDate.data(), ligneDate.data() + ligneDate.size(), valeur);
+        if (lecture.ec != errc()) {
+            dateValide = false;
+            break;
+        }
+        ligneDate.remove_prefix(lecture.ptr - ligneDate.data());
+    }
+    if (!dateValide || !Date::validerDate(valeurs[0], valeurs[1], valeurs[2])) {
+        signaler(2, "date", "date invalide");
+        dateValide = false;
+    }
+
+    // Le catalogue est construit même si l'en-tête est fautif, afin de détecter les doublons.
+    Catalogue catalogue(nomCatalogue.empty() ? string("catalogue") : string(nomCatalogue),
+                        dateValide ? Date(valeurs[0], valeurs[1], valeurs[2]) : Date());
+
+    size_t numLigne = 2;
+    while (!p_contenu.empty()) {
+        string_view ligne = rogner(prochaineLigne(p_contenu));
+        ++numLigne;
+        if (ligne.empty()) {
+            signaler(numLigne, "ligne", "ligne vide");
+            continue;
+        }
+
+        if (count(ligne.begin(), ligne.end(), ',') != 5) {
+            signaler(numLigne, "ligne", "la ligne doit contenir six champs");
+            continue;
+        }
+        string_view champs[6];
+        for (string_view& champ : champs) {
+            champ = rogner(prochainChamp(ligne));
+        }
+
+        string_view type = champs[0];
+        if (type != "Electronique" && type != "Vetement") {
+            signaler(numLigne, "type", "type de produit inconnu");
+            continue;
+        }
+        size_t nbErreursAvant = resultat.erreurs.size();
+
+        double prix = 0.0;
+        if (!lirePrix(champs[2], prix)) {
+            signaler(numLigne, "prix", "prix invalide");
+        }
+        else if (!util::validerCodeProduit(champs[3], champs[1], prix)) {
+            signaler(numLigne, "code", "code produit invalide");
+        }
+
+        string taille;
+        int garantie = 0;
+        int reconditionne = 0;
+        if (type == "Vetement") {
+            taille = string(champs[4]);
+            for (char& c : taille) {
+                c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+            }
+            if (!(taille == "XS" || taille == "S" || taille == "M" ||
+                  taille == "L" || taille == "XL" || taille == "XXL")) {
+                signaler(numLigne, "taille", "taille invalide");
+            }
+            if (champs[5].empty()) {
+                signaler(numLigne, "couleur", "couleur absente");
+            }
+        }
+        else {
+            if (!lireNombre(champs[4], garantie) || garantie < 0) {
+                signaler(numLigne, "garantie", "garantie invalide");
+            }
+            if (!lireNombre(champs[5], reconditionne) || (reconditionne != 0 && reconditionne != 1)) {
+                signaler(numLigne, "reconditionne", "l'indicateur de reconditionnement doit valoir 0 ou 1");
+            }
+        }
+
+        if (resultat.erreurs.size() != nbErreursAvant) {
+            continue;
+        }
+        try {
+            if (type == "Vetement") {
+                catalogue.ajouterProduit(make_unique<Vetement>(string(champs[1]), prix, string(champs[3]), taille, string(champs[5])));
+            }
+            else {
+                catalogue.ajouterProduit(make_unique<Electronique>(string(champs[1]), prix, string(champs[3]), garantie, reconditionne == 1));
+            }
+        }
+        catch (const ProduitDejaPresentException&) {
+            signaler(numLigne, "code", "code produit déjà présent");
+        }
+    }
+
+    if (resultat.erreurs.empty()) {
+        resultat.catalogue.emplace(std::move(catalogue));
+    }
+    return resultat;
+}
+
+} // namespace commerce
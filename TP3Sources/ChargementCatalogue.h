@@ -0,0 +1,122 @@
+/**
+ * \file ChargementCatalogue.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Chargement d’un catalogue à partir de sa représentation texte.
+ *
+ * Format attendu :
+ *  - Ligne 1 : nom du catalogue (ex.: "mon catalogue")
+ *  - Ligne 2 : trois entiers "jour mois annee" (ex.: "21 8 2025")
+ *  - Puis, une ligne par produit, au format CSV :
+ *      Electronique,Description,prix,code,garantie,enRecond
+ *      Vetement,Description,prix,code,taille,couleur
+ *
+ * Les lignes vides et les lignes dont le type de produit est inconnu sont ignorées.
+ */
+
+#ifndef CHARGEMENTCATALOGUE_H
+#define CHARGEMENTCATALOGUE_H
+
+#include <atomic>
+#include <istream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Catalogue.h"
+
+namespace commerce {
+
+/**
+ * \class ChargementCatalogueException
+ * \brief Exception lancée lorsqu’un fichier catalogue est mal formé.
+ *
+ * Le message indique le numéro de la ligne fautive et la raison de l’erreur.
+ */
+class ChargementCatalogueException : public std::runtime_error
+{
+public:
+  /**
+   * \brief Constructeur avec message.
+   * \param[in] p_raison message décrivant la cause de l’exception.
+   */
+    ChargementCatalogueException(const std::string& p_raison)
+    : std::runtime_error(p_raison) {};
+};
+
+/**
+ * \class ChargementAnnuleException
+ * \brief Exception lancée lorsqu’un chargement est interrompu à la demande de l’appelant.
+ */
+class ChargementAnnuleException : public std::runtime_error
+{
+public:
+  /**
+   * \brief Constructeur avec message.
+   * \param[in] p_raison message décrivant la cause de l’exception.
+   */
+    ChargementAnnuleException(const std::string& p_raison)
+    : std::runtime_error(p_raison) {};
+};
+
+/**
+ * \struct SuiviChargement
+ * \brief État partagé entre un chargement exécuté sur un autre fil et celui qui le suit.
+ *
+ * Le fil de chargement publie la taille du contenu et le nombre d’octets déjà
+ * analysés; le fil qui le suit (par exemple celui de l’interface) peut les lire
+ * à tout moment et demander l’annulation du chargement.
+ */
+struct SuiviChargement
+{
+    std::atomic<std::size_t> octetsLus{0};            ///< Octets du contenu déjà analysés.
+    std::atomic<std::size_t> octetsTotal{0};          ///< Taille totale du contenu.
+    std::atomic<bool> annulationDemandee{false};      ///< Mis à true pour interrompre le chargement.
+};
+
+/**
+ * \struct ErreurFormat
+ * \brief Description d’une erreur détectée lors de la validation d’un fichier catalogue.
+ */
+struct ErreurFormat
+{
+    std::size_t ligne;      ///< Numéro de la ligne fautive (0 si l’erreur concerne tout le fichier).
+    std::string champ;      ///< Nom du champ fautif (ex.: "prix", "code", "taille").
+    std::string raison;     ///< Description de l’erreur.
+};
+
+/**
+ * \struct ResultatChargement
+ * \brief Résultat d’une validation combinée au chargement d’un fichier catalogue.
+ *
+ * Le catalogue n’est présent que si aucune erreur n’a été détectée. Dans le cas
+ * contraire, la liste des erreurs contient toutes les erreurs du fichier, dans
+ * l’ordre des lignes.
+ */
+struct ResultatChargement
+{
+    std::optional<Catalogue> catalogue;
+    std::vector<ErreurFormat> erreurs;
+
+  /**
+   * \brief Indique si le fichier est valide.
+   * \return true si aucune erreur n’a été détectée (le catalogue est alors présent).
+   */
+    bool estValide() const { return erreurs.empty(); }
+};
+
+Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier);
+Catalogue chargerCatalogueDepuisTexte(std::string_view p_contenu);
+Catalogue chargerCatalogueDepuisFichier(const std::string& p_nomFichier, SuiviChargement& p_suivi);
+Catalogue chargerCatalogueDepuisTexte(std::string_view p_contenu, SuiviChargement& p_suivi);
+Catalogue chargerCatalogueEnParallele(const std::string& p_nomFichier, unsigned int p_nbFils = 0);
+Catalogue chargerCatalogueDepuisTexteEnParallele(std::string_view p_contenu, unsigned int p_nbFils = 0);
+
+ResultatChargement validerEtChargerCatalogueDepuisFichier(const std::string& p_nomFichier);
+ResultatChargement validerEtChargerCatalogue(std::istream& p_is);
+ResultatChargement validerEtChargerCatalogueDepuisTexte(std::string_view p_contenu);
+
+} // namespace commerce
+
+#endif /* CHARGEMENTCATALOGUE_H */
@@ -0,0 +1,196 @@
+/**
+ * \file CodeProduit.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe CodeProduit
+ */
+
+#include "CodeProduit.h"
+#include "ContratException.h"
+#include <ostream>
+
+using namespace std;
+
+namespace util
+{
+
+namespace
+{
+
+const char PREFIXE[] = "PRD-";
+
+/**
+ * \brief Compacte les quatre lettres et la clé : une lettre par octet, de l’octet 4 à
+ *        l’octet 1, puis la clé dans l’octet 0.
+ */
+uint64_t compacter(const char p_lettres[4], int p_cle)
+{
+    uint64_t valeur = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        valeur = (valeur << 8) | static_cast<unsigned char>(p_lettres[i]);
+    }
+    return (valeur << 8) | static_cast<uint64_t>(p_cle);
+}
+
+} // namespace
+
+/**
+ * \brief Constructeur par défaut : le code est vide.
+ * \post estVide()
+ */
+CodeProduit::CodeProduit() : m_valeur(0)
+{
+    POSTCONDITION(estVide());
+}
+
+/**
+ * \brief Construit un code à partir de sa forme textuelle.
+ * \param[in] p_code code de la forme PRD-XXXX-NN
+ * \pre CodeProduit::analyser(p_code) réussit
+ * \post reqTexte() == p_code
+ */
+CodeProduit::CodeProduit(string_view p_code) : m_valeur(0)
+{
+    optional<CodeProduit> code = analyser(p_code);
+    PRECONDITION(code.has_value());
+
+    m_valeur = code->m_valeur;
+
+    POSTCONDITION(reqTexte() == p_code);
+    INVARIANTS();
+}
+
+CodeProduit::CodeProduit(uint64_t p_valeur) : m_valeur(p_valeur)
+{
+    INVARIANTS();
+}
+
+/**
+ * \brief Analyse la forme textuelle d’un code produit.
+ *
+ *        Le format est vérifié (préfixe, quatre lettres majuscules, tiret, deux chiffres),
+ *        mais pas la correspondance avec une description et un prix : voir
+ *        validerCodeProduit().
+ *
+ * \param[in] p_code texte à analyser
+ * \return Le code, ou std::nullopt si le texte ne respecte pas le format PRD-XXXX-NN.
+ */
+optional<CodeProduit> CodeProduit::analyser(string_view p_code)
+{
+    if (p_code.size() != TAILLE_CODE_PRODUIT || p_code.substr(0, 4) != PREFIXE || p_code[8] != '-')
+    {
+        return nullopt;
+    }
+    for (size_t i = 4; i < 8; ++i)
+    {
+        if (p_code[i] < 'A' || p_code[i] > 'Z')
+        {
+            return nullopt;
+        }
+    }
+    if (p_code[9] < '0' || p_code[9] > '9' || p_code[10] < '0' || p_code[10] > '9')
+    {
+        return nullopt;
+    }
+    return CodeProduit(compacter(p_code.data() + 4, (p_code[9] - '0') * 10 + (p_code[10] - '0')));
+}
+
+/**
+ * \brief Génère le code d’une description et d’un prix (voir genererCodeProduit()).
+ * \param[in] p_nom description du produit
+ * \param[in] p_prix prix du produit
+ * \return Le code généré, ou un code vide si la description compte moins de quatre lettres.
+ */
+CodeProduit CodeProduit::generer(string_view p_nom, double p_prix)
+{
+    TamponCodeProduit texte;
+    size_t taille = ecrireCodeProduit(p_nom, p_prix, texte);
+    return analyser(string_view(texte.data(), taille)).value_or(CodeProduit());
+}
+
+/**
+ * \brief Indique si le code est vide.
+ * \return true pour un code construit par défaut.
+ */
+bool CodeProduit::estVide() const
+{
+    return m_valeur == 0;
+}
+
+/**
+ * \brief Retourne la valeur compactée du code.
+ * \return Un entier dont l’ordre suit l’ordre alphabétique des codes textuels.
+ */
+uint64_t CodeProduit::reqValeur() const
+{
+    return m_valeur;
+}
+
+/**
+ * \brief Écrit la forme textuelle du code dans un tampon de taille fixe.
+ * \param[out] p_code tampon qui reçoit le code
+ * \return Le nombre de caractères écrits (TAILLE_CODE_PRODUIT, ou 0 pour un code vide).
+ */
+size_t CodeProduit::ecrire(TamponCodeProduit& p_code) const
+{
+    if (estVide())
+    {
+        return 0;
+    }
+    for (size_t i = 0; i < 4; ++i)
+    {
+        p_code[i] = PREFIXE[i];
+        p_code[4 + i] = static_cast<char>(m_valeur >> (8 * (4 - i)));
+    }
+    int cle = static_cast<int>(m_valeur & 0xFF);
+    p_code[8] = '-';
+    p_code[9] = static_cast<char>('0' + cle / 10);
+    p_code[10] = static_cast<char>('0' + cle % 10);
+    return TAILLE_CODE_PRODUIT;
+}
+
+/**
+ * \brief Retourne la forme textuelle du code.
+ * \return Le code PRD-XXXX-NN, ou une chaîne vide pour un code vide.
+ */
+string CodeProduit::reqTexte() const
+{
+    TamponCodeProduit texte;
+    return string(texte.data(), ecrire(texte));
+}
+
+bool CodeProduit::operator==(const CodeProduit& p_code) const
+{
+    return m_valeur == p_code.m_valeur;
+}
+
+bool CodeProduit::operator!=(const CodeProduit& p_code) const
+{
+    return m_valeur != p_code.m_valeur;
+}
+
+bool CodeProduit::operator<(const CodeProduit& p_code) const
+{
+    return m_valeur < p_code.m_valeur;
+}
+
+/**
+ * \brief Écrit la forme textuelle du code dans un flux.
+ */
+ostream& operator<<(ostream& p_os, const CodeProduit& p_code)
+{
+    TamponCodeProduit texte;
+    return p_os.write(texte.data(), static_cast<streamsize>(p_code.ecrire(texte)));
+}
+
+/**
+ * \brief Teste l’invariant : un code non vide a quatre lettres majuscules et une clé < 100.
+ */
+void CodeProduit::verifieInvariant() const
+{
+    INVARIANT(estVide() || (m_valeur >> 40) == 0);
+    INVARIANT(estVide() || (m_valeur & 0xFF) < 100);
+}
+
+} // namespace util
@@ -0,0 +1,86 @@
+/**
+ * \file CodeProduit.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe CodeProduit
+ */
+
+#ifndef CODEPRODUIT_H
+#define CODEPRODUIT_H
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "validationFormat.h"
+
+namespace util
+{
+
+/**
+ * \class CodeProduit
+ * \brief Code produit de la forme PRD-XXXX-NN, compacté dans un entier de 64 bits.
+ *
+ * Un code produit est entièrement déterminé par ses quatre lettres et sa clé de contrôle
+ * à deux chiffres. Ces éléments sont rangés dans un seul entier, lettres en poids fort et
+ * clé en poids faible, de sorte que :
+ * - l’égalité de deux codes se ramène à une comparaison d’entiers ;
+ * - l’ordre des entiers suit l’ordre alphabétique des codes textuels ;
+ * - un code occupe 8 octets, sans allocation.
+ *
+ * Le code par défaut est vide (valeur 0) et ne correspond à aucun produit.
+ *
+ * \invariant estVide() ou le code textuel respecte le format PRD-XXXX-NN.
+ */
+class CodeProduit
+{
+public:
+    CodeProduit();
+    explicit CodeProduit(std::string_view p_code);
+
+    static std::optional<CodeProduit> analyser(std::string_view p_code);
+    static CodeProduit generer(std::string_view p_nom, double p_prix);
+
+    bool estVide() const;
+    std::uint64_t reqValeur() const;
+    std::size_t ecrire(TamponCodeProduit& p_code) const;
+    std::string reqTexte() const;
+
+    bool operator==(const CodeProduit& p_code) const;
+    bool operator!=(const CodeProduit& p_code) const;
+    bool operator<(const CodeProduit& p_code) const;
+
+    friend std::ostream& operator<<(std::ostream& p_os, const CodeProduit& p_code);
+
+private:
+    explicit CodeProduit(std::uint64_t p_valeur);
+    void verifieInvariant() const;
+    std::uint64_t m_valeur;
+};
+
+} // namespace util
+
+namespace std
+{
+
+/**
+ * \brief Hachage d’un code produit, pour les index non ordonnés.
+ *
+ *        La valeur compactée est mélangée pour répartir les codes, qui ne diffèrent souvent
+ *        que par quelques bits, sur l’ensemble des alvéoles.
+ */
+template <>
+struct hash<util::CodeProduit>
+{
+    std::size_t operator()(const util::CodeProduit& p_code) const noexcept
+    {
+        std::uint64_t valeur = p_code.reqValeur() * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(valeur ^ (valeur >> 32));
+    }
+};
+
+} // namespace std
+
+#endif /* CODEPRODUIT_H */
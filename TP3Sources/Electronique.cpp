@@ -9,6 +9,7 @@
 
 #include "Electronique.h"
 #include "ContratException.h"
+#include "ArenaProduits.h"
 #include <sstream>
 using namespace std;
 
@@ -93,28 +94,59 @@ unique_ptr<Produit> Electronique::clone() const
 {
         return make_unique<Electronique>(*this);
 }
+
+ /**
+   * \brief Crée une copie du produit électronique dans l’arène d’un catalogue.
+   *
+   * \param[in,out] p_arena Arène qui reçoit la copie.
+   * \return Un pointeur partagé vers la copie, logée dans l’arène.
+   */
+shared_ptr<Produit> Electronique::cloneDans(ArenaProduits& p_arena) const
+{
+        return p_arena.creer<Electronique>(*this);
+}
+
+ /**
+   * \brief Déplace le produit électronique dans l’arène d’un catalogue.
+   *
+   * \param[in,out] p_arena Arène qui reçoit le produit.
+   * \return Un pointeur partagé vers le produit, logé dans l’arène.
+   */
+shared_ptr<Produit> Electronique::deplacerDans(ArenaProduits& p_arena)
+{
+        return p_arena.creer<Electronique>(std::move(*this));
+}
  /**
    * \brief Retourne une représentation textuelle détaillée du produit électronique.
    *
-   *        Cette méthode reprend d’abord la représentation textuelle du produit de base
-   *        (via Produit::reqProduitFormate()), puis y ajoute les informations
-   *        spécifiques aux produits électroniques :
-   *        - la durée de garantie en mois ;
-   *        - l’état (reconditionné ou non).
+   *        Le texte est celui que produit ecrireFormate().
    * \return Une chaîne de caractères contenant la description formatée du produit électronique.
    */
 
 
  string Electronique::reqProduitFormate() const {
-        ostringstream oss;
-        oss << "----------------------------" << endl;
-        oss << "Produit Electronique" << endl;
+        util::TamponTexte tampon;
+        ecrireFormate(tampon);
+        return tampon.prendreTexte();
+    }
+
+ /**
+   * \brief Ajoute la représentation textuelle détaillée du produit électronique à un tampon.
+   *
+   *        Cette méthode écrit d’abord un en-tête, puis la représentation textuelle du
+   *        produit de base (via Produit::ecrireFormate()), et y ajoute les informations
+   *        spécifiques aux produits électroniques :
+   *        - la durée de garantie en mois ;
+   *        - l’état (reconditionné ou non).
+   * \param[out] p_tampon tampon qui reçoit le texte
+   */
+ void Electronique::ecrireFormate(util::TamponTexte& p_tampon) const {
+        p_tampon.ajouter("----------------------------\nProduit Electronique\n");
         // Informations de base du produit
-        oss << Produit::reqProduitFormate() << endl;
+        Produit::ecrireFormate(p_tampon);
         // Informations spécifiques à Electronique
-        oss << "Garantie : " << reqGarantieMois() << " mois" << endl;
-        oss << "Reconditionné : " << (reqEstReconditionne() ? "Oui" : "Non") << endl;
-        return oss.str();
+        p_tampon.ajouter("\nGarantie : ").ajouterEntier(reqGarantieMois()).ajouter(" mois\n");
+        p_tampon.ajouter(reqEstReconditionne() ? "Reconditionné : Oui\n" : "Reconditionné : Non\n");
     }
 
 
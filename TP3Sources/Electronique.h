@@ -36,7 +36,8 @@ namespace commerce {
  * - de savoir si le produit est reconditionné ou neuf ;
  * - de comparer deux produits électroniques entre eux ;
  * - de fournir une version textuelle détaillée du produit incluant ses attributs propres ;
- * - de créer une copie polymorphique du produit électronique via clone().
+ * - de créer une copie polymorphique du produit électronique via clone(), ou de le
+ *   copier ou déplacer dans l’arène d’un catalogue (cloneDans(), deplacerDans()).
  *
  * Les invariants de cette classe garantissent que :
  * - la durée de garantie est toujours positive ou nulle ;
@@ -52,7 +53,11 @@ public:
     bool reqEstReconditionne() const;
     bool operator==(const Electronique& p_electronique) const;
     std::unique_ptr<Produit> clone() const override;
+    std::shared_ptr<Produit> cloneDans(ArenaProduits& p_arena) const override;
+    std::shared_ptr<Produit> deplacerDans(ArenaProduits& p_arena) override;
     std::string reqProduitFormate() const override;
+    using Produit::ecrireFormate;
+    void ecrireFormate(util::TamponTexte& p_tampon) const override;
     
 private:
     int m_garantieMois;
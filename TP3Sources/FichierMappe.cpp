@@ -0,0 +1,84 @@
+/**
+ * \file FichierMappe.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe FichierMappe
+ */
+
+#include "FichierMappe.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace util {
+
+/**
+ * \brief Constructeur avec paramètre.
+ *
+ *        Ouvre le fichier et le projette en mémoire en lecture seule. Le descripteur
+ *        est refermé aussitôt : la projection reste valide jusqu’à la destruction.
+ *        Un fichier vide donne un contenu vide, sans projection.
+ *
+ * \param[in] p_nomFichier Chemin du fichier à projeter.
+ *
+ * \exception std::runtime_error Levée si le fichier ne peut pas être ouvert ou projeté.
+ */
+FichierMappe::FichierMappe(const std::string& p_nomFichier) : m_donnees(nullptr), m_taille(0)
+{
+    int descripteur = ::open(p_nomFichier.c_str(), O_RDONLY);
+    if (descripteur < 0) {
+        throw runtime_error("Impossible d'ouvrir le fichier " + p_nomFichier);
+    }
+
+    struct stat infos;
+    if (::fstat(descripteur, &infos) != 0) {
+        ::close(descripteur);
+        throw runtime_error("Impossible de lire la taille du fichier " + p_nomFichier);
+    }
+    m_taille = static_cast<size_t>(infos.st_size);
+
+    if (m_taille > 0) {
+        void* projection = ::mmap(nullptr, m_taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+        if (projection == MAP_FAILED) {
+            ::close(descripteur);
+            throw runtime_error("Impossible de projeter en mémoire le fichier " + p_nomFichier);
+        }
+        ::madvise(projection, m_taille, MADV_SEQUENTIAL);
+        m_donnees = static_cast<const char*>(projection);
+    }
+    ::close(descripteur);
+}
+
+/**
+ * \brief Destructeur. Libère la projection du fichier.
+ */
+FichierMappe::~FichierMappe()
+{
+    if (m_donnees != nullptr) {
+        ::munmap(const_cast<char*>(m_donnees), m_taille);
+    }
+}
+
+/**
+ * \brief Retourne le contenu complet du fichier.
+ * \return Une vue sur les octets du fichier, valide tant que l’objet existe.
+ */
+std::string_view FichierMappe::reqContenu() const
+{
+    return std::string_view(m_donnees, m_taille);
+}
+
+/**
+ * \brief Retourne la taille du fichier.
+ * \return La taille du fichier, en octets.
+ */
+std::size_t FichierMappe::reqTaille() const
+{
+    return m_taille;
+}
+
+} // namespace util
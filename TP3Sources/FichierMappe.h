@@ -0,0 +1,49 @@
+/**
+ * \file FichierMappe.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe FichierMappe
+ */
+
+#ifndef FICHIERMAPPE_H
+#define FICHIERMAPPE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace util {
+
+/**
+ * \class FichierMappe
+ * \brief Projection en mémoire, en lecture seule, du contenu d’un fichier.
+ *
+ * La classe FichierMappe rend le contenu d’un fichier accessible directement en
+ * mémoire (mmap), sans le recopier dans un tampon. Le contenu est exposé sous forme
+ * de std::string_view, ce qui permet de le découper en lignes et en champs sans
+ * aucune allocation.
+ *
+ * La projection est libérée à la destruction de l’objet : les vues obtenues par
+ * reqContenu() ne doivent donc pas lui survivre. Un objet FichierMappe n’est pas
+ * copiable.
+ */
+class FichierMappe
+{
+public:
+    explicit FichierMappe(const std::string& p_nomFichier);
+    ~FichierMappe();
+
+    FichierMappe(const FichierMappe&) = delete;
+    FichierMappe& operator=(const FichierMappe&) = delete;
+
+    std::string_view reqContenu() const;
+    std::size_t reqTaille() const;
+
+private:
+    const char* m_donnees;
+    std::size_t m_taille;
+};
+
+} // namespace util
+
+#endif /* FICHIERMAPPE_H */
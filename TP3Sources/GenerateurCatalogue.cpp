@@ -0,0 +1,258 @@
+/**
+ * \file GenerateurCatalogue.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la génération de catalogues synthétiques.
+ */
+
+#include "GenerateurCatalogue.h"
+#include "ContratException.h"
+#include "validationFormat.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+using namespace std;
+
+namespace commerce {
+
+namespace {
+
+const size_t NB_PREFIXES = 26 * 26 * 26 * 26;
+const size_t NB_SOMMES_CENTS = 19; // les deux chiffres des cents valent de 0+0 à 9+9
+const uint64_t MULTIPLICATEUR_PREFIXES = 319153; // premier avec 26, donc bijectif modulo 26^4
+
+const char* const NOMS_ELECTRONIQUE[] = {"casque sans fil", "montre connectee", "tablette", "enceinte portable",
+                                         "chargeur rapide", "clavier mecanique", "souris optique", "ecran"};
+const char* const NOMS_VETEMENT[] = {"t-shirt coton", "chemise lin", "pull laine", "veste legere",
+                                     "pantalon toile", "robe ete", "manteau hiver", "short sport"};
+const char* const QUALIFICATIFS[] = {"edition", "noir", "compact", "premium", "classique", "leger", "pro",
+                                     "recycle", "ajuste", "urbain", "sport", "confort", "mini", "max",
+                                     "essentiel", "nouveau"};
+const char* const TAILLES[] = {"XS", "S", "M", "L", "XL", "XXL"};
+const char* const COULEURS[] = {"Blanc", "Noir", "Rouge", "Bleu", "Vert", "Gris", "Beige", "Marine"};
+
+/**
+ * \brief Générateur SplitMix64 : chaque produit a sa propre suite de tirages, qui ne dépend
+ *        que de la graine et du rang du produit.
+ *
+ *        Un produit déjà écrit peut ainsi être réécrit à l’identique (doublon) sans avoir
+ *        été conservé en mémoire.
+ */
+class TiragesProduit
+{
+public:
+    TiragesProduit(uint64_t p_graine, size_t p_rang) :
+        m_etat(p_graine ^ (static_cast<uint64_t>(p_rang) * 0xD1B54A32D192ED03ULL))
+    {
+    }
+
+    uint64_t suivant()
+    {
+        uint64_t z = (m_etat += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    double reel()
+    {
+        return static_cast<double>(suivant() >> 11) * 0x1.0p-53;
+    }
+
+private:
+    uint64_t m_etat;
+};
+
+/**
+ * \brief Écrit le préfixe de quatre lettres associé à un rang.
+ *
+ *        Les rangs successifs sont dispersés sur les 26^4 préfixes possibles pour que les
+ *        descriptions ne se suivent pas dans l’ordre alphabétique.
+ */
+void ecrirePrefixe(size_t p_rang, string& p_description)
+{
+    size_t valeur = static_cast<size_t>((p_rang * MULTIPLICATEUR_PREFIXES) % NB_PREFIXES);
+    char prefixe[4];
+    for (int i = 3; i >= 0; --i) {
+        prefixe[i] = static_cast<char>('a' + valeur % 26);
+        valeur /= 26;
+    }
+    prefixe[0] = static_cast<char>(prefixe[0] - 'a' + 'A');
+    p_description.append(prefixe, 4);
+}
+
+/**
+ * \brief Choisit les cents d’un prix dont les deux chiffres ont une somme imposée.
+ *
+ *        Les sommes sont parcourues en partant de 9, celle qui admet le plus de valeurs
+ *        (09, 18, ..., 90), pour que les premiers produits aient des prix variés.
+ *
+ * \param[in] p_tour nombre de fois où tous les préfixes ont déjà été utilisés
+ * \param[in] p_tirage valeur aléatoire servant à choisir parmi les cents admissibles
+ */
+int choisirCents(size_t p_tour, uint64_t p_tirage)
+{
+    int ecart = static_cast<int>((p_tour + 1) / 2);
+    int somme = (p_tour % 2 == 0) ? 9 + ecart : 9 - ecart;
+    int dizainesMin = max(0, somme - 9);
+    int dizainesMax = min(9, somme);
+    int dizaines = dizainesMin + static_cast<int>(p_tirage % static_cast<uint64_t>(dizainesMax - dizainesMin + 1));
+    return dizaines * 10 + (somme - dizaines);
+}
+
+size_t choisirLongueur(const ParametresGeneration& p_parametres, TiragesProduit& p_tirages)
+{
+    size_t minimum = p_parametres.longueurDescriptionMin;
+    size_t maximum = p_parametres.longueurDescriptionMax;
+    switch (p_parametres.distributionLongueur) {
+    case DistributionLongueur::FIXE:
+        return minimum;
+    case DistributionLongueur::UNIFORME:
+        return minimum + static_cast<size_t>(p_tirages.suivant() % (maximum - minimum + 1));
+    case DistributionLongueur::NORMALE:
+    default:
+    {
+        // Box-Muller : une variable normale centrée réduite à partir de deux uniformes
+        double u1 = max(p_tirages.reel(), 1e-300);
+        double u2 = p_tirages.reel();
+        double normale = sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+        double longueur = (minimum + maximum) / 2.0 + normale * (maximum - minimum) / 6.0;
+        return static_cast<size_t>(clamp(llround(longueur), static_cast<long long>(minimum),
+                                         static_cast<long long>(maximum)));
+    }
+    }
+}
+
+/**
+ * \brief Ajoute à p_ligne la ligne complète (avec le saut de ligne) du produit d’un rang donné.
+ *
+ *        La ligne ne dépend que des paramètres et du rang : deux appels pour le même rang
+ *        produisent la même ligne.
+ */
+void ecrireProduit(const ParametresGeneration& p_parametres, size_t p_rang, string& p_ligne)
+{
+    TiragesProduit tirages(p_parametres.graine, p_rang);
+    bool estElectronique = tirages.reel() < p_parametres.proportionElectronique;
+
+    size_t debutDescription = p_ligne.size() + (estElectronique ? 13 : 9);
+    p_ligne += estElectronique ? "Electronique," : "Vetement,";
+    ecrirePrefixe(p_rang % NB_PREFIXES, p_ligne);
+    size_t longueur = choisirLongueur(p_parametres, tirages);
+    const char* nom = estElectronique ? NOMS_ELECTRONIQUE[tirages.suivant() % 8] : NOMS_VETEMENT[tirages.suivant() % 8];
+    p_ligne += ' ';
+    p_ligne += nom;
+    while (p_ligne.size() - debutDescription < longueur) {
+        p_ligne += ' ';
+        p_ligne += QUALIFICATIFS[tirages.suivant() % 16];
+    }
+    p_ligne.resize(debutDescription + longueur);
+    while (p_ligne.back() == ' ') {
+        p_ligne.pop_back();
+    }
+    string_view description(p_ligne.data() + debutDescription, p_ligne.size() - debutDescription);
+
+    int euros = 1 + static_cast<int>(tirages.suivant() % 999);
+    double prix = euros + choisirCents((p_rang / NB_PREFIXES) % NB_SOMMES_CENTS, tirages.suivant()) / 100.0;
+    util::TamponCodeProduit code;
+    size_t tailleCode = util::ecrireCodeProduit(description, prix, code);
+
+    char nombre[32];
+    p_ligne += ',';
+    p_ligne.append(nombre, to_chars(nombre, nombre + sizeof(nombre), prix, chars_format::fixed, 2).ptr);
+    p_ligne += ',';
+    p_ligne.append(code.data(), tailleCode);
+    p_ligne += ',';
+    if (estElectronique) {
+        p_ligne.append(nombre, to_chars(nombre, nombre + sizeof(nombre), tirages.suivant() % 37).ptr);
+        p_ligne += ',';
+        p_ligne += (tirages.suivant() % 2 == 0) ? '0' : '1';
+    }
+    else {
+        p_ligne += TAILLES[tirages.suivant() % 6];
+        p_ligne += ',';
+        p_ligne += COULEURS[tirages.suivant() % 8];
+    }
+    p_ligne += '\n';
+}
+
+} // namespace
+
+/**
+ * \brief Retourne le nombre maximal de produits aux codes distincts qu’un catalogue
+ *        synthétique peut contenir.
+ *
+ *        Le code d’un produit ne dépend que des quatre premières lettres de sa description
+ *        et de la somme des chiffres des cents de son prix : chaque produit reçoit un préfixe
+ *        de quatre lettres distinct, puis, une fois les préfixes épuisés, les mêmes préfixes
+ *        sont repris avec une autre somme des cents. Au-delà de ce nombre, les codes se
+ *        répètent : le catalogue reste utile pour mesurer la lecture et la validation, mais
+ *        son chargement échoue sur un code déjà présent.
+ *
+ * \return 26^4 préfixes × 19 sommes des cents possibles.
+ */
+size_t reqNombreMaximalProduitsDistincts()
+{
+    return NB_PREFIXES * NB_SOMMES_CENTS;
+}
+
+/**
+ * \brief Écrit un catalogue synthétique dans un flux, ligne par ligne.
+ *
+ *        Le catalogue respecte le format de ChargementCatalogue.h : nom, date, puis une ligne
+ *        par produit, avec un code produit valide. Une part tauxDoublons des lignes répète à
+ *        l’identique un produit écrit plus haut, choisi au hasard ; ces lignes sont refusées
+ *        au chargement et servent à éprouver la détection des doublons. Rien n’est conservé
+ *        en mémoire entre deux lignes.
+ *
+ * \param[in] p_parametres paramètres du catalogue
+ * \param[out] p_os flux qui reçoit le catalogue
+ *
+ * \pre !p_parametres.nomCatalogue.empty()
+ * \pre 0 <= p_parametres.proportionElectronique <= 1
+ * \pre 0 <= p_parametres.tauxDoublons <= 1
+ * \pre 4 <= p_parametres.longueurDescriptionMin <= p_parametres.longueurDescriptionMax
+ */
+void genererCatalogue(const ParametresGeneration& p_parametres, std::ostream& p_os)
+{
+    PRECONDITION(!p_parametres.nomCatalogue.empty());
+    PRECONDITION(p_parametres.proportionElectronique >= 0 && p_parametres.proportionElectronique <= 1);
+    PRECONDITION(p_parametres.tauxDoublons >= 0 && p_parametres.tauxDoublons <= 1);
+    PRECONDITION(p_parametres.longueurDescriptionMin >= 4);
+    PRECONDITION(p_parametres.longueurDescriptionMin <= p_parametres.longueurDescriptionMax);
+
+    p_os << p_parametres.nomCatalogue << '\n'
+         << p_parametres.date.reqJour() << ' ' << p_parametres.date.reqMois() << ' '
+         << p_parametres.date.reqAnnee() << '\n';
+
+    mt19937_64 doublons(p_parametres.graine);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    size_t nbDistincts = 0;
+    string ligne;
+    for (size_t i = 0; i < p_parametres.nbProduits; ++i) {
+        ligne.clear();
+        if (nbDistincts > 0 && uniforme(doublons) < p_parametres.tauxDoublons) {
+            ecrireProduit(p_parametres, static_cast<size_t>(doublons() % nbDistincts), ligne);
+        }
+        else {
+            ecrireProduit(p_parametres, nbDistincts++, ligne);
+        }
+        p_os.write(ligne.data(), static_cast<streamsize>(ligne.size()));
+    }
+}
+
+/**
+ * \brief Génère un catalogue synthétique sous forme de texte.
+ * \param[in] p_parametres paramètres du catalogue
+ * \return Le texte du catalogue, au format de ChargementCatalogue.h.
+ */
+std::string genererTexteCatalogue(const ParametresGeneration& p_parametres)
+{
+    ostringstream os;
+    genererCatalogue(p_parametres, os);
+    return os.str();
+}
+
+} // namespace commerce
@@ -0,0 +1,58 @@
+/**
+ * \file GenerateurCatalogue.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Génération de catalogues synthétiques au format lu par ChargementCatalogue.h.
+ *
+ * Les catalogues générés servent aux mesures de performance et aux essais de charge :
+ * leurs produits sont valides et leur contenu ne dépend que des paramètres (en particulier
+ * de la graine), ce qui rend les mesures reproductibles. Le catalogue est écrit ligne par
+ * ligne, sans être conservé en mémoire, ce qui permet d’en produire de toute taille.
+ */
+
+#ifndef GENERATEURCATALOGUE_H
+#define GENERATEURCATALOGUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "Date.h"
+
+namespace commerce {
+
+/**
+ * \brief Loi suivie par la longueur des descriptions, entre les bornes des paramètres.
+ *
+ * - FIXE : toutes les descriptions ont la longueur minimale ;
+ * - UNIFORME : toutes les longueurs entre les bornes sont équiprobables ;
+ * - NORMALE : loi normale centrée entre les bornes (écart type d’un sixième de
+ *   l’intervalle), tronquée aux bornes.
+ */
+enum class DistributionLongueur { FIXE, UNIFORME, NORMALE };
+
+/**
+ * \struct ParametresGeneration
+ * \brief Paramètres d’un catalogue synthétique.
+ */
+struct ParametresGeneration
+{
+    std::string nomCatalogue = "catalogue synthetique"; ///< Nom écrit sur la première ligne.
+    util::Date date = util::Date(1, 1, 2025);          ///< Date de dernière mise à jour.
+    std::size_t nbProduits = 1000;                      ///< Nombre de lignes de produits.
+    std::uint64_t graine = 42;                          ///< Graine du générateur pseudo-aléatoire.
+    double proportionElectronique = 0.5;                ///< Part des produits électroniques (0 à 1).
+    double tauxDoublons = 0.0;                          ///< Part des lignes qui répètent un produit déjà écrit (0 à 1).
+    std::size_t longueurDescriptionMin = 10;            ///< Longueur minimale d’une description (au moins 4).
+    std::size_t longueurDescriptionMax = 30;            ///< Longueur maximale d’une description.
+    DistributionLongueur distributionLongueur = DistributionLongueur::UNIFORME; ///< Loi des longueurs.
+};
+
+std::size_t reqNombreMaximalProduitsDistincts();
+
+void genererCatalogue(const ParametresGeneration& p_parametres, std::ostream& p_os);
+std::string genererTexteCatalogue(const ParametresGeneration& p_parametres);
+
+} // namespace commerce
+
+#endif /* GENERATEURCATALOGUE_H */
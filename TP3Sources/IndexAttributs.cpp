@@ -0,0 +1,587 @@
+/**
+ * \file IndexAttributs.cpp
+ * \author Omar Mahamat
+ * \date 17 octobre 2026
+ * \brief Implémentation des classes FiltreAttributs et IndexAttributs
+ */
+
+#include "IndexAttributs.h"
+#include "ContratException.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace commerce
+{
+
+namespace
+{
+
+using Mots = array<uint64_t, IndexAttributs::CAPACITE / 64>;
+
+// Tailles standards d'un vêtement, dans l'ordre des bits de FiltreAttributs::reqTailles()
+const char* const TAILLES[] = {"XS", "S", "M", "L", "XL", "XXL"};
+
+/**
+ * \brief Retourne le numéro d'une taille standard, ou le nombre de tailles si elle n'en est pas une.
+ */
+size_t numeroTaille(const string& p_taille)
+{
+    return static_cast<size_t>(find(begin(TAILLES), end(TAILLES), p_taille) - begin(TAILLES));
+}
+
+bool lireBit(const Mots& p_bitmap, size_t p_rang)
+{
+    return (p_bitmap[p_rang / 64] >> (p_rang % 64) & 1) != 0;
+}
+
+void poserBit(Mots& p_bitmap, size_t p_rang)
+{
+    p_bitmap[p_rang / 64] |= uint64_t(1) << (p_rang % 64);
+}
+
+void effacerBit(Mots& p_bitmap, size_t p_rang)
+{
+    p_bitmap[p_rang / 64] &= ~(uint64_t(1) << (p_rang % 64));
+}
+
+void reunir(Mots& p_resultat, const Mots& p_bitmap)
+{
+    for (size_t i = 0; i < p_resultat.size(); ++i) {
+        p_resultat[i] |= p_bitmap[i];
+    }
+}
+
+void intersecter(Mots& p_resultat, const Mots& p_bitmap)
+{
+    for (size_t i = 0; i < p_resultat.size(); ++i) {
+        p_resultat[i] &= p_bitmap[i];
+    }
+}
+
+bool estVide(const Mots& p_bitmap)
+{
+    return all_of(p_bitmap.begin(), p_bitmap.end(), [](uint64_t p_mot) { return p_mot == 0; });
+}
+
+/**
+ * \brief Retire le bit d'un rang : les bits suivants reculent d'un rang.
+ */
+void decaler(Mots& p_bitmap, size_t p_rang)
+{
+    size_t numMot = p_rang / 64;
+    uint64_t masqueBas = (uint64_t(1) << (p_rang % 64)) - 1;
+    p_bitmap[numMot] = (p_bitmap[numMot] & masqueBas) | ((p_bitmap[numMot] >> 1) & ~masqueBas);
+    for (size_t i = numMot + 1; i < p_bitmap.size(); ++i) {
+        p_bitmap[i - 1] |= p_bitmap[i] << 63;
+        p_bitmap[i] >>= 1;
+    }
+}
+
+/**
+ * \brief Efface les bits des rangs à partir de p_nbRangs.
+ */
+void garderDebut(Mots& p_bitmap, size_t p_nbRangs)
+{
+    for (size_t i = p_nbRangs / 64; i < p_bitmap.size(); ++i) {
+        size_t nbBits = i == p_nbRangs / 64 ? p_nbRangs % 64 : 0;
+        p_bitmap[i] &= (uint64_t(1) << nbBits) - 1;
+    }
+}
+
+/**
+ * \brief Retourne le bitmap d'une valeur du dictionnaire, après l'y avoir ajoutée au besoin.
+ */
+template <typename Valeur>
+Mots& entree(vector<pair<Valeur, Mots>>& p_dictionnaire, const Valeur& p_valeur)
+{
+    auto position = lower_bound(p_dictionnaire.begin(), p_dictionnaire.end(), p_valeur,
+                                [](const pair<Valeur, Mots>& p_entree, const Valeur& p_cle) {
+                                    return p_entree.first < p_cle;
+                                });
+    if (position == p_dictionnaire.end() || position->first != p_valeur) {
+        position = p_dictionnaire.insert(position, {p_valeur, Mots{}});
+    }
+    return position->second;
+}
+
+/**
+ * \brief Retourne l'entrée du dictionnaire dont le bitmap marque un rang, ou la fin.
+ */
+template <typename Dictionnaire>
+auto entreeDuRang(Dictionnaire& p_dictionnaire, size_t p_rang)
+{
+    return find_if(p_dictionnaire.begin(), p_dictionnaire.end(),
+                   [p_rang](const auto& p_entree) { return lireBit(p_entree.second, p_rang); });
+}
+
+/**
+ * \brief Efface le bit d'un rang dans le dictionnaire, en retirant la valeur si elle n'a plus aucun rang.
+ */
+template <typename Valeur>
+void effacerRang(vector<pair<Valeur, Mots>>& p_dictionnaire, size_t p_rang)
+{
+    auto position = entreeDuRang(p_dictionnaire, p_rang);
+    if (position != p_dictionnaire.end()) {
+        effacerBit(position->second, p_rang);
+        if (estVide(position->second)) {
+            p_dictionnaire.erase(position);
+        }
+    }
+}
+
+/**
+ * \brief Retire un rang de chaque bitmap du dictionnaire (voir decaler()), en retirant la valeur qui n'a plus aucun rang.
+ */
+template <typename Valeur>
+void retirerRang(vector<pair<Valeur, Mots>>& p_dictionnaire, size_t p_rang)
+{
+    auto position = entreeDuRang(p_dictionnaire, p_rang);
+    for (auto& entreeValeur : p_dictionnaire) {
+        decaler(entreeValeur.second, p_rang);
+    }
+    if (position != p_dictionnaire.end() && estVide(position->second)) {
+        p_dictionnaire.erase(position);
+    }
+}
+
+template <typename Valeur>
+bool dictionnaireValide(const vector<pair<Valeur, Mots>>& p_dictionnaire)
+{
+    return none_of(p_dictionnaire.begin(), p_dictionnaire.end(),
+                   [](const pair<Valeur, Mots>& p_entree) { return estVide(p_entree.second); })
+           && adjacent_find(p_dictionnaire.begin(), p_dictionnaire.end(),
+                            [](const pair<Valeur, Mots>& p_gauche, const pair<Valeur, Mots>& p_droite) {
+                                return !(p_gauche.first < p_droite.first);
+                            }) == p_dictionnaire.end();
+}
+
+} // namespace
+
+/**
+ * \brief Ne retient que les vêtements.
+ *
+ * \return Le filtre.
+ */
+FiltreAttributs& FiltreAttributs::vetements()
+{
+    m_vetements = true;
+    return *this;
+}
+
+/**
+ * \brief Ne retient que les produits électroniques.
+ *
+ * \return Le filtre.
+ */
+FiltreAttributs& FiltreAttributs::electroniques()
+{
+    m_electroniques = true;
+    return *this;
+}
+
+/**
+ * \brief Accepte, en plus des tailles déjà demandées, les vêtements d'une taille.
+ *
+ * \param[in] p_taille Taille standard (XS, S, M, L, XL, XXL).
+ * \return Le filtre.
+ *
+ * \pre p_taille est une taille standard.
+ */
+FiltreAttributs& FiltreAttributs::taille(const string& p_taille)
+{
+    size_t numero = numeroTaille(p_taille);
+    PRECONDITION(numero < size(TAILLES));
+
+    m_tailles |= static_cast<uint8_t>(1u << numero);
+    return *this;
+}
+
+/**
+ * \brief Accepte, en plus des couleurs déjà demandées, les vêtements d'une couleur.
+ *
+ *        La couleur est comparée exactement, majuscules comprises.
+ *
+ * \param[in] p_couleur Couleur recherchée.
+ * \return Le filtre.
+ *
+ * \pre p_couleur n'est pas vide.
+ */
+FiltreAttributs& FiltreAttributs::couleur(const string& p_couleur)
+{
+    PRECONDITION(!p_couleur.empty());
+
+    if (find(m_couleurs.begin(), m_couleurs.end(), p_couleur) == m_couleurs.end()) {
+        m_couleurs.push_back(p_couleur);
+    }
+    return *this;
+}
+
+/**
+ * \brief Ne retient que les produits électroniques reconditionnés, ou que ceux qui ne le sont pas.
+ *
+ * \param[in] p_estReconditionne true pour les produits reconditionnés, false pour les produits neufs.
+ * \return Le filtre.
+ */
+FiltreAttributs& FiltreAttributs::reconditionne(bool p_estReconditionne)
+{
+    m_filtreReconditionnement = true;
+    m_estReconditionne = p_estReconditionne;
+    return *this;
+}
+
+/**
+ * \brief Ne retient que les produits électroniques garantis au moins un nombre de mois.
+ *
+ * \param[in] p_mois Durée minimale de la garantie, en mois.
+ * \return Le filtre.
+ *
+ * \pre p_mois >= 0
+ */
+FiltreAttributs& FiltreAttributs::garantieMinimale(int p_mois)
+{
+    PRECONDITION(p_mois >= 0);
+
+    m_filtreGarantie = true;
+    m_garantieMinimale = p_mois;
+    return *this;
+}
+
+/**
+ * \brief Retourne les tailles acceptées : le bit i pour la i-ème taille de XS à XXL, aucun si toutes le sont.
+ */
+uint8_t FiltreAttributs::reqTailles() const
+{
+    return m_tailles;
+}
+
+/**
+ * \brief Retourne les couleurs acceptées, aucune si toutes le sont.
+ */
+const vector<string>& FiltreAttributs::reqCouleurs() const
+{
+    return m_couleurs;
+}
+
+/**
+ * \brief Indique si le filtre ne retient que des vêtements : vetements(), une taille ou une couleur.
+ */
+bool FiltreAttributs::concerneVetements() const
+{
+    return m_vetements || m_tailles != 0 || !m_couleurs.empty();
+}
+
+/**
+ * \brief Indique si le filtre ne retient que des produits électroniques : electroniques(),
+ *        le reconditionnement ou la garantie.
+ */
+bool FiltreAttributs::concerneElectroniques() const
+{
+    return m_electroniques || m_filtreReconditionnement || m_filtreGarantie;
+}
+
+/**
+ * \brief Indique si le filtre n'a aucun critère, et accepte donc tous les produits.
+ */
+bool FiltreAttributs::estVide() const
+{
+    return !concerneVetements() && !concerneElectroniques();
+}
+
+/**
+ * \brief Indique si le filtre porte sur le reconditionnement (voir reqEstReconditionne()).
+ */
+bool FiltreAttributs::filtreReconditionnement() const
+{
+    return m_filtreReconditionnement;
+}
+
+/**
+ * \brief Retourne l'état de reconditionnement demandé, si filtreReconditionnement().
+ */
+bool FiltreAttributs::reqEstReconditionne() const
+{
+    return m_estReconditionne;
+}
+
+/**
+ * \brief Retourne la durée minimale de garantie demandée, en mois; 0 sans critère de garantie.
+ */
+int FiltreAttributs::reqGarantieMinimale() const
+{
+    return m_garantieMinimale;
+}
+
+/**
+ * \brief Indexe un produit au rang qui suit le dernier.
+ *
+ * \param[in] p_produit Produit ajouté au bloc.
+ *
+ * \pre Le bloc contient moins de CAPACITE produits.
+ */
+void IndexAttributs::ajouter(const Produit& p_produit)
+{
+    PRECONDITION(m_nbProduits < CAPACITE);
+
+    size_t rang = m_nbProduits++;
+    if (const auto* vetement = dynamic_cast<const Vetement*>(&p_produit)) {
+        poserBit(m_vetements, rang);
+        size_t numero = numeroTaille(vetement->reqTaille());
+        if (numero < NB_TAILLES) {
+            poserBit(m_tailles[numero], rang);
+        }
+        poserBit(entree(m_couleurs, vetement->reqCouleur()), rang);
+    }
+    else if (const auto* electronique = dynamic_cast<const Electronique*>(&p_produit)) {
+        poserBit(m_electroniques, rang);
+        if (electronique->reqEstReconditionne()) {
+            poserBit(m_reconditionnes, rang);
+        }
+        poserBit(entree(m_garanties, electronique->reqGarantieMois()), rang);
+    }
+    INVARIANTS();
+}
+
+/**
+ * \brief Donne à un rang les attributs d'un rang de ce bloc ou d'un autre, sans examiner le produit.
+ *
+ * \param[in] p_rang Rang remplacé, ou rang qui suit le dernier pour un ajout.
+ * \param[in] p_source Index du bloc d'origine, éventuellement celui-ci.
+ * \param[in] p_rangSource Rang d'origine.
+ *
+ * \pre p_rang < reqNombreProduits(), ou p_rang == reqNombreProduits() < CAPACITE
+ * \pre p_rangSource < p_source.reqNombreProduits()
+ */
+void IndexAttributs::copier(size_t p_rang, const IndexAttributs& p_source, size_t p_rangSource)
+{
+    PRECONDITION(p_rang < m_nbProduits || (p_rang == m_nbProduits && m_nbProduits < CAPACITE));
+    PRECONDITION(p_rangSource < p_source.m_nbProduits);
+
+    if (&p_source == this && p_rang == p_rangSource) {
+        return;
+    }
+    if (p_rang == m_nbProduits) {
+        ++m_nbProduits;
+    }
+    else {
+        effacer(p_rang);
+    }
+
+    if (lireBit(p_source.m_vetements, p_rangSource)) {
+        poserBit(m_vetements, p_rang);
+        for (size_t numero = 0; numero < NB_TAILLES; ++numero) {
+            if (lireBit(p_source.m_tailles[numero], p_rangSource)) {
+                poserBit(m_tailles[numero], p_rang);
+            }
+        }
+        string couleur = entreeDuRang(p_source.m_couleurs, p_rangSource)->first;
+        poserBit(entree(m_couleurs, couleur), p_rang);
+    }
+    if (lireBit(p_source.m_electroniques, p_rangSource)) {
+        poserBit(m_electroniques, p_rang);
+        if (lireBit(p_source.m_reconditionnes, p_rangSource)) {
+            poserBit(m_reconditionnes, p_rang);
+        }
+        int garantie = entreeDuRang(p_source.m_garanties, p_rangSource)->first;
+        poserBit(entree(m_garanties, garantie), p_rang);
+    }
+    INVARIANTS();
+}
+
+/**
+ * \brief Retire le produit d'un rang : les produits suivants reculent d'un rang.
+ *
+ * \pre p_rang < reqNombreProduits()
+ */
+void IndexAttributs::retirer(size_t p_rang)
+{
+    PRECONDITION(p_rang < m_nbProduits);
+
+    decaler(m_vetements, p_rang);
+    for (Bitmap& bitmapTaille : m_tailles) {
+        decaler(bitmapTaille, p_rang);
+    }
+    decaler(m_electroniques, p_rang);
+    decaler(m_reconditionnes, p_rang);
+    retirerRang(m_couleurs, p_rang);
+    retirerRang(m_garanties, p_rang);
+    --m_nbProduits;
+    INVARIANTS();
+}
+
+/**
+ * \brief Ne garde que les premiers produits du bloc.
+ *
+ * \param[in] p_nbProduits Nombre de produits gardés.
+ *
+ * \pre p_nbProduits <= reqNombreProduits()
+ */
+void IndexAttributs::tronquer(size_t p_nbProduits)
+{
+    PRECONDITION(p_nbProduits <= m_nbProduits);
+
+    for (size_t rang = p_nbProduits; rang < m_nbProduits; ++rang) {
+        effacer(rang);
+    }
+    m_nbProduits = p_nbProduits;
+    INVARIANTS();
+}
+
+/**
+ * \brief Ajoute à p_rangs, en ordre croissant, les rangs des produits qui satisfont un filtre.
+ */
+void IndexAttributs::selectionner(const FiltreAttributs& p_filtre, vector<size_t>& p_rangs) const
+{
+    ajouterRangs(bitmap(p_filtre), p_rangs);
+}
+
+/**
+ * \brief Retourne le nombre de produits du bloc qui satisfont un filtre, sans les énumérer.
+ */
+size_t IndexAttributs::compter(const FiltreAttributs& p_filtre) const
+{
+    Bitmap resultat = bitmap(p_filtre);
+    size_t nombre = 0;
+    for (uint64_t mot : resultat) {
+        nombre += static_cast<size_t>(__builtin_popcountll(mot));
+    }
+    return nombre;
+}
+
+/**
+ * \brief Retourne le nombre de produits indexés.
+ */
+size_t IndexAttributs::reqNombreProduits() const
+{
+    return m_nbProduits;
+}
+
+/**
+ * \brief Calcule le bitmap des rangs qui satisfont un filtre.
+ *
+ * \return Le bitmap, dont seuls les bits des rangs occupés peuvent être posés.
+ */
+IndexAttributs::Bitmap IndexAttributs::bitmap(const FiltreAttributs& p_filtre) const
+{
+    Bitmap resultat{};
+    if (p_filtre.concerneVetements() && p_filtre.concerneElectroniques()) {
+        return resultat;
+    }
+
+    if (p_filtre.concerneVetements()) {
+        if (p_filtre.reqTailles() == 0) {
+            resultat = m_vetements;
+        }
+        for (size_t numero = 0; numero < NB_TAILLES; ++numero) {
+            if (p_filtre.reqTailles() >> numero & 1) {
+                reunir(resultat, m_tailles[numero]);
+            }
+        }
+        if (!p_filtre.reqCouleurs().empty()) {
+            Bitmap couleurs{};
+            for (const string& couleur : p_filtre.reqCouleurs()) {
+                auto position = lower_bound(m_couleurs.begin(), m_couleurs.end(), couleur,
+                                            [](const pair<string, Bitmap>& p_entree, const string& p_cle) {
+                                                return p_entree.first < p_cle;
+                                            });
+                if (position != m_couleurs.end() && position->first == couleur) {
+                    reunir(couleurs, position->second);
+                }
+            }
+            intersecter(resultat, couleurs);
+        }
+    }
+    else if (p_filtre.concerneElectroniques()) {
+        resultat = m_electroniques;
+        if (p_filtre.filtreReconditionnement()) {
+            Bitmap etat = m_reconditionnes;
+            if (!p_filtre.reqEstReconditionne()) {
+                for (uint64_t& mot : etat) {
+                    mot = ~mot;
+                }
+            }
+            intersecter(resultat, etat);
+        }
+        if (p_filtre.reqGarantieMinimale() > 0) {
+            Bitmap garanties{};
+            auto debut = lower_bound(m_garanties.begin(), m_garanties.end(), p_filtre.reqGarantieMinimale(),
+                                     [](const pair<int, Bitmap>& p_entree, int p_cle) {
+                                         return p_entree.first < p_cle;
+                                     });
+            for (auto position = debut; position != m_garanties.end(); ++position) {
+                reunir(garanties, position->second);
+            }
+            intersecter(resultat, garanties);
+        }
+    }
+    else {
+        for (size_t numMot = 0; numMot < NB_MOTS; ++numMot) {
+            resultat[numMot] = ~uint64_t(0);
+        }
+        garderDebut(resultat, m_nbProduits);
+    }
+    return resultat;
+}
+
+/**
+ * \brief Indique si un bitmap marque un rang.
+ */
+bool IndexAttributs::contient(const Bitmap& p_bitmap, size_t p_rang)
+{
+    PRECONDITION(p_rang < CAPACITE);
+    return lireBit(p_bitmap, p_rang);
+}
+
+/**
+ * \brief Ajoute à p_rangs, en ordre croissant, les rangs marqués par un bitmap.
+ */
+void IndexAttributs::ajouterRangs(const Bitmap& p_bitmap, vector<size_t>& p_rangs)
+{
+    for (size_t numMot = 0; numMot < NB_MOTS; ++numMot) {
+        for (uint64_t mot = p_bitmap[numMot]; mot != 0; mot &= mot - 1) {
+            p_rangs.push_back(numMot * 64 + static_cast<size_t>(__builtin_ctzll(mot)));
+        }
+    }
+}
+
+/**
+ * \brief Efface tous les bits d'un rang.
+ */
+void IndexAttributs::effacer(size_t p_rang)
+{
+    effacerBit(m_vetements, p_rang);
+    for (Bitmap& bitmapTaille : m_tailles) {
+        effacerBit(bitmapTaille, p_rang);
+    }
+    effacerBit(m_electroniques, p_rang);
+    effacerBit(m_reconditionnes, p_rang);
+    effacerRang(m_couleurs, p_rang);
+    effacerRang(m_garanties, p_rang);
+}
+
+/**
+ * \brief Vérifie les invariants de la classe IndexAttributs.
+ *
+ * \invariant le bloc contient au plus CAPACITE produits
+ * \invariant les dictionnaires sont triés, sans doublon ni valeur sans rang
+ * \invariant aucun produit n'est reconditionné sans être électronique
+ * \invariant aucun produit n'a de taille sans être un vêtement
+ */
+void IndexAttributs::verifieInvariant() const
+{
+    INVARIANT(m_nbProduits <= CAPACITE);
+    INVARIANT(dictionnaireValide(m_couleurs));
+    INVARIANT(dictionnaireValide(m_garanties));
+    INVARIANT(equal(m_reconditionnes.begin(), m_reconditionnes.end(), m_electroniques.begin(),
+                    [](uint64_t p_reconditionnes, uint64_t p_electroniques) {
+                        return (p_reconditionnes & ~p_electroniques) == 0;
+                    }));
+    INVARIANT(all_of(m_tailles.begin(), m_tailles.end(), [this](const Bitmap& p_taille) {
+        return equal(p_taille.begin(), p_taille.end(), m_vetements.begin(),
+                     [](uint64_t p_bitsTaille, uint64_t p_vetements) { return (p_bitsTaille & ~p_vetements) == 0; });
+    }));
+}
+
+} // namespace commerce
@@ -0,0 +1,127 @@
+/**
+ * \file IndexAttributs.h
+ * \author Omar Mahamat
+ * \date 17 octobre 2026
+ * \brief Interface des classes FiltreAttributs et IndexAttributs
+ */
+
+#ifndef INDEXATTRIBUTS_H
+#define INDEXATTRIBUTS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace commerce
+{
+
+class Produit;
+
+/**
+ * \class FiltreAttributs
+ * \brief Critères sur les attributs propres aux vêtements et aux produits électroniques.
+ *
+ * Un filtre se compose par appels successifs, chacun retournant le filtre :
+ * FiltreAttributs().taille("XL").couleur("Noir") accepte les vêtements XL noirs, et
+ * FiltreAttributs().reconditionne(true).garantieMinimale(24) les produits électroniques
+ * reconditionnés garantis au moins 24 mois. Plusieurs tailles ou plusieurs couleurs
+ * s’additionnent (l’une ou l’autre); des critères différents doivent tous être satisfaits.
+ *
+ * Les critères de taille et de couleur ne retiennent que des vêtements, ceux de
+ * reconditionnement et de garantie que des produits électroniques : un filtre qui mêle
+ * les deux n’accepte aucun produit, et un filtre sans critère les accepte tous.
+ * vetements() et electroniques() ne retiennent qu’un type, sans autre critère.
+ */
+class FiltreAttributs
+{
+public:
+    FiltreAttributs& vetements();
+    FiltreAttributs& electroniques();
+    FiltreAttributs& taille(const std::string& p_taille);
+    FiltreAttributs& couleur(const std::string& p_couleur);
+    FiltreAttributs& reconditionne(bool p_estReconditionne);
+    FiltreAttributs& garantieMinimale(int p_mois);
+
+    std::uint8_t reqTailles() const;
+    const std::vector<std::string>& reqCouleurs() const;
+    bool concerneVetements() const;
+    bool concerneElectroniques() const;
+    bool estVide() const;
+    bool filtreReconditionnement() const;
+    bool reqEstReconditionne() const;
+    int reqGarantieMinimale() const;
+
+private:
+    bool m_vetements = false;
+    bool m_electroniques = false;
+    std::uint8_t m_tailles = 0;
+    std::vector<std::string> m_couleurs;
+    bool m_filtreReconditionnement = false;
+    bool m_estReconditionne = false;
+    bool m_filtreGarantie = false;
+    int m_garantieMinimale = 0;
+};
+
+/**
+ * \class IndexAttributs
+ * \brief Index bitmap des attributs des produits d’un bloc du catalogue.
+ *
+ * Le bloc contient au plus CAPACITE produits, désignés par leur rang. Pour chaque valeur
+ * d’attribut, un bitmap marque les rangs des produits qui la possèdent :
+ * - une pour les vêtements, et une par taille standard (XS, S, M, L, XL, XXL) : un
+ *   vêtement d’une autre taille, qu’un fichier chargé sans validation peut contenir,
+ *   n’est retenu par aucun critère de taille, mais reste un vêtement ;
+ * - une par couleur présente dans le bloc, dans un dictionnaire trié propre au bloc ;
+ * - une pour les produits électroniques, une pour ceux qui sont reconditionnés ;
+ * - une par durée de garantie présente dans le bloc, dans un dictionnaire trié par durée :
+ *   une garantie minimale réunit les bitmaps des durées qui suivent la borne.
+ *
+ * Appliquer un filtre revient à réunir puis intersecter des bitmaps mot par mot, des
+ * boucles fixes de CAPACITE / 64 mots que le compilateur vectorise; seul le type du
+ * produit ajouté ou remplacé est examiné (dynamic_cast), jamais celui des produits d’un
+ * bloc filtré. Le bitmap résultant peut aussi être combiné avec d’autres critères
+ * (voir Catalogue::executerRequete()).
+ */
+class IndexAttributs
+{
+public:
+    static constexpr std::size_t CAPACITE = 1024;
+    using Bitmap = std::array<std::uint64_t, CAPACITE / 64>;
+
+    void ajouter(const Produit& p_produit);
+    void copier(std::size_t p_rang, const IndexAttributs& p_source, std::size_t p_rangSource);
+    void retirer(std::size_t p_rang);
+    void tronquer(std::size_t p_nbProduits);
+
+    Bitmap bitmap(const FiltreAttributs& p_filtre) const;
+    void selectionner(const FiltreAttributs& p_filtre, std::vector<std::size_t>& p_rangs) const;
+    std::size_t compter(const FiltreAttributs& p_filtre) const;
+    std::size_t reqNombreProduits() const;
+
+    static bool contient(const Bitmap& p_bitmap, std::size_t p_rang);
+    static void ajouterRangs(const Bitmap& p_bitmap, std::vector<std::size_t>& p_rangs);
+
+private:
+    static constexpr std::size_t NB_MOTS = CAPACITE / 64;
+    static constexpr std::size_t NB_TAILLES = 6;
+    template <typename Valeur>
+    using Dictionnaire = std::vector<std::pair<Valeur, Bitmap>>;
+
+    std::size_t m_nbProduits = 0;
+    Bitmap m_vetements{};
+    std::array<Bitmap, NB_TAILLES> m_tailles{};
+    Dictionnaire<std::string> m_couleurs;
+    Bitmap m_electroniques{};
+    Bitmap m_reconditionnes{};
+    Dictionnaire<int> m_garanties;
+
+    void effacer(std::size_t p_rang);
+    void verifieInvariant() const;
+};
+
+} // namespace commerce
+
+#endif /* INDEXATTRIBUTS_H */
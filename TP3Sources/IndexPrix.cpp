@@ -0,0 +1,247 @@
+/**
+ * \file IndexPrix.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe IndexPrix
+ */
+
+#include "IndexPrix.h"
+#include "ContratException.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+using util::CodeProduit;
+
+namespace commerce
+{
+
+namespace
+{
+
+// Taille minimale du vecteur d'ajouts avant fusion
+const size_t TAILLE_MIN_AJOUTS = 256;
+
+/**
+ * \brief Ordre de l'index : par prix, puis par code à prix égal.
+ */
+bool precede(const IndexPrix::Entree& p_a, const IndexPrix::Entree& p_b)
+{
+    return p_a.prix < p_b.prix || (p_a.prix == p_b.prix && p_a.code < p_b.code);
+}
+
+bool prixInferieur(const IndexPrix::Entree& p_entree, double p_prix)
+{
+    return p_entree.prix < p_prix;
+}
+
+bool prixSuperieur(double p_prix, const IndexPrix::Entree& p_entree)
+{
+    return p_prix < p_entree.prix;
+}
+
+/**
+ * \brief Recueille, dans l'ordre p_avant, les produits de deux suites triées.
+ *
+ *        Les pierres tombales sont sautées. Le parcours s'arrête lorsque les deux
+ *        suites sont épuisées ou que p_limite produits ont été recueillis.
+ */
+template<typename Iterateur, typename Ordre>
+vector<const Produit*> recueillir(Iterateur p_a, Iterateur p_finA, Iterateur p_b, Iterateur p_finB,
+                                  size_t p_limite, Ordre p_avant)
+{
+    vector<const Produit*> produits;
+    while (produits.size() < p_limite) {
+        while (p_a != p_finA && p_a->produit == nullptr) {
+            ++p_a;
+        }
+        while (p_b != p_finB && p_b->produit == nullptr) {
+            ++p_b;
+        }
+        if (p_a == p_finA && p_b == p_finB) {
+            break;
+        }
+        if (p_b == p_finB || (p_a != p_finA && !p_avant(*p_b, *p_a))) {
+            produits.push_back(p_a->produit);
+            ++p_a;
+        }
+        else {
+            produits.push_back(p_b->produit);
+            ++p_b;
+        }
+    }
+    return produits;
+}
+
+} // namespace
+
+/**
+ * \brief Construit l'index à partir des entrées de tous les produits, dans n'importe quel ordre.
+ *
+ * \param[in] p_entrees Une entrée par produit, sans pierre tombale.
+ */
+IndexPrix::IndexPrix(vector<Entree> p_entrees) : m_tries(std::move(p_entrees)), m_nbPierresTombales(0)
+{
+    sort(m_tries.begin(), m_tries.end(), precede);
+    INVARIANTS();
+}
+
+/**
+ * \brief Indexe un produit.
+ *
+ *        L'entrée est insérée dans le vecteur des ajouts, qui est fusionné avec le
+ *        vecteur principal lorsqu'il dépasse environ racine de N entrées.
+ *
+ * \param[in] p_entree Entrée du produit.
+ *
+ * \pre p_entree.produit n'est pas nul.
+ */
+void IndexPrix::ajouter(const Entree& p_entree)
+{
+    PRECONDITION(p_entree.produit != nullptr);
+
+    m_ajouts.insert(upper_bound(m_ajouts.begin(), m_ajouts.end(), p_entree, precede), p_entree);
+    size_t tailleMax = max(TAILLE_MIN_AJOUTS, static_cast<size_t>(sqrt(static_cast<double>(m_tries.size()))));
+    if (m_ajouts.size() > tailleMax) {
+        fusionner();
+    }
+    INVARIANTS();
+}
+
+/**
+ * \brief Retire un produit de l'index.
+ *
+ *        Dans le vecteur principal, l'entrée devient une pierre tombale.
+ *
+ * \param[in] p_prix Prix du produit au moment où il a été indexé.
+ * \param[in] p_code Code du produit au moment où il a été indexé.
+ *
+ * \pre Le produit est indexé avec ce prix et ce code.
+ */
+void IndexPrix::retirer(double p_prix, const CodeProduit& p_code)
+{
+    Entree cle{p_prix, p_code, nullptr};
+
+    auto ajout = lower_bound(m_ajouts.begin(), m_ajouts.end(), cle, precede);
+    if (ajout != m_ajouts.end() && !precede(cle, *ajout)) {
+        m_ajouts.erase(ajout);
+        INVARIANTS();
+        return;
+    }
+
+    auto entree = lower_bound(m_tries.begin(), m_tries.end(), cle, precede);
+    while (entree != m_tries.end() && !precede(cle, *entree) && entree->produit == nullptr) {
+        ++entree;
+    }
+    PRECONDITION(entree != m_tries.end() && !precede(cle, *entree));
+
+    entree->produit = nullptr;
+    ++m_nbPierresTombales;
+    if (m_nbPierresTombales > m_tries.size() / 4) {
+        fusionner();
+    }
+    INVARIANTS();
+}
+
+/**
+ * \brief Retourne les produits dont le prix est dans un intervalle, du moins cher au plus cher.
+ *
+ * \param[in] p_prixMin Prix minimal, inclus.
+ * \param[in] p_prixMax Prix maximal, inclus.
+ * \return Les produits, sans copie.
+ *
+ * \pre p_prixMin <= p_prixMax
+ */
+vector<const Produit*> IndexPrix::dansIntervalle(double p_prixMin, double p_prixMax) const
+{
+    PRECONDITION(p_prixMin <= p_prixMax);
+
+    auto debutTries = lower_bound(m_tries.begin(), m_tries.end(), p_prixMin, prixInferieur);
+    auto finTries = upper_bound(debutTries, m_tries.end(), p_prixMax, prixSuperieur);
+    auto debutAjouts = lower_bound(m_ajouts.begin(), m_ajouts.end(), p_prixMin, prixInferieur);
+    auto finAjouts = upper_bound(debutAjouts, m_ajouts.end(), p_prixMax, prixSuperieur);
+    return recueillir(debutTries, finTries, debutAjouts, finAjouts, numeric_limits<size_t>::max(), precede);
+}
+
+/**
+ * \brief Estime, sans les recueillir, le nombre de produits dont le prix est dans [p_prixMin, p_prixMax].
+ *
+ * Quatre recherches dichotomiques suffisent; les pierres tombales de l'intervalle sont
+ * comptées, si bien que l'estimation majore le nombre exact.
+ *
+ * \pre p_prixMin <= p_prixMax
+ */
+size_t IndexPrix::estimerDansIntervalle(double p_prixMin, double p_prixMax) const
+{
+    PRECONDITION(p_prixMin <= p_prixMax);
+
+    auto debutTries = lower_bound(m_tries.begin(), m_tries.end(), p_prixMin, prixInferieur);
+    auto finTries = upper_bound(debutTries, m_tries.end(), p_prixMax, prixSuperieur);
+    auto debutAjouts = lower_bound(m_ajouts.begin(), m_ajouts.end(), p_prixMin, prixInferieur);
+    auto finAjouts = upper_bound(debutAjouts, m_ajouts.end(), p_prixMax, prixSuperieur);
+    return static_cast<size_t>((finTries - debutTries) + (finAjouts - debutAjouts));
+}
+
+/**
+ * \brief Retourne au plus p_nombre produits, du moins cher au plus cher.
+ */
+vector<const Produit*> IndexPrix::moinsChers(size_t p_nombre) const
+{
+    return recueillir(m_tries.begin(), m_tries.end(), m_ajouts.begin(), m_ajouts.end(), p_nombre, precede);
+}
+
+/**
+ * \brief Retourne au plus p_nombre produits, du plus cher au moins cher.
+ */
+vector<const Produit*> IndexPrix::plusChers(size_t p_nombre) const
+{
+    return recueillir(m_tries.rbegin(), m_tries.rend(), m_ajouts.rbegin(), m_ajouts.rend(), p_nombre,
+                      [](const Entree& p_a, const Entree& p_b) { return precede(p_b, p_a); });
+}
+
+/**
+ * \brief Retourne le nombre de produits indexés.
+ */
+size_t IndexPrix::reqNombreProduits() const
+{
+    return m_tries.size() - m_nbPierresTombales + m_ajouts.size();
+}
+
+/**
+ * \brief Fusionne les ajouts avec le vecteur principal, en éliminant les pierres tombales.
+ */
+void IndexPrix::fusionner()
+{
+    vector<Entree> fusion;
+    fusion.reserve(reqNombreProduits());
+    auto ajout = m_ajouts.begin();
+    for (const Entree& entree : m_tries) {
+        if (entree.produit == nullptr) {
+            continue;
+        }
+        while (ajout != m_ajouts.end() && precede(*ajout, entree)) {
+            fusion.push_back(*ajout++);
+        }
+        fusion.push_back(entree);
+    }
+    fusion.insert(fusion.end(), ajout, m_ajouts.end());
+
+    m_tries = std::move(fusion);
+    m_ajouts.clear();
+    m_nbPierresTombales = 0;
+}
+
+/**
+ * \brief Vérifie les invariants de la classe IndexPrix.
+ *
+ * \invariant les pierres tombales comptées sont au plus aussi nombreuses que les entrées triées
+ * \invariant le vecteur des ajouts ne contient aucune pierre tombale
+ */
+void IndexPrix::verifieInvariant() const
+{
+    INVARIANT(m_nbPierresTombales <= m_tries.size());
+    INVARIANT(m_ajouts.empty() || m_ajouts.back().produit != nullptr);
+}
+
+} // namespace commerce
@@ -0,0 +1,70 @@
+/**
+ * \file IndexPrix.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe IndexPrix
+ */
+
+#ifndef INDEXPRIX_H
+#define INDEXPRIX_H
+
+#include <cstddef>
+#include <vector>
+#include "CodeProduit.h"
+
+namespace commerce
+{
+
+class Produit;
+
+/**
+ * \class IndexPrix
+ * \brief Index des produits d’un catalogue, trié par prix.
+ *
+ * Les entrées (prix, code, produit) sont rangées dans un vecteur trié par prix, puis par
+ * code à prix égal. Pour qu’une modification ne décale pas tout le vecteur :
+ * - un produit retiré laisse une pierre tombale (entrée sans produit) que les requêtes
+ *   sautent ; le vecteur est compacté quand elles en occupent le quart ;
+ * - un produit ajouté va d’abord dans un petit vecteur trié d’ajouts, d’environ
+ *   racine de N entrées, fusionné avec le vecteur principal quand il est plein.
+ * Les requêtes parcourent les deux vecteurs en parallèle, comme une fusion.
+ *
+ * L’index ne possède pas les produits : c’est le catalogue qui le tient à jour et qui
+ * garantit que chaque produit indexé existe.
+ */
+class IndexPrix
+{
+public:
+    /**
+     * \brief Un produit indexé ; produit est nul pour une pierre tombale.
+     */
+    struct Entree
+    {
+        double prix;
+        util::CodeProduit code;
+        const Produit* produit;
+    };
+
+    explicit IndexPrix(std::vector<Entree> p_entrees);
+
+    void ajouter(const Entree& p_entree);
+    void retirer(double p_prix, const util::CodeProduit& p_code);
+
+    std::vector<const Produit*> dansIntervalle(double p_prixMin, double p_prixMax) const;
+    std::size_t estimerDansIntervalle(double p_prixMin, double p_prixMax) const;
+    std::vector<const Produit*> moinsChers(std::size_t p_nombre) const;
+    std::vector<const Produit*> plusChers(std::size_t p_nombre) const;
+    std::size_t reqNombreProduits() const;
+
+private:
+    std::vector<Entree> m_tries;
+    std::vector<Entree> m_ajouts;
+    std::size_t m_nbPierresTombales;
+
+    void fusionner();
+    void verifieInvariant() const;
+};
+
+} // namespace commerce
+
+#endif /* INDEXPRIX_H */
@@ -0,0 +1,683 @@
+/**
+ * \file IndexTexte.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe IndexTexte
+ */
+
+#include "IndexTexte.h"
+#include "ContratException.h"
+#include "Produit.h"
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+using namespace std;
+
+namespace commerce
+{
+
+namespace
+{
+
+// Nombre minimal de produits en attente avant leur intégration à la liste compressée
+const size_t TAILLE_MIN_ATTENTE = 32;
+
+/**
+ * \brief Forme repliée des caractères U+00C0 à U+00FF (second octet 0x80 à 0xBF après 0xC3).
+ *
+ *        Une entrée nulle (× et ÷) sépare deux mots.
+ */
+const char* const LATIN1[64] = {
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+    "d", "n", "o", "o", "o", "o", "o", nullptr, "o", "u", "u", "u", "u", "y", "th", "ss",
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+    "d", "n", "o", "o", "o", "o", "o", nullptr, "o", "u", "u", "u", "u", "y", "th", "y"
+};
+
+/**
+ * \brief Découpe un texte UTF-8 en mots repliés (minuscules, sans accents).
+ *
+ *        Les lettres et les chiffres forment les mots; la ponctuation ASCII, les espaces,
+ *        les caractères U+0080 à U+00BF (espace insécable, guillemets) et la ponctuation
+ *        générale U+2000 à U+206F (apostrophe typographique, tirets) les séparent. Les
+ *        autres caractères non ASCII sont gardés tels quels.
+ *
+ * \param[in] p_texte Texte à découper.
+ * \param[in] p_traiter Appelée pour chaque mot, avec true s’il est suivi d’une étoile.
+ */
+template<typename Traitement>
+void parcourirMots(string_view p_texte, Traitement p_traiter)
+{
+    string mot;
+    auto terminerMot = [&](bool p_etoile) {
+        if (!mot.empty()) {
+            p_traiter(std::move(mot), p_etoile);
+            mot.clear();
+        }
+    };
+
+    size_t i = 0;
+    while (i < p_texte.size()) {
+        unsigned char octet = static_cast<unsigned char>(p_texte[i]);
+        if (octet < 0x80) {
+            if ((octet >= 'a' && octet <= 'z') || (octet >= '0' && octet <= '9')) {
+                mot += static_cast<char>(octet);
+            }
+            else if (octet >= 'A' && octet <= 'Z') {
+                mot += static_cast<char>(octet - 'A' + 'a');
+            }
+            else {
+                terminerMot(octet == '*');
+            }
+            ++i;
+            continue;
+        }
+
+        size_t longueur = octet >= 0xF0 ? 4 : octet >= 0xE0 ? 3 : octet >= 0xC0 ? 2 : 1;
+        longueur = min(longueur, p_texte.size() - i);
+        unsigned char suivant = longueur > 1 ? static_cast<unsigned char>(p_texte[i + 1]) : 0;
+        if (octet == 0xC3 && longueur == 2 && suivant >= 0x80 && suivant <= 0xBF) {
+            const char* replie = LATIN1[suivant - 0x80];
+            if (replie != nullptr) {
+                mot += replie;
+            }
+            else {
+                terminerMot(false);
+            }
+        }
+        else if (octet == 0xC5 && longueur == 2 && (suivant == 0x92 || suivant == 0x93)) {
+            mot += "oe";
+        }
+        else if (octet == 0xC5 && longueur == 2 && suivant == 0xB8) {
+            mot += "y";
+        }
+        else if ((octet == 0xC2 && longueur == 2) || (octet == 0xE2 && longueur == 3 && suivant >= 0x80 && suivant <= 0x81)) {
+            terminerMot(false);
+        }
+        else {
+            mot.append(p_texte.data() + i, longueur);
+        }
+        i += longueur;
+    }
+    terminerMot(false);
+}
+
+/**
+ * \brief Ajoute à p_octets un entier de longueur variable : 7 bits par octet, bit de poids fort à 1 sauf au dernier.
+ */
+void ecrireVarint(string& p_octets, uintptr_t p_valeur)
+{
+    while (p_valeur >= 0x80) {
+        p_octets += static_cast<char>((p_valeur & 0x7F) | 0x80);
+        p_valeur >>= 7;
+    }
+    p_octets += static_cast<char>(p_valeur);
+}
+
+/**
+ * \brief Retire p_valeur d’un vecteur trié, si elle y est.
+ *
+ * \return true si la valeur a été retirée.
+ */
+bool retirerSiPresent(vector<uintptr_t>& p_valeurs, uintptr_t p_valeur)
+{
+    auto position = lower_bound(p_valeurs.begin(), p_valeurs.end(), p_valeur);
+    if (position != p_valeurs.end() && *position == p_valeur) {
+        p_valeurs.erase(position);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * \brief Insère p_valeur dans un vecteur trié.
+ */
+void insererTrie(vector<uintptr_t>& p_valeurs, uintptr_t p_valeur)
+{
+    p_valeurs.insert(lower_bound(p_valeurs.begin(), p_valeurs.end(), p_valeur), p_valeur);
+}
+
+/**
+ * \brief Retourne les adresses de plusieurs listes triées, réunies, triées et sans doublon.
+ */
+vector<uintptr_t> reunir(const vector<vector<uintptr_t>>& p_listes)
+{
+    vector<uintptr_t> adresses;
+    for (const vector<uintptr_t>& liste : p_listes) {
+        adresses.insert(adresses.end(), liste.begin(), liste.end());
+    }
+    sort(adresses.begin(), adresses.end());
+    adresses.erase(unique(adresses.begin(), adresses.end()), adresses.end());
+    return adresses;
+}
+
+/**
+ * \brief Distance d’édition tolérée pour un mot de la requête, selon sa longueur.
+ *
+ *        Un mot de trois lettres ou moins doit être exact : à distance 1, il ressemble à
+ *        trop de mots. Une faute est tolérée jusqu’à sept lettres, deux au-delà.
+ */
+size_t distanceToleree(size_t p_longueur)
+{
+    return p_longueur <= 3 ? 0 : p_longueur <= 7 ? 1 : 2;
+}
+
+/**
+ * \brief Ne garde de p_resultats que les adresses aussi présentes dans p_autres, en ajoutant leurs distances.
+ *
+ *        Les deux vecteurs de couples (adresse, distance) sont triés par adresse.
+ */
+void intersecter(vector<pair<uintptr_t, size_t>>& p_resultats, const vector<pair<uintptr_t, size_t>>& p_autres)
+{
+    auto conserve = p_resultats.begin();
+    auto resultat = p_resultats.begin();
+    auto autre = p_autres.begin();
+    while (resultat != p_resultats.end() && autre != p_autres.end()) {
+        if (resultat->first < autre->first) {
+            ++resultat;
+        }
+        else if (autre->first < resultat->first) {
+            ++autre;
+        }
+        else {
+            *conserve++ = {resultat->first, resultat->second + autre->second};
+            ++resultat;
+            ++autre;
+        }
+    }
+    p_resultats.erase(conserve, p_resultats.end());
+}
+
+} // namespace
+
+/**
+ * \brief Construit l’index des descriptions de tous les produits.
+ *
+ *        Dans chaque tranche, chaque mot reçoit un numéro et chaque occurrence est notée
+ *        (numéro, adresse) dans un seul vecteur; les occurrences sont ensuite regroupées
+ *        par mot, et les mots triés, ce qui permet de les insérer sans chercher leur place.
+ *
+ * \param[in] p_produits Produits à indexer, distincts, dans n’importe quel ordre.
+ */
+IndexTexte::IndexTexte(const vector<const Produit*>& p_produits) : m_tranches(NB_TRANCHES)
+{
+    vector<unordered_map<string, size_t>> numerosParTranche(NB_TRANCHES);
+    vector<vector<pair<size_t, uintptr_t>>> occurrencesParTranche(NB_TRANCHES);
+    for (auto& numeros : numerosParTranche) {
+        numeros.reserve(p_produits.size() / NB_TRANCHES);
+    }
+    for (const Produit* produit : p_produits) {
+        uintptr_t adresse = reinterpret_cast<uintptr_t>(produit);
+        parcourirMots(produit->reqDescription(), [&](string&& p_mot, bool) {
+            size_t tranche = numeroTranche(p_mot);
+            size_t numeroMot = numerosParTranche[tranche].try_emplace(std::move(p_mot), numerosParTranche[tranche].size())
+                               .first->second;
+            occurrencesParTranche[tranche].emplace_back(numeroMot, adresse);
+        });
+    }
+
+    vector<size_t> debuts;
+    vector<uintptr_t> adresses;
+    for (size_t numero = 0; numero < NB_TRANCHES; ++numero) {
+        unordered_map<string, size_t> numeros = std::move(numerosParTranche[numero]);
+        vector<pair<size_t, uintptr_t>> occurrences = std::move(occurrencesParTranche[numero]);
+
+        debuts.assign(numeros.size() + 1, 0);
+        for (const auto& occurrence : occurrences) {
+            ++debuts[occurrence.first + 1];
+        }
+        for (size_t i = 1; i < debuts.size(); ++i) {
+            debuts[i] += debuts[i - 1];
+        }
+        adresses.resize(occurrences.size());
+        for (const auto& occurrence : occurrences) {
+            adresses[debuts[occurrence.first]++] = occurrence.second;
+        }
+
+        vector<const pair<const string, size_t>*> mots;
+        mots.reserve(numeros.size());
+        for (const auto& entree : numeros) {
+            mots.push_back(&entree);
+        }
+        sort(mots.begin(), mots.end(), [](const auto* p_a, const auto* p_b) { return p_a->first < p_b->first; });
+
+        m_tranches[numero] = make_shared<Tranche>();
+        Tranche& tranche = *m_tranches[numero];
+        vector<string_view> motsTries;
+        motsTries.reserve(mots.size());
+        vector<uintptr_t> adressesDuMot;
+        for (const auto* mot : mots) {
+            size_t fin = debuts[mot->second];
+            size_t debut = mot->second == 0 ? 0 : debuts[mot->second - 1];
+            adressesDuMot.assign(adresses.begin() + debut, adresses.begin() + fin);
+            sort(adressesDuMot.begin(), adressesDuMot.end());
+            adressesDuMot.erase(unique(adressesDuMot.begin(), adressesDuMot.end()), adressesDuMot.end());
+            Liste& liste = tranche.mots.emplace_hint(tranche.mots.end(), mot->first, Liste())->second;
+            liste.compresser(adressesDuMot);
+            liste.numeroMot = static_cast<uint32_t>(motsTries.size());
+            motsTries.push_back(mot->first);
+        }
+        tranche.trigrammes = IndexTrigrammes(motsTries);
+    }
+    INVARIANTS();
+}
+
+/**
+ * \brief Indexe la description d’un produit.
+ *
+ * \param[in] p_produit Produit qui n’est pas déjà indexé.
+ */
+void IndexTexte::ajouter(const Produit& p_produit)
+{
+    uintptr_t adresse = reinterpret_cast<uintptr_t>(&p_produit);
+    for (string& mot : extraireMots(p_produit.reqDescription())) {
+        Tranche& tranche = trancheModifiable(mot);
+        auto [entree, nouveau] = tranche.mots.try_emplace(std::move(mot));
+        Liste& liste = entree->second;
+        if (nouveau) {
+            liste.numeroMot = tranche.trigrammes.ajouter(entree->first);
+        }
+        if (!retirerSiPresent(liste.retraits, adresse)) {
+            insererTrie(liste.ajouts, adresse);
+        }
+        if (liste.ajouts.size() + liste.retraits.size() > max(TAILLE_MIN_ATTENTE, liste.nbCompresses / 8)) {
+            liste.integrer();
+        }
+        INVARIANT(trancheDuMotValide(entree->first));
+    }
+}
+
+/**
+ * \brief Retire un produit de l’index.
+ *
+ * \param[in] p_produit Produit indexé; sa description n’a pas changé depuis.
+ *
+ * \pre Chaque mot de la description est indexé.
+ */
+void IndexTexte::retirer(const Produit& p_produit)
+{
+    vector<string> mots = extraireMots(p_produit.reqDescription());
+    PRECONDITION(all_of(mots.begin(), mots.end(),
+                        [this](const string& p_mot) { return m_tranches[numeroTranche(p_mot)]->mots.count(p_mot) > 0; }));
+
+    uintptr_t adresse = reinterpret_cast<uintptr_t>(&p_produit);
+    for (const string& mot : mots) {
+        Tranche& tranche = trancheModifiable(mot);
+        auto entree = tranche.mots.find(mot);
+        Liste& liste = entree->second;
+        if (!retirerSiPresent(liste.ajouts, adresse)) {
+            insererTrie(liste.retraits, adresse);
+        }
+        if (liste.estVide()) {
+            tranche.trigrammes.retirer(liste.numeroMot);
+            tranche.mots.erase(entree);
+        }
+        else if (liste.ajouts.size() + liste.retraits.size() > max(TAILLE_MIN_ATTENTE, liste.nbCompresses / 8)) {
+            liste.integrer();
+        }
+        INVARIANT(trancheDuMotValide(mot));
+    }
+}
+
+/**
+ * \brief Retourne les produits qui répondent à une requête.
+ *
+ *        La requête est découpée en mots comme les descriptions; un mot suivi de « * »
+ *        est un préfixe. Une requête sans mot ne retourne rien.
+ *
+ * \param[in] p_requete Mots recherchés, par exemple « ecran 4k » ou « chauss* ».
+ * \param[in] p_operateur ET pour exiger tous les mots, OU pour en exiger au moins un.
+ * \return Les produits, sans doublon, triés par adresse.
+ */
+vector<const Produit*> IndexTexte::rechercher(string_view p_requete, Operateur p_operateur) const
+{
+    vector<vector<uintptr_t>> listes;
+    parcourirMots(p_requete, [&](string&& p_mot, bool p_prefixe) {
+        listes.push_back(p_prefixe ? adressesDuPrefixe(p_mot) : adressesDuMot(p_mot));
+    });
+
+    vector<uintptr_t> adresses;
+    if (p_operateur == Operateur::OU) {
+        adresses = reunir(listes);
+    }
+    else if (!listes.empty()) {
+        sort(listes.begin(), listes.end(),
+             [](const vector<uintptr_t>& p_a, const vector<uintptr_t>& p_b) { return p_a.size() < p_b.size(); });
+        adresses = std::move(listes.front());
+        for (size_t i = 1; i < listes.size() && !adresses.empty(); ++i) {
+            auto fin = set_intersection(adresses.begin(), adresses.end(), listes[i].begin(), listes[i].end(),
+                                        adresses.begin());
+            adresses.erase(fin, adresses.end());
+        }
+    }
+
+    vector<const Produit*> produits;
+    produits.reserve(adresses.size());
+    for (uintptr_t adresse : adresses) {
+        produits.push_back(reinterpret_cast<const Produit*>(adresse));
+    }
+    return produits;
+}
+
+/**
+ * \brief Retourne les produits les plus proches d’un texte saisi, qui peut contenir des fautes.
+ *
+ *        Chaque mot du texte accepte les mots indexés à une distance d’édition tolérée
+ *        selon sa longueur; le dernier mot, peut-être en cours de frappe, accepte aussi
+ *        les mots qui commencent par lui. Un produit doit répondre à tous les mots; sa
+ *        distance est la somme, pour chaque mot du texte, de la plus petite distance à un
+ *        mot de sa description.
+ *
+ *        Un texte d’un seul mot, ce qui est le cas des premières frappes, lit les listes
+ *        de ses mots proches du plus proche au moins proche, et s’arrête dès p_nombre
+ *        produits trouvés : un préfixe d’une lettre désigne une grande partie des mots.
+ *
+ * \param[in] p_texte Texte saisi, par exemple « chemse lin » ou « casque sans f ».
+ * \param[in] p_nombre Nombre maximal de produits retournés.
+ * \return Au plus p_nombre produits, du plus proche au moins proche; à distance égale, dans un ordre non spécifié.
+ */
+vector<const Produit*> IndexTexte::rechercherApprox(string_view p_texte, size_t p_nombre) const
+{
+    vector<string> mots;
+    parcourirMots(p_texte, [&mots](string&& p_mot, bool) { mots.push_back(std::move(p_mot)); });
+    if (mots.empty() || p_nombre == 0) {
+        return {};
+    }
+    string dernier = std::move(mots.back());
+    mots.pop_back();
+
+    vector<pair<uintptr_t, size_t>> resultats;
+    if (mots.empty()) {
+        resultats = adressesProches(dernier, true, p_nombre);
+    }
+    else {
+        resultats = adressesProches(mots.front(), false);
+        for (size_t i = 1; i < mots.size() && !resultats.empty(); ++i) {
+            intersecter(resultats, adressesProches(mots[i], false));
+        }
+        if (!resultats.empty()) {
+            intersecter(resultats, adressesProches(dernier, true));
+        }
+    }
+
+    auto plusProche = [](const pair<uintptr_t, size_t>& p_a, const pair<uintptr_t, size_t>& p_b) {
+        return p_a.second < p_b.second;
+    };
+    size_t nombre = min(p_nombre, resultats.size());
+    partial_sort(resultats.begin(), resultats.begin() + nombre, resultats.end(), plusProche);
+
+    vector<const Produit*> produits;
+    produits.reserve(nombre);
+    for (size_t i = 0; i < nombre; ++i) {
+        produits.push_back(reinterpret_cast<const Produit*>(resultats[i].first));
+    }
+    return produits;
+}
+
+/**
+ * \brief Retourne le nombre de mots distincts indexés.
+ */
+size_t IndexTexte::reqNombreMots() const
+{
+    size_t nbMots = 0;
+    for (const auto& tranche : m_tranches) {
+        nbMots += tranche->mots.size();
+    }
+    return nbMots;
+}
+
+/**
+ * \brief Découpe un texte en mots distincts, en minuscules et sans accents.
+ *
+ * \param[in] p_texte Texte UTF-8, par exemple une description.
+ * \return Les mots, triés et sans doublon : « Écran LED, écran 4K » donne 4k, ecran et led.
+ */
+vector<string> IndexTexte::extraireMots(string_view p_texte)
+{
+    vector<string> mots;
+    parcourirMots(p_texte, [&mots](string&& p_mot, bool) { mots.push_back(std::move(p_mot)); });
+    sort(mots.begin(), mots.end());
+    mots.erase(unique(mots.begin(), mots.end()), mots.end());
+    return mots;
+}
+
+/**
+ * \brief Retourne la tranche d’un mot : elle ne dépend que de ses deux premiers octets.
+ */
+size_t IndexTexte::numeroTranche(string_view p_mot)
+{
+    size_t premier = p_mot.empty() ? 0 : static_cast<unsigned char>(p_mot[0]);
+    size_t second = p_mot.size() < 2 ? 0 : static_cast<unsigned char>(p_mot[1]);
+    return (premier * 37 + second) % NB_TRANCHES;
+}
+
+/**
+ * \brief Retourne, pour la modifier, la tranche d’un mot; une tranche partagée avec une copie est d’abord dupliquée.
+ */
+IndexTexte::Tranche& IndexTexte::trancheModifiable(string_view p_mot)
+{
+    shared_ptr<Tranche>& tranche = m_tranches[numeroTranche(p_mot)];
+    if (tranche.use_count() > 1) {
+        tranche = make_shared<Tranche>(*tranche);
+    }
+    return *tranche;
+}
+
+/**
+ * \brief Retourne les adresses des produits qui contiennent exactement un mot déjà replié.
+ */
+vector<uintptr_t> IndexTexte::adressesDuMot(string_view p_mot) const
+{
+    const auto& mots = m_tranches[numeroTranche(p_mot)]->mots;
+    auto entree = mots.find(p_mot);
+    return entree == mots.end() ? vector<uintptr_t>() : entree->second.decompresser();
+}
+
+/**
+ * \brief Retourne les adresses des produits qui contiennent un mot commençant par p_prefixe, sans doublon.
+ *
+ *        Un préfixe de deux lettres ou plus ne se trouve que dans une tranche; un préfixe
+ *        d’une lettre oblige à les parcourir toutes.
+ *
+ * \param[in] p_prefixe Préfixe déjà replié.
+ * \param[in] p_limite Nombre d’adresses au-delà duquel la lecture des listes s’arrête : les
+ *                     adresses lues sont alors retournées, une partie seulement des produits du préfixe.
+ */
+vector<uintptr_t> IndexTexte::adressesDuPrefixe(string_view p_prefixe, size_t p_limite) const
+{
+    size_t premiere = 0;
+    size_t fin = NB_TRANCHES;
+    if (p_prefixe.size() >= 2) {
+        premiere = numeroTranche(p_prefixe);
+        fin = premiere + 1;
+    }
+
+    vector<vector<uintptr_t>> listes;
+    size_t nbLues = 0;
+    for (size_t numero = premiere; numero < fin; ++numero) {
+        const auto& mots = m_tranches[numero]->mots;
+        for (auto entree = mots.lower_bound(p_prefixe);
+             entree != mots.end() && entree->first.compare(0, p_prefixe.size(), p_prefixe) == 0; ++entree) {
+            listes.push_back(entree->second.decompresser());
+            nbLues += listes.back().size();
+            if (nbLues >= p_limite) {
+                vector<uintptr_t> adresses = reunir(listes);
+                if (adresses.size() >= p_limite) {
+                    return adresses;
+                }
+                nbLues = adresses.size();
+            }
+        }
+    }
+    return reunir(listes);
+}
+
+/**
+ * \brief Retourne les adresses des produits qui contiennent un mot proche de p_mot, avec la plus petite distance.
+ *
+ *        Un mot trop court pour tolérer une faute est cherché tel quel, comme mot ou préfixe;
+ *        sinon, les trigrammes de chaque tranche donnent ses mots proches, dont les listes
+ *        sont lues du plus proche au moins proche.
+ *
+ * \param[in] p_mot Mot déjà replié.
+ * \param[in] p_prefixe true pour accepter aussi les mots qui commencent par un mot proche de p_mot.
+ * \param[in] p_limite Nombre d’adresses au-delà duquel la lecture des listes s’arrête : les
+ *                     adresses retournées sont alors parmi les plus proches, mais pas toutes.
+ * \return Les couples (adresse, distance), triés par adresse et sans doublon.
+ */
+vector<pair<uintptr_t, size_t>> IndexTexte::adressesProches(string_view p_mot, bool p_prefixe, size_t p_limite) const
+{
+    vector<pair<uintptr_t, size_t>> adresses;
+    size_t distanceMax = distanceToleree(p_mot.size());
+    if (distanceMax == 0) {
+        for (uintptr_t adresse : p_prefixe ? adressesDuPrefixe(p_mot, p_limite) : adressesDuMot(p_mot)) {
+            adresses.emplace_back(adresse, 0);
+        }
+        return adresses;
+    }
+
+    vector<pair<size_t, const Liste*>> listes;
+    for (const auto& tranche : m_tranches) {
+        for (const IndexTrigrammes::MotProche& proche : tranche->trigrammes.motsProches(p_mot, distanceMax, p_prefixe)) {
+            listes.emplace_back(proche.distance, &tranche->mots.find(proche.mot)->second);
+        }
+    }
+    sort(listes.begin(), listes.end());
+
+    auto dedoublonner = [&adresses]() {
+        sort(adresses.begin(), adresses.end());
+        adresses.erase(unique(adresses.begin(), adresses.end(),
+                              [](const auto& p_a, const auto& p_b) { return p_a.first == p_b.first; }),
+                       adresses.end());
+    };
+    for (const auto& [distance, liste] : listes) {
+        for (uintptr_t adresse : liste->decompresser()) {
+            adresses.emplace_back(adresse, distance);
+        }
+        if (adresses.size() >= p_limite) {
+            dedoublonner();
+            if (adresses.size() >= p_limite) {
+                return adresses;
+            }
+        }
+    }
+    dedoublonner();
+    return adresses;
+}
+
+/**
+ * \brief Retourne les adresses de la liste, triées : adresses compressées non retirées et adresses ajoutées.
+ */
+vector<uintptr_t> IndexTexte::Liste::decompresser() const
+{
+    vector<uintptr_t> adresses;
+    adresses.reserve(nbCompresses - retraits.size() + ajouts.size());
+
+    auto retrait = retraits.begin();
+    uintptr_t adresse = 0;
+    size_t i = 0;
+    while (i < compresse.size()) {
+        uintptr_t ecart = 0;
+        unsigned decalage = 0;
+        uint8_t octet;
+        do {
+            octet = static_cast<uint8_t>(compresse[i++]);
+            ecart |= static_cast<uintptr_t>(octet & 0x7F) << decalage;
+            decalage += 7;
+        } while (octet & 0x80);
+        adresse += ecart;
+
+        if (retrait != retraits.end() && *retrait == adresse) {
+            ++retrait;
+        }
+        else {
+            adresses.push_back(adresse);
+        }
+    }
+
+    size_t nbCompressesRestants = adresses.size();
+    adresses.insert(adresses.end(), ajouts.begin(), ajouts.end());
+    inplace_merge(adresses.begin(), adresses.begin() + nbCompressesRestants, adresses.end());
+    return adresses;
+}
+
+/**
+ * \brief Remplace la liste compressée par p_adresses, triées et sans doublon, et vide l’attente.
+ */
+void IndexTexte::Liste::compresser(const vector<uintptr_t>& p_adresses)
+{
+    compresse.clear();
+    uintptr_t precedente = 0;
+    for (uintptr_t adresse : p_adresses) {
+        ecrireVarint(compresse, adresse - precedente);
+        precedente = adresse;
+    }
+    compresse.shrink_to_fit();
+    nbCompresses = p_adresses.size();
+    ajouts.clear();
+    retraits.clear();
+}
+
+/**
+ * \brief Intègre les adresses ajoutées et retirées à la liste compressée.
+ */
+void IndexTexte::Liste::integrer()
+{
+    compresser(decompresser());
+}
+
+/**
+ * \brief Indique si tous les produits de la liste ont été retirés.
+ */
+bool IndexTexte::Liste::estVide() const
+{
+    return nbCompresses == retraits.size() && ajouts.empty();
+}
+
+/**
+ * \brief Indique si un mot est rangé dans la tranche p_numero avec une liste non vide,
+ *        qui ne retire pas plus d’adresses qu’elle n’en a de compressées.
+ */
+bool IndexTexte::motValide(const string& p_mot, const Liste& p_liste, size_t p_numero)
+{
+    return !p_mot.empty() && numeroTranche(p_mot) == p_numero && !p_liste.estVide()
+           && p_liste.retraits.size() <= p_liste.nbCompresses;
+}
+
+/**
+ * \brief Indique si les invariants tiennent pour la tranche d’un mot qui vient d’être ajouté
+ *        ou retiré : le mot, s’il y est encore, y est valide, et ses trigrammes sont à jour.
+ *
+ *        ajouter() et retirer() se contentent de cette vérification : parcourir toutes les
+ *        tranches après chaque modification rendrait leur coût proportionnel à la taille de l’index.
+ */
+bool IndexTexte::trancheDuMotValide(string_view p_mot) const
+{
+    size_t numero = numeroTranche(p_mot);
+    const Tranche& tranche = *m_tranches[numero];
+    auto entree = tranche.mots.find(p_mot);
+    return (entree == tranche.mots.end() || motValide(entree->first, entree->second, numero))
+           && tranche.trigrammes.reqNombreMots() == tranche.mots.size();
+}
+
+/**
+ * \brief Vérifie les invariants de la classe IndexTexte.
+ *
+ * \invariant il y a NB_TRANCHES tranches
+ * \invariant chaque mot est rangé dans sa tranche et n’a pas une liste vide
+ * \invariant chaque tranche indexe les trigrammes de tous ses mots, et seulement d’eux
+ * \invariant les adresses retirées sont au plus aussi nombreuses que les adresses compressées
+ */
+void IndexTexte::verifieInvariant() const
+{
+    INVARIANT(m_tranches.size() == NB_TRANCHES);
+    for (size_t numero = 0; numero < NB_TRANCHES; ++numero) {
+        INVARIANT(all_of(m_tranches[numero]->mots.begin(), m_tranches[numero]->mots.end(), [numero](const auto& p_entree) {
+            return motValide(p_entree.first, p_entree.second, numero);
+        }));
+        INVARIANT(m_tranches[numero]->trigrammes.reqNombreMots() == m_tranches[numero]->mots.size());
+    }
+}
+
+} // namespace commerce
@@ -0,0 +1,127 @@
+/**
+ * \file IndexTexte.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe IndexTexte
+ */
+
+#ifndef INDEXTEXTE_H
+#define INDEXTEXTE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "IndexTrigrammes.h"
+
+namespace commerce
+{
+
+class Produit;
+
+/**
+ * \class IndexTexte
+ * \brief Index inversé des mots des descriptions de produits.
+ *
+ * Chaque mot d’une description est ramené en minuscules et sans accents (« Écran » et
+ * « ecran » sont le même mot), puis associé à la liste des produits qui le contiennent,
+ * triée par adresse. Chaque liste est compressée : les écarts entre adresses successives
+ * sont écrits en entiers de longueur variable (7 bits par octet); les produits d’un
+ * catalogue étant voisins dans son arène, un écart tient souvent en un ou deux octets.
+ * Pour éviter de réécrire une liste à chaque modification, les produits ajoutés et
+ * retirés sont d’abord notés dans deux petits vecteurs triés, intégrés à la liste
+ * compressée lorsqu’ils en représentent le huitième.
+ *
+ * Les mots sont répartis en NB_TRANCHES tranches selon leurs deux premières lettres :
+ * une recherche par préfixe ne lit qu’une tranche, et les tranches sont partagées entre
+ * un index et ses copies jusqu’à leur première modification.
+ *
+ * Une requête est une suite de mots, combinés par ET ou par OU; un mot terminé par « * »
+ * désigne tous les mots qui commencent par ce préfixe.
+ *
+ * Chaque tranche tient aussi un IndexTrigrammes de ses mots : une recherche approchée
+ * accepte, pour chaque mot de la requête, les mots indexés à une petite distance d’édition,
+ * et classe les produits selon la somme de ces distances.
+ *
+ * Comme IndexPrix, l’index ne possède pas les produits : c’est le catalogue qui le tient
+ * à jour et qui garantit que chaque produit indexé existe.
+ */
+class IndexTexte
+{
+public:
+    /**
+     * \brief Combinaison des mots d’une requête.
+     *
+     * - ET : les produits qui contiennent tous les mots ;
+     * - OU : les produits qui contiennent au moins un des mots.
+     */
+    enum class Operateur { ET, OU };
+
+    explicit IndexTexte(const std::vector<const Produit*>& p_produits);
+
+    void ajouter(const Produit& p_produit);
+    void retirer(const Produit& p_produit);
+    std::vector<const Produit*> rechercher(std::string_view p_requete, Operateur p_operateur) const;
+    std::vector<const Produit*> rechercherApprox(std::string_view p_texte, std::size_t p_nombre) const;
+    std::size_t reqNombreMots() const;
+
+    static std::vector<std::string> extraireMots(std::string_view p_texte);
+
+private:
+    static constexpr std::size_t NB_TRANCHES = 256;
+
+    /**
+     * \brief Produits qui contiennent un mot, désignés par leur adresse.
+     *
+     * Les octets compressés sont rangés dans une std::string : la liste d’un mot
+     * qui n’apparaît que dans quelques produits tient dans la chaîne elle-même, sans allocation.
+     */
+    struct Liste
+    {
+        std::string compresse;
+        std::size_t nbCompresses = 0;
+        std::vector<std::uintptr_t> ajouts;
+        std::vector<std::uintptr_t> retraits;
+        std::uint32_t numeroMot = 0;
+
+        std::vector<std::uintptr_t> decompresser() const;
+        void compresser(const std::vector<std::uintptr_t>& p_adresses);
+        void integrer();
+        bool estVide() const;
+    };
+
+    /**
+     * \brief Mots dont les deux premières lettres mènent à la même tranche, et leurs trigrammes.
+     *
+     * Le numéro d’un mot dans trigrammes est noté dans sa liste.
+     */
+    struct Tranche
+    {
+        std::map<std::string, Liste, std::less<>> mots;
+        IndexTrigrammes trigrammes;
+    };
+
+    std::vector<std::shared_ptr<Tranche>> m_tranches;
+
+    static std::size_t numeroTranche(std::string_view p_mot);
+    Tranche& trancheModifiable(std::string_view p_mot);
+    std::vector<std::uintptr_t> adressesDuMot(std::string_view p_mot) const;
+    std::vector<std::uintptr_t> adressesDuPrefixe(std::string_view p_prefixe,
+                                                  std::size_t p_limite = std::numeric_limits<std::size_t>::max()) const;
+    std::vector<std::pair<std::uintptr_t, std::size_t>>
+    adressesProches(std::string_view p_mot, bool p_prefixe,
+                    std::size_t p_limite = std::numeric_limits<std::size_t>::max()) const;
+    static bool motValide(const std::string& p_mot, const Liste& p_liste, std::size_t p_numero);
+    bool trancheDuMotValide(std::string_view p_mot) const;
+    void verifieInvariant() const;
+};
+
+} // namespace commerce
+
+#endif /* INDEXTEXTE_H */
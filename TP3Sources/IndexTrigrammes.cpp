@@ -0,0 +1,313 @@
+/**
+ * \file IndexTrigrammes.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe IndexTrigrammes
+ */
+
+#include "IndexTrigrammes.h"
+#include "ContratException.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+
+namespace commerce
+{
+
+namespace
+{
+
+// Taille minimale du vecteur d'ajouts avant fusion
+const size_t TAILLE_MIN_AJOUTS = 64;
+
+// Octet de remplissage au début et à la fin des mots; il n'apparaît dans aucun mot indexé
+const unsigned char BORD = 0x01;
+
+/**
+ * \brief Entrée de l'index : le trigramme dans les 32 bits de poids fort, le numéro du mot dans les autres.
+ */
+uint64_t cle(uint32_t p_trigramme, uint32_t p_numero)
+{
+    return static_cast<uint64_t>(p_trigramme) << 32 | p_numero;
+}
+
+} // namespace
+
+/**
+ * \brief Construit l'index d'un ensemble de mots.
+ *
+ * \param[in] p_mots Mots distincts et non vides; chacun reçoit sa position pour numéro.
+ *
+ * \pre Aucun mot n'est vide.
+ */
+IndexTrigrammes::IndexTrigrammes(const vector<string_view>& p_mots)
+{
+    PRECONDITION(none_of(p_mots.begin(), p_mots.end(), [](string_view p_mot) { return p_mot.empty(); }));
+
+    m_mots.reserve(p_mots.size());
+    m_entrees.reserve(p_mots.size() * 8);
+    vector<uint32_t> trigrammesDuMot;
+    for (string_view mot : p_mots) {
+        uint32_t numero = static_cast<uint32_t>(m_mots.size());
+        m_mots.emplace_back(mot);
+        trigrammes(mot, false, trigrammesDuMot);
+        for (uint32_t trigramme : trigrammesDuMot) {
+            m_entrees.push_back(cle(trigramme, numero));
+        }
+    }
+    sort(m_entrees.begin(), m_entrees.end());
+    INVARIANTS();
+}
+
+/**
+ * \brief Indexe un mot.
+ *
+ * \param[in] p_mot Mot qui n'est pas déjà indexé.
+ * \return Le numéro du mot, à donner à retirer().
+ *
+ * \pre p_mot n'est pas vide.
+ */
+uint32_t IndexTrigrammes::ajouter(string_view p_mot)
+{
+    PRECONDITION(!p_mot.empty());
+
+    uint32_t numero;
+    if (m_libres.empty()) {
+        numero = static_cast<uint32_t>(m_mots.size());
+        m_mots.emplace_back(p_mot);
+    }
+    else {
+        numero = m_libres.back();
+        m_libres.pop_back();
+        m_mots[numero] = p_mot;
+    }
+
+    vector<uint32_t> trigrammesDuMot;
+    trigrammes(p_mot, false, trigrammesDuMot);
+    for (uint32_t trigramme : trigrammesDuMot) {
+        uint64_t entree = cle(trigramme, numero);
+        m_ajouts.insert(lower_bound(m_ajouts.begin(), m_ajouts.end(), entree), entree);
+    }
+    size_t tailleMax = max(TAILLE_MIN_AJOUTS, static_cast<size_t>(sqrt(static_cast<double>(m_entrees.size()))));
+    if (m_ajouts.size() > tailleMax) {
+        fusionner();
+    }
+    INVARIANT(m_nbEntreesMortes <= m_entrees.size());
+    return numero;
+}
+
+/**
+ * \brief Retire un mot de l'index.
+ *
+ *        Ses entrées du vecteur des ajouts sont effacées; celles du vecteur principal
+ *        restent jusqu'à la prochaine compaction, qui libère aussi son numéro.
+ *
+ * \param[in] p_numero Numéro retourné par ajouter() ou position donnée au constructeur.
+ *
+ * \pre Le mot de ce numéro est indexé.
+ */
+void IndexTrigrammes::retirer(uint32_t p_numero)
+{
+    PRECONDITION(p_numero < m_mots.size() && !m_mots[p_numero].empty());
+
+    vector<uint32_t> trigrammesDuMot;
+    trigrammes(m_mots[p_numero], false, trigrammesDuMot);
+    size_t nbMortes = 0;
+    for (uint32_t trigramme : trigrammesDuMot) {
+        uint64_t entree = cle(trigramme, p_numero);
+        auto ajout = lower_bound(m_ajouts.begin(), m_ajouts.end(), entree);
+        if (ajout != m_ajouts.end() && *ajout == entree) {
+            m_ajouts.erase(ajout);
+        }
+        else {
+            ++nbMortes;
+        }
+    }
+
+    m_mots[p_numero] = string();
+    (nbMortes == 0 ? m_libres : m_retires).push_back(p_numero);
+    m_nbEntreesMortes += nbMortes;
+    if (m_nbEntreesMortes > m_entrees.size() / 4) {
+        fusionner();
+    }
+    INVARIANT(m_mots[p_numero].empty());
+    INVARIANT(m_nbEntreesMortes <= m_entrees.size());
+}
+
+/**
+ * \brief Retourne les mots indexés à distance d'édition au plus p_distanceMax d'un mot.
+ *
+ *        Lorsque le mot a trop peu de trigrammes pour le seuil (mot court et distance
+ *        élevée), tous les mots sont comparés.
+ *
+ * \param[in] p_mot Mot cherché, replié comme les mots indexés.
+ * \param[in] p_distanceMax Distance d'édition maximale.
+ * \param[in] p_prefixe true pour comparer p_mot au début de chaque mot : « tabl » est à distance 0 de « tablette ».
+ * \return Les mots proches et leur distance, dans n'importe quel ordre.
+ */
+vector<IndexTrigrammes::MotProche> IndexTrigrammes::motsProches(string_view p_mot, size_t p_distanceMax,
+                                                                bool p_prefixe) const
+{
+    vector<MotProche> proches;
+    auto comparer = [&](uint32_t p_numero) {
+        const string& mot = m_mots[p_numero];
+        if (!mot.empty()) {
+            size_t ecart = distance(p_mot, mot, p_distanceMax, p_prefixe);
+            if (ecart <= p_distanceMax) {
+                proches.push_back({mot, ecart});
+            }
+        }
+    };
+
+    vector<uint32_t> trigrammesDuMot;
+    trigrammes(p_mot, p_prefixe, trigrammesDuMot);
+    if (trigrammesDuMot.size() <= 3 * p_distanceMax) {
+        for (uint32_t numero = 0; numero < m_mots.size(); ++numero) {
+            comparer(numero);
+        }
+        return proches;
+    }
+    size_t seuil = trigrammesDuMot.size() - 3 * p_distanceMax;
+
+    vector<uint32_t> numeros;
+    for (uint32_t trigramme : trigrammesDuMot) {
+        for (const vector<uint64_t>* entrees : {&m_entrees, &m_ajouts}) {
+            for (auto entree = lower_bound(entrees->begin(), entrees->end(), cle(trigramme, 0));
+                 entree != entrees->end() && *entree >> 32 == trigramme; ++entree) {
+                numeros.push_back(static_cast<uint32_t>(*entree));
+            }
+        }
+    }
+    sort(numeros.begin(), numeros.end());
+    for (size_t debut = 0; debut < numeros.size();) {
+        size_t fin = debut + 1;
+        while (fin < numeros.size() && numeros[fin] == numeros[debut]) {
+            ++fin;
+        }
+        if (fin - debut >= seuil) {
+            comparer(numeros[debut]);
+        }
+        debut = fin;
+    }
+    return proches;
+}
+
+/**
+ * \brief Retourne le nombre de mots indexés.
+ */
+size_t IndexTrigrammes::reqNombreMots() const
+{
+    return m_mots.size() - m_libres.size() - m_retires.size();
+}
+
+/**
+ * \brief Calcule la distance d'édition (Levenshtein) entre deux mots, bornée.
+ *
+ *        Le calcul ligne par ligne s'arrête dès que toute une ligne dépasse p_distanceMax.
+ *
+ * \param[in] p_mot Mot cherché.
+ * \param[in] p_autre Mot comparé.
+ * \param[in] p_distanceMax Distance au-delà de laquelle le calcul s'arrête.
+ * \param[in] p_prefixe true pour retourner la plus petite distance entre p_mot et un début de p_autre.
+ * \return La distance si elle est au plus p_distanceMax, p_distanceMax + 1 sinon.
+ */
+size_t IndexTrigrammes::distance(string_view p_mot, string_view p_autre, size_t p_distanceMax, bool p_prefixe)
+{
+    size_t depassement = p_distanceMax + 1;
+    if (p_prefixe) {
+        if (p_autre.size() + p_distanceMax < p_mot.size()) {
+            return depassement;
+        }
+        p_autre = p_autre.substr(0, p_mot.size() + p_distanceMax);
+    }
+    else if (max(p_mot.size(), p_autre.size()) - min(p_mot.size(), p_autre.size()) > p_distanceMax) {
+        return depassement;
+    }
+
+    vector<size_t> ligne(p_autre.size() + 1);
+    vector<size_t> suivante(p_autre.size() + 1);
+    iota(ligne.begin(), ligne.end(), 0);
+    for (size_t i = 1; i <= p_mot.size(); ++i) {
+        suivante[0] = i;
+        size_t minimum = i;
+        for (size_t j = 1; j <= p_autre.size(); ++j) {
+            size_t substitution = ligne[j - 1] + (p_mot[i - 1] == p_autre[j - 1] ? 0 : 1);
+            suivante[j] = min({ligne[j] + 1, suivante[j - 1] + 1, substitution});
+            minimum = min(minimum, suivante[j]);
+        }
+        if (minimum > p_distanceMax) {
+            return depassement;
+        }
+        ligne.swap(suivante);
+    }
+    size_t resultat = p_prefixe ? *min_element(ligne.begin(), ligne.end()) : ligne.back();
+    return min(resultat, depassement);
+}
+
+/**
+ * \brief Remplace p_trigrammes par les trigrammes distincts d'un mot, triés.
+ *
+ * \param[in] p_prefixe true pour omettre le caractère de fin : ce sont alors des trigrammes de tout mot qui commence par p_mot.
+ */
+void IndexTrigrammes::trigrammes(string_view p_mot, bool p_prefixe, vector<uint32_t>& p_trigrammes)
+{
+    size_t longueur = p_mot.size() + (p_prefixe ? 2 : 3);
+    auto octet = [&](size_t p_position) -> uint32_t {
+        return p_position < 2 || p_position - 2 >= p_mot.size() ? BORD
+                                                                 : static_cast<unsigned char>(p_mot[p_position - 2]);
+    };
+
+    p_trigrammes.clear();
+    for (size_t i = 0; i + 3 <= longueur; ++i) {
+        p_trigrammes.push_back(octet(i) << 16 | octet(i + 1) << 8 | octet(i + 2));
+    }
+    sort(p_trigrammes.begin(), p_trigrammes.end());
+    p_trigrammes.erase(unique(p_trigrammes.begin(), p_trigrammes.end()), p_trigrammes.end());
+}
+
+/**
+ * \brief Fusionne les ajouts avec le vecteur principal, en éliminant les entrées des mots retirés.
+ */
+void IndexTrigrammes::fusionner()
+{
+    vector<uint64_t> fusion;
+    fusion.reserve(m_entrees.size() - m_nbEntreesMortes + m_ajouts.size());
+    auto ajout = m_ajouts.begin();
+    for (uint64_t entree : m_entrees) {
+        if (m_mots[static_cast<uint32_t>(entree)].empty()) {
+            continue;
+        }
+        while (ajout != m_ajouts.end() && *ajout < entree) {
+            fusion.push_back(*ajout++);
+        }
+        fusion.push_back(entree);
+    }
+    fusion.insert(fusion.end(), ajout, m_ajouts.end());
+
+    m_entrees = std::move(fusion);
+    m_ajouts.clear();
+    m_nbEntreesMortes = 0;
+    m_libres.insert(m_libres.end(), m_retires.begin(), m_retires.end());
+    m_retires.clear();
+}
+
+/**
+ * \brief Vérifie les invariants de la classe IndexTrigrammes.
+ *
+ * \invariant les numéros libres ou retirés désignent des mots vides
+ * \invariant les entrées mortes sont au plus aussi nombreuses que les entrées du vecteur principal
+ *
+ * ajouter() et retirer() ne vérifient que ce qu'ils modifient : seul le numéro retiré
+ * rejoint les numéros libres ou retirés, et le parcours de tous ces numéros après
+ * chaque modification coûterait plus cher que la modification elle-même.
+ */
+void IndexTrigrammes::verifieInvariant() const
+{
+    INVARIANT(all_of(m_libres.begin(), m_libres.end(), [this](uint32_t p_numero) { return m_mots[p_numero].empty(); }));
+    INVARIANT(all_of(m_retires.begin(), m_retires.end(), [this](uint32_t p_numero) { return m_mots[p_numero].empty(); }));
+    INVARIANT(m_nbEntreesMortes <= m_entrees.size());
+}
+
+} // namespace commerce
@@ -0,0 +1,74 @@
+/**
+ * \file IndexTrigrammes.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe IndexTrigrammes
+ */
+
+#ifndef INDEXTRIGRAMMES_H
+#define INDEXTRIGRAMMES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace commerce
+{
+
+/**
+ * \class IndexTrigrammes
+ * \brief Index des trigrammes d’un ensemble de mots, pour retrouver les mots proches d’un mot mal orthographié.
+ *
+ * Chaque mot reçoit un numéro et est découpé en trigrammes, après deux caractères de
+ * début et un caractère de fin : « lin » donne « ␁␁l », « ␁li », « lin » et « in␁ ».
+ * Une modification (insertion, suppression ou substitution) touche au plus trois
+ * trigrammes; deux mots à distance d’édition d ont donc en commun au moins n − 3d des
+ * n trigrammes du premier. Les mots qui atteignent ce seuil sont les candidats, dont la
+ * distance est ensuite calculée, en s’arrêtant dès qu’elle dépasse le maximum demandé.
+ *
+ * Comme dans IndexPrix, les couples (trigramme, numéro) sont rangés dans un vecteur trié,
+ * avec un petit vecteur trié d’ajouts d’environ racine de N entrées; les entrées d’un mot
+ * retiré restent dans le vecteur principal jusqu’à sa compaction, et son numéro n’est
+ * réutilisé qu’après.
+ */
+class IndexTrigrammes
+{
+public:
+    /**
+     * \brief Un mot proche du mot cherché, valide tant que l’index n’est pas modifié.
+     */
+    struct MotProche
+    {
+        std::string_view mot;
+        std::size_t distance;
+    };
+
+    IndexTrigrammes() = default;
+    explicit IndexTrigrammes(const std::vector<std::string_view>& p_mots);
+
+    std::uint32_t ajouter(std::string_view p_mot);
+    void retirer(std::uint32_t p_numero);
+    std::vector<MotProche> motsProches(std::string_view p_mot, std::size_t p_distanceMax, bool p_prefixe) const;
+    std::size_t reqNombreMots() const;
+
+    static std::size_t distance(std::string_view p_mot, std::string_view p_autre, std::size_t p_distanceMax,
+                                bool p_prefixe);
+
+private:
+    std::vector<std::string> m_mots;
+    std::vector<std::uint32_t> m_libres;
+    std::vector<std::uint32_t> m_retires;
+    std::vector<std::uint64_t> m_entrees;
+    std::vector<std::uint64_t> m_ajouts;
+    std::size_t m_nbEntreesMortes = 0;
+
+    static void trigrammes(std::string_view p_mot, bool p_prefixe, std::vector<std::uint32_t>& p_trigrammes);
+    void fusionner();
+    void verifieInvariant() const;
+};
+
+} // namespace commerce
+
+#endif /* INDEXTRIGRAMMES_H */
@@ -9,6 +9,7 @@
 #include "Produit.h"
 #include <string>
 #include <sstream>
+#include "TamponTexte.h"
 
 using namespace std;
 
@@ -27,11 +28,12 @@ namespace commerce{
    * \pre util::validerCodeProduit(p_code)
    * \post m_description == p_description
    * \post m_prix == p_prix
-   * \post m_code == p_code
+   * \post m_code.reqTexte() == p_code
    */
     
     
-Produit::Produit(const std::string& p_description, double p_prix,const std::string& p_code):m_description(p_description), m_prix(p_prix), m_code(p_code)
+Produit::Produit(const std::string& p_description, double p_prix,const std::string& p_code):m_description(p_description), m_prix(p_prix),
+        m_code(util::CodeProduit::analyser(p_code).value_or(util::CodeProduit()))
 {
     PRECONDITION(!p_description.empty());
     PRECONDITION(p_prix >= 0);
@@ -39,7 +41,7 @@ Produit::Produit(const std::string& p_description, double p_prix,const std::stri
     
     POSTCONDITION(m_description == p_description);
     POSTCONDITION(m_prix == p_prix);
-    POSTCONDITION(m_code == p_code);
+    POSTCONDITION(m_code.reqTexte() == p_code);
     
     INVARIANTS();
     
@@ -76,13 +78,22 @@ Produit::~Produit()
  
   /**
    * \brief Retourne le code du produit
-   * \return Une référence constante vers le code du produit
+   * \return Le code du produit sous sa forme textuelle PRD-XXXX-NN
    */
  
-  const std::string& Produit::reqCode() const
+  std::string Produit::reqCode() const
  {
-      return m_code;
+      return m_code.reqTexte();
       
+ }
+
+  /**
+   * \brief Retourne le code compacté du produit
+   * \return Le code du produit, à utiliser pour les comparaisons et les index
+   */
+  util::CodeProduit Produit::reqCodeProduit() const
+ {
+      return m_code;
  }
   
   /**
@@ -102,10 +113,10 @@ Produit::~Produit()
      
      m_prix = p_prix;
      
-     m_code = util::genererCodeProduit(m_description, m_prix);
+     m_code = util::CodeProduit::generer(m_description, m_prix);
      
      POSTCONDITION(m_prix == p_prix);
-     POSTCONDITION(util::validerCodeProduit(m_code, m_description, m_prix));
+     POSTCONDITION(!m_code.estVide());
      
      INVARIANTS();
      
@@ -129,28 +140,87 @@ Produit::~Produit()
   /**
    * \brief Retourne une représentation textuelle formatée du produit
    *
+   *        Ne contient que les informations communes à tous les produits (voir
+   *        ecrireFormate()).
+   *
    * \return Une chaîne de caractères contenant la description formatée du produit
    */
  std::string Produit::reqProduitFormate() const{
-     ostringstream os;
-     os<< m_description<<endl;
-     os<< m_prix<<endl;
-     os<< m_code;
-     return os.str();
+     util::TamponTexte tampon;
+     Produit::ecrireFormate(tampon);
+     return tampon.prendreTexte();
      
  }
+
+  /**
+   * \brief Écrit la représentation textuelle formatée du produit dans un flux
+   *
+   *        Le texte est composé par ecrireFormate(util::TamponTexte&), selon le type
+   *        concret du produit, puis écrit d'un seul bloc dans le flux.
+   *
+   * \param[out] p_os flux qui reçoit le texte
+   */
+ void Produit::ecrireFormate(std::ostream& p_os) const{
+     util::TamponTexte tampon;
+     ecrireFormate(tampon);
+     p_os.write(tampon.reqTexte().data(), static_cast<std::streamsize>(tampon.reqTaille()));
+ }
+
+  /**
+   * \brief Ajoute la représentation textuelle formatée du produit à un tampon
+   *
+   *        Écrit la description, le prix et le code, un par ligne, sans saut de ligne
+   *        final. Les classes dérivées redéfinissent cette méthode pour ajouter leurs
+   *        informations propres ; Catalogue s'en sert pour composer son texte sans
+   *        passer par un flux.
+   *
+   * \param[out] p_tampon tampon qui reçoit le texte
+   */
+ void Produit::ecrireFormate(util::TamponTexte& p_tampon) const{
+     util::TamponCodeProduit code;
+     p_tampon.ajouter(m_description).ajouter('\n');
+     p_tampon.ajouterReel(m_prix).ajouter('\n');
+     p_tampon.ajouter(std::string_view(code.data(), m_code.ecrire(code)));
+ }
+  /**
+   * \brief Crée une copie du produit dans l'arène d'un catalogue
+   *
+   *        Cette version ne connaît pas le type concret du produit : elle se rabat
+   *        sur clone(), hors de l'arène. Electronique et Vetement la redéfinissent.
+   *
+   * \param[in,out] p_arena arène qui devrait recevoir la copie
+   * \return la copie du produit
+   */
+ std::shared_ptr<Produit> Produit::cloneDans([[maybe_unused]] ArenaProduits& p_arena) const{
+     return std::shared_ptr<Produit>(clone());
+ }
+
+  /**
+   * \brief Déplace le produit dans l'arène d'un catalogue
+   *
+   *        Les chaînes du produit sont reprises sans copie; le produit d'origine
+   *        ne peut ensuite qu'être détruit. Cette version se rabat sur cloneDans().
+   *
+   * \param[in,out] p_arena arène qui reçoit le produit
+   * \return le produit déplacé
+   */
+ std::shared_ptr<Produit> Produit::deplacerDans(ArenaProduits& p_arena){
+     return cloneDans(p_arena);
+ }
+
   /**
    * \brief Teste l'invariant de la classe Produit
    *
    *        L'invariant de cette classe s'assure que :
    *        - la description n'est pas vide ;
    *        - le prix est positif ou nul ;
-   *        - le code est valide selon util::validerCodeProduit.
+   *        - le code est non vide et correspond à celui généré pour la description et le prix.
    */
  void Produit::verifieInvariant() const{
     INVARIANT(!m_description.empty());
     INVARIANT(m_prix >= 0);
-    INVARIANT(util::validerCodeProduit(m_code, m_description, m_prix));
+    INVARIANT(!m_code.estVide());
+    INVARIANT(m_code == util::CodeProduit::generer(m_description, m_prix));
 
  } 
 } // namespace commerce
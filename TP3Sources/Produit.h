@@ -8,8 +8,11 @@
 
 #include <string>
 #include <memory>
+#include <ostream>
 #include "ContratException.h"
 #include "validationFormat.h"
+#include "CodeProduit.h"
+#include "TamponTexte.h"
 
 #ifndef PRODUIT_H
 #define PRODUIT_H
@@ -30,17 +33,30 @@
  * Concrètement, la classe Produit permet :
  * - d’accéder et de gérer les informations de base d’un produit (description, prix, code) ;
  * - de comparer deux produits entre eux ;
- * - de générer une version textuelle bien formatée du produit ;
- * - de créer des copies polymorphiques grâce à une méthode de clonage virtuelle pure.
+ * - de générer une version textuelle bien formatée du produit, sous forme de chaîne ou
+ *   directement dans un flux ou un util::TamponTexte (ecrireFormate(), que redéfinissent
+ *   les classes dérivées) ;
+ * - de créer des copies polymorphiques grâce à une méthode de clonage virtuelle pure ;
+ * - de copier ou de déplacer un produit dans l’arène d’un catalogue (cloneDans(),
+ *   deplacerDans()), ce que les classes dérivées redéfinissent pour y construire
+ *   directement un objet de leur type.
+ *
+ * La copie et le déplacement sont réservés aux classes dérivées, qui restent ainsi
+ * copiables et déplaçables sans risque de tronquer un produit par l’intermédiaire
+ * d’une référence à Produit.
  *
  * Les invariants de cette classe garantissent que :
  * - la description n’est jamais vide ;
  * - le prix est toujours positif ou égal à zéro ;
  * - le code produit est conforme au format attendu (défini dans validationFormat.h).
+ *
+ * Le code est conservé sous forme compactée (util::CodeProduit) : les comparaisons et
+ * les recherches par code se font sur un entier plutôt que sur une chaîne.
  */
 
 namespace commerce{
     
+class ArenaProduits;
     
 class Produit{
 public:
@@ -48,16 +64,26 @@ public:
     virtual ~Produit();
     const std::string& reqDescription() const;
     double reqPrix() const;
-    const std::string& reqCode() const;
+    std::string reqCode() const;
+    util::CodeProduit reqCodeProduit() const;
     
     void asgPrix(double p_prix);
     bool operator==(const Produit& p_produit) const;
     virtual std::string reqProduitFormate() const;
+    void ecrireFormate(std::ostream& p_os) const;
+    virtual void ecrireFormate(util::TamponTexte& p_tampon) const;
     virtual std::unique_ptr<Produit> clone() const = 0;
+    virtual std::shared_ptr<Produit> cloneDans(ArenaProduits& p_arena) const;
+    virtual std::shared_ptr<Produit> deplacerDans(ArenaProduits& p_arena);
+protected:
+    Produit(const Produit& p_produit) = default;
+    Produit(Produit&& p_produit) noexcept = default;
+    Produit& operator=(const Produit& p_produit) = default;
+    Produit& operator=(Produit&& p_produit) noexcept = default;
 private:
     std::string m_description;
     double m_prix;
-    std::string m_code;
+    util::CodeProduit m_code;
     void verifieInvariant() const; 
     
 };
@@ -0,0 +1,155 @@
+/**
+ * \file RequeteCatalogue.cpp
+ * \author Omar Mahamat
+ * \date 17 octobre 2026
+ * \brief Implémentation de la classe RequeteCatalogue
+ */
+
+#include "RequeteCatalogue.h"
+#include "ContratException.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace commerce
+{
+
+/**
+ * \brief Exige que la description des produits contienne tous les mots d'un texte.
+ *
+ *        Les mots sont comparés comme par Catalogue::rechercherProduits() : sans tenir
+ *        compte des majuscules ni des accents, et « chauss* » trouve tous les mots qui
+ *        commencent ainsi. Un texte sans aucun mot ne retient aucun produit.
+ *
+ * \param[in] p_mots Mots recherchés.
+ * \return La requête.
+ */
+RequeteCatalogue& RequeteCatalogue::texte(const string& p_mots)
+{
+    if (m_filtreTexte) {
+        m_texte += ' ';
+    }
+    m_texte += p_mots;
+    m_filtreTexte = true;
+    return *this;
+}
+
+/**
+ * \brief Exige que le prix des produits soit dans un intervalle, bornes incluses.
+ *
+ * \param[in] p_prixMin Prix minimal.
+ * \param[in] p_prixMax Prix maximal.
+ * \return La requête.
+ *
+ * \pre p_prixMin <= p_prixMax
+ */
+RequeteCatalogue& RequeteCatalogue::prixEntre(double p_prixMin, double p_prixMax)
+{
+    PRECONDITION(p_prixMin <= p_prixMax);
+
+    m_prixMin = m_filtrePrix ? max(m_prixMin, p_prixMin) : p_prixMin;
+    m_prixMax = m_filtrePrix ? min(m_prixMax, p_prixMax) : p_prixMax;
+    m_filtrePrix = true;
+    return *this;
+}
+
+/**
+ * \brief Exige que les attributs des produits satisfassent un filtre, qui remplace le précédent.
+ *
+ * \param[in] p_filtre Critères, par exemple FiltreAttributs().taille("XL") ou FiltreAttributs().electroniques().
+ * \return La requête.
+ */
+RequeteCatalogue& RequeteCatalogue::attributs(const FiltreAttributs& p_filtre)
+{
+    m_attributs = p_filtre;
+    return *this;
+}
+
+/**
+ * \brief Choisit l'ordre des produits retenus.
+ *
+ * \return La requête.
+ */
+RequeteCatalogue& RequeteCatalogue::trierPar(Tri p_tri)
+{
+    m_tri = p_tri;
+    return *this;
+}
+
+/**
+ * \brief Ne retient que les p_nombre premiers produits, dans l'ordre demandé.
+ *
+ * \return La requête.
+ */
+RequeteCatalogue& RequeteCatalogue::limiter(size_t p_nombre)
+{
+    m_limite = p_nombre;
+    return *this;
+}
+
+/**
+ * \brief Indique si la requête porte sur les mots de la description (voir reqTexte()).
+ */
+bool RequeteCatalogue::filtreTexte() const
+{
+    return m_filtreTexte;
+}
+
+/**
+ * \brief Retourne les mots exigés, ceux de tous les appels à texte() mis bout à bout.
+ */
+const string& RequeteCatalogue::reqTexte() const
+{
+    return m_texte;
+}
+
+/**
+ * \brief Indique si la requête porte sur le prix (voir reqPrixMin() et reqPrixMax()).
+ */
+bool RequeteCatalogue::filtrePrix() const
+{
+    return m_filtrePrix;
+}
+
+/**
+ * \brief Retourne le prix minimal exigé, si filtrePrix().
+ */
+double RequeteCatalogue::reqPrixMin() const
+{
+    return m_prixMin;
+}
+
+/**
+ * \brief Retourne le prix maximal exigé, si filtrePrix(); il est inférieur au minimum
+ *        si les intervalles demandés ne se chevauchent pas.
+ */
+double RequeteCatalogue::reqPrixMax() const
+{
+    return m_prixMax;
+}
+
+/**
+ * \brief Retourne le filtre sur les attributs, vide s'il n'y en a pas.
+ */
+const FiltreAttributs& RequeteCatalogue::reqAttributs() const
+{
+    return m_attributs;
+}
+
+/**
+ * \brief Retourne l'ordre demandé.
+ */
+RequeteCatalogue::Tri RequeteCatalogue::reqTri() const
+{
+    return m_tri;
+}
+
+/**
+ * \brief Retourne le nombre maximal de produits retenus, le plus grand size_t sans limite.
+ */
+size_t RequeteCatalogue::reqLimite() const
+{
+    return m_limite;
+}
+
+} // namespace commerce
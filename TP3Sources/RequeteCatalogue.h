@@ -0,0 +1,90 @@
+/**
+ * \file RequeteCatalogue.h
+ * \author Omar Mahamat
+ * \date 17 octobre 2026
+ * \brief Interface de la classe RequeteCatalogue
+ */
+
+#ifndef REQUETECATALOGUE_H
+#define REQUETECATALOGUE_H
+
+#include <cstddef>
+#include <string>
+#include "IndexAttributs.h"
+
+namespace commerce
+{
+
+/**
+ * \class RequeteCatalogue
+ * \brief Requête composée sur un catalogue : critères, ordre et nombre maximal de produits.
+ *
+ * Comme un FiltreAttributs, une requête se compose par appels successifs, chacun
+ * retournant la requête :
+ *
+ *     RequeteCatalogue().texte("chemise").prixEntre(20, 60)
+ *         .attributs(FiltreAttributs().taille("XL")).trierPar(RequeteCatalogue::Tri::PRIX_CROISSANT)
+ *         .limiter(10)
+ *
+ * retient les dix chemises XL les moins chères entre 20 $ et 60 $. Tous les critères
+ * doivent être satisfaits : deux appels à texte() exigent les mots des deux textes, deux
+ * appels à prixEntre() l’intersection des deux intervalles. Une requête sans critère
+ * retient tous les produits.
+ *
+ * La requête ne fait que décrire le résultat attendu ; c’est Catalogue::executerRequete()
+ * qui choisit comment l’obtenir (voir Plan).
+ */
+class RequeteCatalogue
+{
+public:
+    /**
+     * \brief Ordre des produits retenus.
+     *
+     * - AUCUN : ordre non spécifié, le plus rapide à produire ;
+     * - PRIX_CROISSANT : du moins cher au plus cher, par code à prix égal ;
+     * - PRIX_DECROISSANT : l’ordre inverse exact de PRIX_CROISSANT ;
+     * - DESCRIPTION : par description, puis par code à description égale.
+     */
+    enum class Tri { AUCUN, PRIX_CROISSANT, PRIX_DECROISSANT, DESCRIPTION };
+
+    /**
+     * \brief Façon d’obtenir les candidats, choisie par Catalogue::planifierRequete().
+     *
+     * - PARCOURS_BLOCS : chaque bloc est filtré sur ses colonnes de prix et ses bitmaps
+     *   d’attributs, sans lire aucun produit ;
+     * - INDEX_TEXTE : les produits qui contiennent les mots recherchés, tirés de l’index des
+     *   mots, sont vérifiés un à un ;
+     * - INDEX_PRIX : les produits de l’intervalle de prix, tirés de l’index des prix, sont
+     *   vérifiés un à un.
+     */
+    enum class Plan { PARCOURS_BLOCS, INDEX_TEXTE, INDEX_PRIX };
+
+    RequeteCatalogue& texte(const std::string& p_mots);
+    RequeteCatalogue& prixEntre(double p_prixMin, double p_prixMax);
+    RequeteCatalogue& attributs(const FiltreAttributs& p_filtre);
+    RequeteCatalogue& trierPar(Tri p_tri);
+    RequeteCatalogue& limiter(std::size_t p_nombre);
+
+    bool filtreTexte() const;
+    const std::string& reqTexte() const;
+    bool filtrePrix() const;
+    double reqPrixMin() const;
+    double reqPrixMax() const;
+    const FiltreAttributs& reqAttributs() const;
+    Tri reqTri() const;
+    std::size_t reqLimite() const;
+
+private:
+    std::string m_texte;
+    bool m_filtreTexte = false;
+    bool m_filtrePrix = false;
+    double m_prixMin = 0;
+    double m_prixMax = 0;
+    FiltreAttributs m_attributs;
+    Tri m_tri = Tri::AUCUN;
+    std::size_t m_limite = static_cast<std::size_t>(-1);
+};
+
+} // namespace commerce
+
+#endif /* REQUETECATALOGUE_H */
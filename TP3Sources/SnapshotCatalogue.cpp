@@ -0,0 +1,302 @@
+/**
+ * \file SnapshotCatalogue.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la sauvegarde et de la restauration d’un instantané binaire de catalogue.
+ */
+
+#include "SnapshotCatalogue.h"
+#include "ChargementCatalogue.h"
+#include "Electronique.h"
+#include "FichierMappe.h"
+#include "ProduitException.h"
+#include "Vetement.h"
+#include "validationFormat.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+namespace commerce {
+
+namespace {
+
+const char SIGNATURE[8] = {'C', 'A', 'T', 'S', 'N', 'A', 'P', '\0'};
+const uint32_t VERSION = 1;
+
+const uint8_t TYPE_ELECTRONIQUE = 1;
+const uint8_t TYPE_VETEMENT = 2;
+
+const char* const TAILLES[] = {"XS", "S", "M", "L", "XL", "XXL"};
+const uint8_t NB_TAILLES = 6;
+
+/**
+ * \brief Position d’une chaîne dans la table des chaînes.
+ */
+struct RefChaine
+{
+    uint32_t debut;
+    uint32_t longueur;
+};
+
+struct EnTete
+{
+    char signature[8];
+    uint32_t version;
+    uint32_t nbProduits;
+    uint64_t tailleTableChaines;
+    uint64_t sommeControle;
+    int32_t jour;
+    int32_t mois;
+    int32_t annee;
+    uint32_t reserve;
+    RefChaine nom;
+};
+
+struct Enregistrement
+{
+    double prix;
+    RefChaine description;
+    RefChaine code;
+    RefChaine couleur;
+    int32_t garantieMois;
+    uint8_t type;
+    uint8_t estReconditionne;
+    uint8_t taille;
+    uint8_t reserve;
+};
+
+static_assert(sizeof(EnTete) == 56, "format d'en-tête inattendu");
+static_assert(sizeof(Enregistrement) == 40, "format d'enregistrement inattendu");
+static_assert(sizeof(Enregistrement) % sizeof(uint64_t) == 0, "la somme de contrôle suppose des mots entiers");
+
+const uint64_t SOMME_INITIALE = 14695981039346656037ULL;
+
+/**
+ * \brief Somme de contrôle de type FNV-1a, calculée par mots de 64 bits.
+ *
+ *        La somme peut être poursuivie sur un second bloc en passant la somme du
+ *        premier, à condition que la taille du premier soit un multiple de 8.
+ */
+uint64_t calculerSommeControle(const char* p_donnees, size_t p_taille, uint64_t p_somme = SOMME_INITIALE)
+{
+    const uint64_t PREMIER = 1099511628211ULL;
+    uint64_t somme = p_somme;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= p_taille; i += sizeof(uint64_t)) {
+        uint64_t mot;
+        memcpy(&mot, p_donnees + i, sizeof(mot));
+        somme = (somme ^ mot) * PREMIER;
+    }
+    for (; i < p_taille; ++i) {
+        somme = (somme ^ static_cast<unsigned char>(p_donnees[i])) * PREMIER;
+    }
+    return somme;
+}
+
+/**
+ * \brief Table des chaînes en cours de construction.
+ */
+class TableChaines
+{
+public:
+    RefChaine ajouter(const string& p_chaine)
+    {
+        if (m_contenu.size() + p_chaine.size() > numeric_limits<uint32_t>::max()) {
+            throw ProduitException("Catalogue trop volumineux pour un instantané");
+        }
+        RefChaine ref{static_cast<uint32_t>(m_contenu.size()), static_cast<uint32_t>(p_chaine.size())};
+        m_contenu += p_chaine;
+        return ref;
+    }
+    const string& reqContenu() const
+    {
+        return m_contenu;
+    }
+private:
+    string m_contenu;
+};
+
+uint8_t indiceTaille(const string& p_taille)
+{
+    for (uint8_t i = 0; i < NB_TAILLES; ++i) {
+        if (p_taille == TAILLES[i]) {
+            return i;
+        }
+    }
+    return NB_TAILLES;
+}
+
+ChargementCatalogueException erreurSnapshot(const string& p_nomFichier, const string& p_raison)
+{
+    return ChargementCatalogueException("Instantané " + p_nomFichier + " : " + p_raison);
+}
+
+} // namespace
+
+/**
+ * \brief Sauvegarde un catalogue dans un instantané binaire.
+ *
+ *        Le fichier est écrit en une seule fois : en-tête, enregistrements des produits
+ *        dans l’ordre du catalogue, puis table des chaînes.
+ *
+ * \param[in] p_catalogue catalogue à sauvegarder
+ * \param[in] p_nomFichier nom du fichier à créer ou à remplacer
+ *
+ * \exception ProduitException Levée si un produit n’est ni un Electronique ni un Vetement,
+ *            si un vêtement n’a pas une taille standard (l’instantané ne pourrait pas
+ *            être rechargé), ou si les chaînes du catalogue dépassent 4 Gio.
+ * \exception std::runtime_error Levée si le fichier ne peut pas être écrit.
+ */
+void sauvegarderSnapshot(const Catalogue& p_catalogue, const std::string& p_nomFichier)
+{
+    TableChaines chaines;
+    vector<Enregistrement> enregistrements(p_catalogue.reqNombreProduits());
+
+    for (size_t i = 0; i < enregistrements.size(); ++i) {
+        const Produit& produit = p_catalogue.reqProduit(i);
+        Enregistrement& enregistrement = enregistrements[i];
+        enregistrement = Enregistrement();
+        enregistrement.prix = produit.reqPrix();
+        enregistrement.description = chaines.ajouter(produit.reqDescription());
+        enregistrement.code = chaines.ajouter(produit.reqCode());
+
+        if (const Electronique* electronique = dynamic_cast<const Electronique*>(&produit)) {
+            enregistrement.type = TYPE_ELECTRONIQUE;
+            enregistrement.garantieMois = electronique->reqGarantieMois();
+            enregistrement.estReconditionne = electronique->reqEstReconditionne() ? 1 : 0;
+        }
+        else if (const Vetement* vetement = dynamic_cast<const Vetement*>(&produit)) {
+            enregistrement.type = TYPE_VETEMENT;
+            enregistrement.taille = indiceTaille(vetement->reqTaille());
+            if (enregistrement.taille == NB_TAILLES) {
+                throw ProduitException("Taille non prise en charge par l'instantané : " + produit.reqCode());
+            }
+            enregistrement.couleur = chaines.ajouter(vetement->reqCouleur());
+        }
+        else {
+            throw ProduitException("Type de produit non pris en charge par l'instantané : " + produit.reqCode());
+        }
+    }
+
+    EnTete entete = EnTete();
+    memcpy(entete.signature, SIGNATURE, sizeof(SIGNATURE));
+    entete.version = VERSION;
+    entete.nbProduits = static_cast<uint32_t>(enregistrements.size());
+    entete.nom = chaines.ajouter(p_catalogue.reqNom());
+    entete.tailleTableChaines = chaines.reqContenu().size();
+    entete.jour = p_catalogue.reqDateDerniereMiseAJour().reqJour();
+    entete.mois = p_catalogue.reqDateDerniereMiseAJour().reqMois();
+    entete.annee = p_catalogue.reqDateDerniereMiseAJour().reqAnnee();
+
+    // La taille d'un enregistrement étant un multiple de 8, la somme se poursuit sur la table.
+    const char* debutEnregistrements = reinterpret_cast<const char*>(enregistrements.data());
+    size_t tailleEnregistrements = enregistrements.size() * sizeof(Enregistrement);
+    const string& table = chaines.reqContenu();
+    entete.sommeControle = calculerSommeControle(table.data(), table.size(),
+                                                 calculerSommeControle(debutEnregistrements, tailleEnregistrements));
+
+    ofstream fichier(p_nomFichier, ios::binary | ios::trunc);
+    fichier.write(reinterpret_cast<const char*>(&entete), sizeof(entete));
+    fichier.write(debutEnregistrements, tailleEnregistrements);
+    fichier.write(table.data(), table.size());
+    if (!fichier) {
+        throw runtime_error("Impossible d'écrire le fichier " + p_nomFichier);
+    }
+}
+
+/**
+ * \brief Restaure un catalogue à partir d’un instantané binaire.
+ *
+ *        Le fichier est projeté en mémoire. Après vérification de la signature, de la
+ *        version, de la taille et de la somme de contrôle, chaque produit est construit
+ *        directement à partir de son enregistrement et de vues sur la table des chaînes.
+ *        Comme au chargement d’un fichier texte, la description, le prix, le code et la
+ *        garantie de chaque produit sont vérifiés ici, et non par les préconditions des
+ *        produits, qui disparaissent lorsque NDEBUG est défini.
+ *
+ * \param[in] p_nomFichier nom de l’instantané à charger
+ * \return Le catalogue restauré, identique au catalogue sauvegardé
+ *
+ * \exception std::runtime_error Levée si le fichier ne peut pas être ouvert.
+ * \exception ChargementCatalogueException Levée si le fichier n’est pas un instantané
+ *            valide, est d’une autre version, est tronqué ou corrompu, ou si un produit
+ *            est invalide.
+ */
+Catalogue chargerSnapshot(const std::string& p_nomFichier)
+{
+    FichierMappe fichier(p_nomFichier);
+    string_view contenu = fichier.reqContenu();
+
+    EnTete entete;
+    if (contenu.size() < sizeof(entete)) {
+        throw erreurSnapshot(p_nomFichier, "fichier tronqué");
+    }
+    memcpy(&entete, contenu.data(), sizeof(entete));
+    if (memcmp(entete.signature, SIGNATURE, sizeof(SIGNATURE)) != 0) {
+        throw erreurSnapshot(p_nomFichier, "signature invalide");
+    }
+    if (entete.version != VERSION) {
+        throw erreurSnapshot(p_nomFichier, "version " + to_string(entete.version) + " non prise en charge");
+    }
+
+    string_view corps = contenu.substr(sizeof(entete));
+    uint64_t tailleEnregistrements = uint64_t(entete.nbProduits) * sizeof(Enregistrement);
+    if (corps.size() != tailleEnregistrements + entete.tailleTableChaines) {
+        throw erreurSnapshot(p_nomFichier, "taille incohérente");
+    }
+    if (calculerSommeControle(corps.data(), corps.size()) != entete.sommeControle) {
+        throw erreurSnapshot(p_nomFichier, "somme de contrôle invalide");
+    }
+
+    string_view table = corps.substr(tailleEnregistrements);
+    auto chaine = [&](const RefChaine& p_ref) {
+        if (uint64_t(p_ref.debut) + p_ref.longueur > table.size()) {
+            throw erreurSnapshot(p_nomFichier, "référence de chaîne invalide");
+        }
+        return string(table.substr(p_ref.debut, p_ref.longueur));
+    };
+
+    if (!Date::validerDate(entete.jour, entete.mois, entete.annee)) {
+        throw erreurSnapshot(p_nomFichier, "date invalide");
+    }
+    Catalogue catalogue(chaine(entete.nom), Date(entete.jour, entete.mois, entete.annee));
+    catalogue.reserver(entete.nbProduits);
+
+    const char* enregistrements = corps.data();
+    for (uint32_t i = 0; i < entete.nbProduits; ++i) {
+        Enregistrement enregistrement;
+        memcpy(&enregistrement, enregistrements + i * sizeof(Enregistrement), sizeof(enregistrement));
+
+        string description = chaine(enregistrement.description);
+        string code = chaine(enregistrement.code);
+        if (description.empty() || !isfinite(enregistrement.prix) || enregistrement.prix < 0
+            || !util::validerCodeProduit(code, description, enregistrement.prix)) {
+            throw erreurSnapshot(p_nomFichier, "produit " + to_string(i) + " invalide");
+        }
+
+        if (enregistrement.type == TYPE_ELECTRONIQUE && enregistrement.garantieMois >= 0) {
+            catalogue.ajouterProduit(make_unique<Electronique>(std::move(description), enregistrement.prix,
+                                                               std::move(code), enregistrement.garantieMois,
+                                                               enregistrement.estReconditionne != 0));
+        }
+        else if (enregistrement.type == TYPE_VETEMENT && enregistrement.taille < NB_TAILLES) {
+            catalogue.ajouterProduit(make_unique<Vetement>(std::move(description), enregistrement.prix,
+                                                           std::move(code), TAILLES[enregistrement.taille],
+                                                           chaine(enregistrement.couleur)));
+        }
+        else {
+            throw erreurSnapshot(p_nomFichier, "enregistrement " + to_string(i) + " invalide");
+        }
+    }
+    return catalogue;
+}
+
+} // namespace commerce
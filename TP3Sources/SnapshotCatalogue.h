@@ -0,0 +1,35 @@
+/**
+ * \file SnapshotCatalogue.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Sauvegarde et restauration d’un catalogue sous forme d’instantané binaire.
+ *
+ * Un instantané contient, dans l’ordre :
+ *  - un en-tête de taille fixe : signature, version, nombre de produits, taille de la
+ *    table des chaînes, somme de contrôle, date et nom du catalogue ;
+ *  - un enregistrement de taille fixe par produit : prix, type, garantie, indicateur
+ *    de reconditionnement, taille, et la position des chaînes du produit (description,
+ *    code, couleur) dans la table des chaînes ;
+ *  - la table des chaînes, qui regroupe bout à bout toutes les chaînes de caractères.
+ *
+ * Les entiers et les réels sont écrits dans la représentation de la machine (petit-boutiste
+ * sur les plateformes visées). Au chargement, le fichier est projeté en mémoire et les
+ * produits sont construits directement à partir des enregistrements, sans aucune analyse
+ * de texte. La somme de contrôle couvre tout ce qui suit l’en-tête et permet de détecter
+ * un fichier tronqué ou corrompu.
+ */
+
+#ifndef SNAPSHOTCATALOGUE_H
+#define SNAPSHOTCATALOGUE_H
+
+#include <string>
+#include "Catalogue.h"
+
+namespace commerce {
+
+void sauvegarderSnapshot(const Catalogue& p_catalogue, const std::string& p_nomFichier);
+Catalogue chargerSnapshot(const std::string& p_nomFichier);
+
+} // namespace commerce
+
+#endif /* SNAPSHOTCATALOGUE_H */
@@ -0,0 +1,156 @@
+/**
+ * \file TamponTexte.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Implémentation de la classe TamponTexte
+ */
+
+#include "TamponTexte.h"
+#include <charconv>
+#include <utility>
+
+using namespace std;
+
+namespace util
+{
+
+namespace
+{
+
+/**
+ * \brief Les nombres de 00 à 99 sur deux chiffres, pour écrire jours et mois sans conversion.
+ */
+const char DEUX_CHIFFRES[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Précision par défaut d’un std::ostream pour les réels (%g à 6 chiffres significatifs)
+const int PRECISION_FLUX = 6;
+
+} // namespace
+
+/**
+ * \brief Constructeur par défaut : tampon vide.
+ */
+TamponTexte::TamponTexte()
+{
+}
+
+/**
+ * \brief Constructeur avec capacité initiale.
+ * \param[in] p_capacite nombre d’octets à réserver d’avance
+ */
+TamponTexte::TamponTexte(size_t p_capacite)
+{
+    m_texte.reserve(p_capacite);
+}
+
+/**
+ * \brief Ajoute un texte à la fin du tampon.
+ * \param[in] p_texte texte à ajouter
+ * \return Le tampon, pour les appels en cascade.
+ */
+TamponTexte& TamponTexte::ajouter(string_view p_texte)
+{
+    m_texte.append(p_texte.data(), p_texte.size());
+    return *this;
+}
+
+/**
+ * \brief Ajoute un caractère à la fin du tampon.
+ * \param[in] p_caractere caractère à ajouter
+ * \return Le tampon, pour les appels en cascade.
+ */
+TamponTexte& TamponTexte::ajouter(char p_caractere)
+{
+    m_texte.push_back(p_caractere);
+    return *this;
+}
+
+/**
+ * \brief Ajoute un entier en base 10.
+ * \param[in] p_entier entier à ajouter
+ * \return Le tampon, pour les appels en cascade.
+ */
+TamponTexte& TamponTexte::ajouterEntier(long long p_entier)
+{
+    char chiffres[24];
+    char* fin = to_chars(chiffres, chiffres + sizeof(chiffres), p_entier).ptr;
+    m_texte.append(chiffres, fin);
+    return *this;
+}
+
+/**
+ * \brief Ajoute un réel, écrit comme le ferait un std::ostream avec son format par défaut
+ *        (6 chiffres significatifs, sans zéros superflus).
+ * \param[in] p_reel réel à ajouter
+ * \return Le tampon, pour les appels en cascade.
+ */
+TamponTexte& TamponTexte::ajouterReel(double p_reel)
+{
+    char chiffres[32];
+    char* fin = to_chars(chiffres, chiffres + sizeof(chiffres), p_reel, chars_format::general, PRECISION_FLUX).ptr;
+    m_texte.append(chiffres, fin);
+    return *this;
+}
+
+/**
+ * \brief Ajoute une date au format jj/mm/aaaa (comme operator<<(ostream&, const Date&)).
+ * \param[in] p_date date à ajouter
+ * \return Le tampon, pour les appels en cascade.
+ */
+TamponTexte& TamponTexte::ajouterDate(const Date& p_date)
+{
+    char texte[6] = {DEUX_CHIFFRES[2 * p_date.reqJour()], DEUX_CHIFFRES[2 * p_date.reqJour() + 1], '/',
+                     DEUX_CHIFFRES[2 * p_date.reqMois()], DEUX_CHIFFRES[2 * p_date.reqMois() + 1], '/'};
+    m_texte.append(texte, sizeof(texte));
+    return ajouterEntier(p_date.reqAnnee());
+}
+
+/**
+ * \brief Retourne le texte composé jusqu’ici.
+ * \return Une vue sur le contenu du tampon, valide jusqu’à la prochaine modification.
+ */
+string_view TamponTexte::reqTexte() const
+{
+    return m_texte;
+}
+
+/**
+ * \brief Retourne le nombre d’octets du tampon.
+ */
+size_t TamponTexte::reqTaille() const
+{
+    return m_texte.size();
+}
+
+/**
+ * \brief Prévoit l’espace nécessaire pour un nombre d’octets donné.
+ * \param[in] p_capacite nombre total d’octets attendu
+ */
+void TamponTexte::reserver(size_t p_capacite)
+{
+    m_texte.reserve(p_capacite);
+}
+
+/**
+ * \brief Vide le tampon en conservant sa capacité.
+ */
+void TamponTexte::vider()
+{
+    m_texte.clear();
+}
+
+/**
+ * \brief Retire le texte du tampon, sans copie.
+ * \return Le texte composé ; le tampon est ensuite vide.
+ */
+string TamponTexte::prendreTexte()
+{
+    string texte = std::move(m_texte);
+    m_texte.clear();
+    return texte;
+}
+
+} // namespace util
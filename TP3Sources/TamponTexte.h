@@ -0,0 +1,56 @@
+/**
+ * \file TamponTexte.h
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Interface de la classe TamponTexte
+ */
+
+#ifndef TAMPONTEXTE_H
+#define TAMPONTEXTE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "Date.h"
+
+namespace util
+{
+
+/**
+ * \class TamponTexte
+ * \brief Tampon d’octets extensible, réutilisable, dans lequel on compose du texte.
+ *
+ * TamponTexte remplace std::ostringstream pour le formatage des produits et des
+ * catalogues : les nombres sont convertis par std::to_chars, sans locale ni état de flux,
+ * les dates sont composées à partir de chiffres précalculés, et rien n’est jamais vidé.
+ * Le texte produit est identique, octet pour octet, à celui qu’écrirait un std::ostream
+ * avec son format par défaut.
+ *
+ * Vider le tampon conserve sa capacité : un même tampon peut servir à formater
+ * successivement plusieurs catalogues sans nouvelle allocation.
+ */
+class TamponTexte
+{
+public:
+    TamponTexte();
+    explicit TamponTexte(std::size_t p_capacite);
+
+    TamponTexte& ajouter(std::string_view p_texte);
+    TamponTexte& ajouter(char p_caractere);
+    TamponTexte& ajouterEntier(long long p_entier);
+    TamponTexte& ajouterReel(double p_reel);
+    TamponTexte& ajouterDate(const Date& p_date);
+
+    std::string_view reqTexte() const;
+    std::size_t reqTaille() const;
+    void reserver(std::size_t p_capacite);
+    void vider();
+    std::string prendreTexte();
+
+private:
+    std::string m_texte;
+};
+
+} // namespace util
+
+#endif /* TAMPONTEXTE_H */
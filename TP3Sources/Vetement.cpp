@@ -8,6 +8,7 @@
 
 #include "Vetement.h"
 #include "ContratException.h"
+#include "ArenaProduits.h"
 #include <sstream>
 using namespace std;
 using namespace util;
@@ -77,19 +78,29 @@ bool Vetement::operator==(const Vetement& p_vetement) const {
  /**
    * \brief Retourne une représentation textuelle du vêtement.
    *
-   *        Cette méthode reprend le format de Produit puis ajoute les informations
-   *        propres à Vetement : taille et couleur.
+   *        Le texte est celui que produit ecrireFormate().
 
    * \return une chaîne contenant la description formatée du vêtement
    */
 string Vetement::reqProduitFormate() const {
-    ostringstream os;
-    os << "----------------------------" << endl;
-    os << "Produit Vetement" << endl;
-    os << Produit::reqProduitFormate() << endl;
-    os << "Taille : " << m_taille << endl;
-    os << "Couleur : " << m_couleur << endl;
-    return os.str();
+    util::TamponTexte tampon;
+    ecrireFormate(tampon);
+    return tampon.prendreTexte();
+}
+
+ /**
+   * \brief Ajoute la représentation textuelle du vêtement à un tampon.
+   *
+   *        Cette méthode reprend le format de Produit puis ajoute les informations
+   *        propres à Vetement : taille et couleur.
+
+   * \param[out] p_tampon tampon qui reçoit le texte
+   */
+void Vetement::ecrireFormate(util::TamponTexte& p_tampon) const {
+    p_tampon.ajouter("----------------------------\nProduit Vetement\n");
+    Produit::ecrireFormate(p_tampon);
+    p_tampon.ajouter("\nTaille : ").ajouter(m_taille).ajouter('\n');
+    p_tampon.ajouter("Couleur : ").ajouter(m_couleur).ajouter('\n');
 }
 
 
@@ -102,6 +113,26 @@ unique_ptr<Produit> Vetement::clone() const
     return make_unique<Vetement>(*this);
 }
 
+/**
+ * \brief Crée une copie du vêtement dans l’arène d’un catalogue.
+ * \param[in,out] p_arena Arène qui reçoit la copie.
+ * \return Un pointeur partagé vers la copie, logée dans l’arène.
+ */
+shared_ptr<Produit> Vetement::cloneDans(ArenaProduits& p_arena) const
+{
+    return p_arena.creer<Vetement>(*this);
+}
+
+/**
+ * \brief Déplace le vêtement dans l’arène d’un catalogue, sans copier ses chaînes.
+ * \param[in,out] p_arena Arène qui reçoit le vêtement.
+ * \return Un pointeur partagé vers le vêtement, logé dans l’arène.
+ */
+shared_ptr<Produit> Vetement::deplacerDans(ArenaProduits& p_arena)
+{
+    return p_arena.creer<Vetement>(std::move(*this));
+}
+
 
  /**
    * \brief Teste l’invariant de la classe Vetement
@@ -32,7 +32,8 @@ namespace commerce{
  * - d’obtenir la taille du vêtement (ex. S, M, XL, etc.) ;
  * - d’obtenir sa couleur ;
  * - de comparer deux vêtements entre eux en tenant compte de leurs attributs spécifiques ;
- * - d’obtenir une version textuelle détaillée du vêtement incluant taille et couleur.
+ * - d’obtenir une version textuelle détaillée du vêtement incluant taille et couleur ;
+ * - d’être copié ou déplacé dans l’arène d’un catalogue (cloneDans(), deplacerDans()).
  *
  * Les invariants de la classe garantissent que :
  * - la taille du vêtement n’est jamais vide ;
@@ -50,7 +51,11 @@ public:
     const std::string& reqCouleur() const;
     bool operator==(const Vetement& p_vetement) const;
     std::string reqProduitFormate() const override;
+    using Produit::ecrireFormate;
+    void ecrireFormate(util::TamponTexte& p_tampon) const override;
     std::unique_ptr<Produit> clone() const override;
+    std::shared_ptr<Produit> cloneDans(ArenaProduits& p_arena) const override;
+    std::shared_ptr<Produit> deplacerDans(ArenaProduits& p_arena) override;
 private:
     std::string m_taille;
     std::string m_couleur;
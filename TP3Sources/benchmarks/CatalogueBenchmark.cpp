@@ -0,0 +1,710 @@
+/**
+ * \file CatalogueBenchmark.cpp
+ * \brief Mesure des opérations du catalogue selon sa taille (10^2 à 10^6 produits)
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ *
+ * Les catalogues mesurés sont produits par genererCatalogue() avec une graine fixe :
+ * d'une exécution à l'autre, les mêmes produits sont chargés, copiés, formatés et
+ * supprimés. Chaque catalogue (et son fichier texte) n'est construit qu'une fois par
+ * taille, puis réutilisé par toutes les mesures de cette taille.
+ *
+ * Les mesures d'ajout et de chargement rapportent le nombre moyen d'allocations par
+ * produit, compté par les opérateurs new remplacés dans CompteurAllocations.cpp.
+ */
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <streambuf>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Catalogue.h"
+#include "ChargementCatalogue.h"
+#include "CompteurAllocations.h"
+#include "Electronique.h"
+#include "GenerateurCatalogue.h"
+#include "TamponTexte.h"
+#include "validationFormat.h"
+#include "Vetement.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+namespace {
+
+/**
+ * \brief Rapporte le nombre moyen d'allocations par produit depuis p_allocationsAvant.
+ */
+void compterAllocations(benchmark::State& p_state, size_t p_allocationsAvant)
+{
+  double nbProduits = static_cast<double>(p_state.iterations() * p_state.range(0));
+  p_state.counters["allocations/produit"] = static_cast<double>(nombreAllocations() - p_allocationsAvant) / nbProduits;
+}
+
+/**
+ * \brief Catalogue synthétique d'une taille donnée, avec son texte et son fichier.
+ */
+struct CatalogueSynthetique
+{
+  explicit CatalogueSynthetique(size_t p_nbProduits) :
+    texte(genererTexteCatalogue(parametres(p_nbProduits))),
+    catalogue(chargerCatalogueDepuisTexte(texte)),
+    nomFichier((filesystem::temp_directory_path() / ("catalogue_benchmark_" + to_string(p_nbProduits) + ".txt")).string())
+  {
+    ofstream fichier(nomFichier, ios::binary);
+    fichier << texte;
+  }
+
+  ~CatalogueSynthetique()
+  {
+    std::remove(nomFichier.c_str());
+  }
+
+  static ParametresGeneration parametres(size_t p_nbProduits)
+  {
+    ParametresGeneration parametres;
+    parametres.nbProduits = p_nbProduits;
+    return parametres;
+  }
+
+  string texte;
+  Catalogue catalogue;
+  string nomFichier;
+};
+
+const CatalogueSynthetique& catalogueSynthetique(size_t p_nbProduits)
+{
+  static map<size_t, unique_ptr<CatalogueSynthetique>> catalogues;
+  unique_ptr<CatalogueSynthetique>& catalogue = catalogues[p_nbProduits];
+  if (!catalogue)
+    {
+      catalogue = make_unique<CatalogueSynthetique>(p_nbProduits);
+    }
+  return *catalogue;
+}
+
+/**
+ * \brief Tailles de catalogue mesurées : 10^2, 10^3, ..., 10^6 produits.
+ */
+void taillesCatalogue(benchmark::internal::Benchmark* p_benchmark)
+{
+  p_benchmark->ArgName("produits")->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+}
+
+} // namespace
+
+static void BM_AjouterProduit(benchmark::State& state)
+{
+  const Catalogue& source = catalogueSynthetique(state.range(0)).catalogue;
+  size_t allocationsAvant = nombreAllocations();
+  for (auto _ : state)
+    {
+      Catalogue catalogue("mesure", Date(1, 1, 2025));
+      for (size_t i = 0; i < source.reqNombreProduits(); ++i)
+        {
+          catalogue.ajouterProduit(source.reqProduit(i));
+        }
+      benchmark::DoNotOptimize(catalogue.reqNombreProduits());
+    }
+  compterAllocations(state, allocationsAvant);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AjouterProduit)->Apply(taillesCatalogue);
+
+/**
+ * Le produit retiré est aussitôt réajouté (à la fin de la liste), pour que chaque
+ * itération travaille sur un catalogue de même taille. Les produits retirés sont pris à
+ * tour de rôle dans tout le catalogue. Le catalogue est rechargé plutôt que copié : une
+ * copie partagerait ses blocs avec le catalogue synthétique, et les premières suppressions
+ * paieraient leur duplication. Avec p_indexTexte, l'index des mots est construit avant la
+ * mesure et tenu à jour à chaque suppression et à chaque ajout.
+ */
+static void supprimerProduit(benchmark::State& state, Catalogue::ModeSuppression p_mode, bool p_indexTexte)
+{
+  Catalogue catalogue = chargerCatalogueDepuisTexte(catalogueSynthetique(state.range(0)).texte);
+  if (p_indexTexte)
+    {
+      catalogue.rechercherProduits("");
+    }
+  vector<string> codes;
+  for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+    {
+      codes.push_back(catalogue.reqProduit(i).reqCode());
+    }
+  size_t suivant = 0;
+  for (auto _ : state)
+    {
+      const string& code = codes[suivant];
+      unique_ptr<Produit> produit = catalogue.trouverProduit(code).clone();
+      catalogue.supprimerProduit(code, p_mode);
+      catalogue.ajouterProduit(*produit);
+      suivant = (suivant * 7 + 1) % codes.size();
+    }
+}
+
+static void BM_SupprimerProduit_Ordonnee(benchmark::State& state)
+{
+  supprimerProduit(state, Catalogue::ModeSuppression::ORDONNEE, false);
+}
+BENCHMARK(BM_SupprimerProduit_Ordonnee)->Apply(taillesCatalogue);
+
+static void BM_SupprimerProduit_Permutation(benchmark::State& state)
+{
+  supprimerProduit(state, Catalogue::ModeSuppression::PERMUTATION, false);
+}
+BENCHMARK(BM_SupprimerProduit_Permutation)->Apply(taillesCatalogue);
+
+static void BM_SupprimerProduit_Permutation_IndexTexte(benchmark::State& state)
+{
+  supprimerProduit(state, Catalogue::ModeSuppression::PERMUTATION, true);
+}
+BENCHMARK(BM_SupprimerProduit_Permutation_IndexTexte)->Apply(taillesCatalogue);
+
+static void BM_TrouverProduit(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  vector<string> codes;
+  for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+    {
+      codes.push_back(catalogue.reqProduit(i).reqCode());
+    }
+  size_t suivant = 0;
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(&catalogue.trouverProduit(codes[suivant]));
+      suivant = (suivant + 1) % codes.size();
+    }
+}
+BENCHMARK(BM_TrouverProduit)->Apply(taillesCatalogue);
+
+/**
+ * \brief Valeur totale calculée produit par produit, par l'interface de Produit.
+ *
+ * Sert de référence à BM_ValeurTotale, qui parcourt la colonne des prix.
+ */
+static void BM_ValeurTotale_ParProduit(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  for (auto _ : state)
+    {
+      double total = 0;
+      for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+        {
+          total += catalogue.reqProduit(i).reqPrix();
+        }
+      benchmark::DoNotOptimize(total);
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValeurTotale_ParProduit)->Apply(taillesCatalogue);
+
+static void BM_ValeurTotale(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.reqValeurTotale());
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValeurTotale)->Apply(taillesCatalogue);
+
+static void BM_TrouverPositionsParPrix(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.trouverPositionsParPrix(10.0, 50.0).size());
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TrouverPositionsParPrix)->Apply(taillesCatalogue);
+
+/**
+ * \brief Requête d'une bande de prix de 1 $ (environ 0,1 % des produits) par l'index des prix.
+ *
+ * L'index est construit par une première requête, hors mesure.
+ */
+static void BM_ProduitsDansIntervallePrix(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  catalogue.moinsChers(1);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.produitsDansIntervallePrix(100.0, 101.0).size());
+    }
+}
+BENCHMARK(BM_ProduitsDansIntervallePrix)->Apply(taillesCatalogue);
+
+static void BM_PlusChers(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  catalogue.moinsChers(1);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.plusChers(10).size());
+    }
+}
+BENCHMARK(BM_PlusChers)->Apply(taillesCatalogue);
+
+/**
+ * \brief Recherche par mots en parcourant toutes les descriptions.
+ *
+ * Sert de référence aux mesures BM_RechercherProduits_*, qui passent par l'index des mots.
+ */
+static void BM_RechercherProduits_Parcours(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  for (auto _ : state)
+    {
+      size_t nbTrouves = 0;
+      for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+        {
+          vector<string> mots = IndexTexte::extraireMots(catalogue.reqProduit(i).reqDescription());
+          nbTrouves += binary_search(mots.begin(), mots.end(), "chemise") && binary_search(mots.begin(), mots.end(), "premium");
+        }
+      benchmark::DoNotOptimize(nbTrouves);
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RechercherProduits_Parcours)->Apply(taillesCatalogue);
+
+/**
+ * \brief Recherche du premier mot d'une description, propre à un seul produit.
+ *
+ * L'index est construit par une première requête, hors mesure.
+ */
+static void BM_RechercherProduits_MotRare(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  const string& description = catalogue.reqProduit(catalogue.reqNombreProduits() / 2).reqDescription();
+  string mot = description.substr(0, description.find(' '));
+  catalogue.rechercherProduits(mot);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.rechercherProduits(mot).size());
+    }
+}
+BENCHMARK(BM_RechercherProduits_MotRare)->Apply(taillesCatalogue);
+
+/**
+ * \brief Recherche de deux mots fréquents (ET), et d'un préfixe qui couvre 26 mots.
+ */
+static void BM_RechercherProduits_DeuxMots(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  catalogue.rechercherProduits("chemise premium");
+  size_t nbTrouves = 0;
+  for (auto _ : state)
+    {
+      nbTrouves = catalogue.rechercherProduits("chemise premium").size();
+      benchmark::DoNotOptimize(nbTrouves);
+    }
+  state.counters["produits"] = static_cast<double>(nbTrouves);
+}
+BENCHMARK(BM_RechercherProduits_DeuxMots)->Apply(taillesCatalogue);
+
+static void BM_RechercherProduits_Prefixe(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  const string& description = catalogue.reqProduit(catalogue.reqNombreProduits() / 2).reqDescription();
+  string prefixe = description.substr(0, 3) + "*";
+  catalogue.rechercherProduits(prefixe);
+  size_t nbTrouves = 0;
+  for (auto _ : state)
+    {
+      nbTrouves = catalogue.rechercherProduits(prefixe).size();
+      benchmark::DoNotOptimize(nbTrouves);
+    }
+  state.counters["produits"] = static_cast<double>(nbTrouves);
+}
+BENCHMARK(BM_RechercherProduits_Prefixe)->Apply(taillesCatalogue);
+
+/**
+ * \brief Recherche approchée d'un texte saisi frappe par frappe, avec des fautes.
+ *
+ * Chaque itération relance la recherche après chacune des frappes de « chemse lin premim »;
+ * le débit est donc le nombre de frappes traitées par seconde.
+ */
+static void BM_RechercherApprox_Frappe(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  const string saisie = "chemse lin premim";
+  catalogue.rechercherApprox(saisie, 10);
+  for (auto _ : state)
+    {
+      for (size_t longueur = 1; longueur <= saisie.size(); ++longueur)
+        {
+          benchmark::DoNotOptimize(catalogue.rechercherApprox(saisie.substr(0, longueur), 10).size());
+        }
+    }
+  state.SetItemsProcessed(state.iterations() * saisie.size());
+}
+BENCHMARK(BM_RechercherApprox_Frappe)->Apply(taillesCatalogue);
+
+/**
+ * \brief Recherche approchée du premier mot d'une description, propre à un seul produit, avec une faute.
+ */
+static void BM_RechercherApprox_MotRare(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  const string& description = catalogue.reqProduit(catalogue.reqNombreProduits() / 2).reqDescription();
+  string mot = description.substr(0, description.find(' '));
+  mot.back() = mot.back() == 'x' ? 'y' : 'x';
+  catalogue.rechercherApprox(mot, 10);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.rechercherApprox(mot, 10).size());
+    }
+}
+BENCHMARK(BM_RechercherApprox_MotRare)->Apply(taillesCatalogue);
+
+/**
+ * \brief Vêtements XL noirs obtenus en examinant le type et les attributs de chaque produit.
+ *
+ * Sert de référence aux mesures BM_FiltrerProduits_*, qui passent par les bitmaps d'attributs.
+ */
+static void BM_FiltrerProduits_Parcours(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  size_t nbTrouves = 0;
+  for (auto _ : state)
+    {
+      vector<const Produit*> produits;
+      for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+        {
+          const Vetement* vetement = dynamic_cast<const Vetement*>(&catalogue.reqProduit(i));
+          if (vetement && vetement->reqTaille() == "XL" && vetement->reqCouleur() == "Noir")
+            {
+              produits.push_back(vetement);
+            }
+        }
+      nbTrouves = produits.size();
+      benchmark::DoNotOptimize(produits.data());
+    }
+  state.counters["produits"] = static_cast<double>(nbTrouves);
+}
+BENCHMARK(BM_FiltrerProduits_Parcours)->Apply(taillesCatalogue);
+
+static void BM_FiltrerProduits_TailleCouleur(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  FiltreAttributs filtre;
+  filtre.taille("XL").couleur("Noir");
+  size_t nbTrouves = 0;
+  for (auto _ : state)
+    {
+      nbTrouves = catalogue.filtrerProduits(filtre).size();
+      benchmark::DoNotOptimize(nbTrouves);
+    }
+  state.counters["produits"] = static_cast<double>(nbTrouves);
+}
+BENCHMARK(BM_FiltrerProduits_TailleCouleur)->Apply(taillesCatalogue);
+
+/**
+ * \brief Produits électroniques reconditionnés garantis au moins 24 mois : union des bitmaps de 13 durées.
+ */
+static void BM_FiltrerProduits_ReconditionneGarantie(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  FiltreAttributs filtre;
+  filtre.reconditionne(true).garantieMinimale(24);
+  size_t nbTrouves = 0;
+  for (auto _ : state)
+    {
+      nbTrouves = catalogue.filtrerProduits(filtre).size();
+      benchmark::DoNotOptimize(nbTrouves);
+    }
+  state.counters["produits"] = static_cast<double>(nbTrouves);
+}
+BENCHMARK(BM_FiltrerProduits_ReconditionneGarantie)->Apply(taillesCatalogue);
+
+static void BM_CompterProduits_TailleCouleur(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  FiltreAttributs filtre;
+  filtre.taille("XL").couleur("Noir");
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.compterProduits(filtre));
+    }
+}
+BENCHMARK(BM_CompterProduits_TailleCouleur)->Apply(taillesCatalogue);
+
+/**
+ * \brief Dix produits électroniques reconditionnés les moins chers entre 100 $ et 300 $,
+ *        obtenus en examinant chaque produit puis en triant tous ceux qui sont retenus.
+ *
+ * Sert de référence aux mesures BM_ExecuterRequete_*.
+ */
+static void BM_ExecuterRequete_Parcours(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  for (auto _ : state)
+    {
+      vector<const Produit*> produits;
+      for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+        {
+          const Electronique* electronique = dynamic_cast<const Electronique*>(&catalogue.reqProduit(i));
+          if (electronique && electronique->reqEstReconditionne() && electronique->reqPrix() >= 100.0
+              && electronique->reqPrix() <= 300.0)
+            {
+              produits.push_back(electronique);
+            }
+        }
+      sort(produits.begin(), produits.end(), [](const Produit* p_a, const Produit* p_b) {
+        return p_a->reqPrix() < p_b->reqPrix();
+      });
+      produits.resize(min<size_t>(produits.size(), 10));
+      benchmark::DoNotOptimize(produits.data());
+    }
+}
+BENCHMARK(BM_ExecuterRequete_Parcours)->Apply(taillesCatalogue);
+
+/**
+ * \brief La même requête par executerRequete() : bitmaps d'attributs et colonnes de prix
+ *        des blocs, puis tri partiel des dix premiers.
+ */
+static void BM_ExecuterRequete_PrixAttributs(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  RequeteCatalogue requete;
+  requete.prixEntre(100.0, 300.0).attributs(FiltreAttributs().reconditionne(true))
+      .trierPar(RequeteCatalogue::Tri::PRIX_CROISSANT).limiter(10);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.executerRequete(requete).size());
+    }
+}
+BENCHMARK(BM_ExecuterRequete_PrixAttributs)->Apply(taillesCatalogue);
+
+/**
+ * \brief Une bande de prix de 1 $ : l'index des prix, construit hors mesure, fournit les
+ *        candidats dans l'ordre demandé, et l'exécution s'arrête au dixième produit retenu.
+ */
+static void BM_ExecuterRequete_IndexPrix(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  catalogue.moinsChers(1);
+  RequeteCatalogue requete;
+  requete.prixEntre(100.0, 101.0).attributs(FiltreAttributs().reconditionne(true))
+      .trierPar(RequeteCatalogue::Tri::PRIX_CROISSANT).limiter(10);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(catalogue.executerRequete(requete).size());
+    }
+}
+BENCHMARK(BM_ExecuterRequete_IndexPrix)->Apply(taillesCatalogue);
+
+/**
+ * \brief Deux mots fréquents, une bande de prix et une taille, triés par description :
+ *        les produits des deux mots sont vérifiés sur les colonnes et les bitmaps des blocs.
+ */
+static void BM_ExecuterRequete_MotsPrixTaille(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  catalogue.rechercherProduits("");
+  RequeteCatalogue requete;
+  requete.texte("chemise premium").prixEntre(20.0, 200.0).attributs(FiltreAttributs().taille("XL"))
+      .trierPar(RequeteCatalogue::Tri::DESCRIPTION).limiter(20);
+  size_t nbTrouves = 0;
+  for (auto _ : state)
+    {
+      nbTrouves = catalogue.executerRequete(requete).size();
+      benchmark::DoNotOptimize(nbTrouves);
+    }
+  state.counters["produits"] = static_cast<double>(nbTrouves);
+}
+BENCHMARK(BM_ExecuterRequete_MotsPrixTaille)->Apply(taillesCatalogue);
+
+static void BM_ReqCatalogueFormate(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  size_t taille = 0;
+  for (auto _ : state)
+    {
+      string texte = catalogue.reqCatalogueFormate();
+      taille = texte.size();
+      benchmark::DoNotOptimize(texte.data());
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * taille);
+}
+BENCHMARK(BM_ReqCatalogueFormate)->Apply(taillesCatalogue);
+
+static void BM_ReqCatalogueFormate_SansCache(benchmark::State& state)
+{
+  Catalogue catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  size_t taille = 0;
+  for (auto _ : state)
+    {
+      // Le coût de la libération du cache est inclus dans la mesure.
+      catalogue.viderCacheFormate();
+      string texte = catalogue.reqCatalogueFormate();
+      taille = texte.size();
+      benchmark::DoNotOptimize(texte.data());
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * taille);
+}
+BENCHMARK(BM_ReqCatalogueFormate_SansCache)->Apply(taillesCatalogue);
+
+static void BM_ReqCatalogueFormate_ApresModification(benchmark::State& state)
+{
+  Catalogue catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  const Produit& produit = catalogue.reqProduit(catalogue.reqNombreProduits() / 2);
+  string code = produit.reqCode();
+  double prix = produit.reqPrix();
+  size_t taille = 0;
+  for (auto _ : state)
+    {
+      // Ajouter un dollar conserve les cents, donc le code du produit.
+      prix += 1;
+      catalogue.asgPrixProduit(code, prix);
+      string texte = catalogue.reqCatalogueFormate();
+      taille = texte.size();
+      benchmark::DoNotOptimize(texte.data());
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * taille);
+}
+BENCHMARK(BM_ReqCatalogueFormate_ApresModification)->Apply(taillesCatalogue);
+
+namespace {
+
+/**
+ * \brief Tampon de flux qui compte les octets reçus sans les conserver.
+ */
+class TamponCompteur : public std::streambuf
+{
+public:
+  size_t reqTaille() const
+  {
+    return m_taille;
+  }
+
+protected:
+  int_type overflow(int_type p_caractere) override
+  {
+    ++m_taille;
+    return traits_type::not_eof(p_caractere);
+  }
+
+  streamsize xsputn(const char*, streamsize p_nombre) override
+  {
+    m_taille += static_cast<size_t>(p_nombre);
+    return p_nombre;
+  }
+
+private:
+  size_t m_taille = 0;
+};
+
+} // namespace
+
+static void BM_FormaterCatalogue(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  TamponCompteur tampon;
+  ostream os(&tampon);
+  for (auto _ : state)
+    {
+      catalogue.formater(os);
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(tampon.reqTaille());
+}
+BENCHMARK(BM_FormaterCatalogue)->Apply(taillesCatalogue);
+
+static void BM_FormaterCatalogue_TamponReutilise(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  TamponTexte tampon;
+  size_t taille = 0;
+  for (auto _ : state)
+    {
+      tampon.vider();
+      catalogue.formater(tampon);
+      taille = tampon.reqTaille();
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * taille);
+}
+BENCHMARK(BM_FormaterCatalogue_TamponReutilise)->Apply(taillesCatalogue);
+
+static void BM_CopieCatalogue(benchmark::State& state)
+{
+  const Catalogue& catalogue = catalogueSynthetique(state.range(0)).catalogue;
+  for (auto _ : state)
+    {
+      Catalogue copie(catalogue);
+      benchmark::DoNotOptimize(copie.reqNombreProduits());
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CopieCatalogue)->Apply(taillesCatalogue);
+
+/**
+ * Instantané suivi d'une petite modification : la copie partage tout le catalogue,
+ * puis le changement de prix d'un produit ne duplique que son bloc et son sous-index.
+ * Le prix du premier produit alterne entre deux valeurs dont les codes sont libres.
+ */
+static void BM_CopieCatalogue_PuisChangementPrix(benchmark::State& state)
+{
+  Catalogue catalogue = chargerCatalogueDepuisTexte(catalogueSynthetique(state.range(0)).texte);
+  string description = catalogue.reqProduit(0).reqDescription();
+  double prix[2] = {catalogue.reqProduit(0).reqPrix(), catalogue.reqProduit(0).reqPrix()};
+  do
+    {
+      prix[1] += 0.01;
+    }
+  while (catalogue.contientProduit(genererCodeProduit(description, prix[1])));
+
+  size_t actuel = 0;
+  for (auto _ : state)
+    {
+      Catalogue instantane(catalogue);
+      catalogue.asgPrixProduit(genererCodeProduit(description, prix[actuel]), prix[1 - actuel]);
+      actuel = 1 - actuel;
+      benchmark::DoNotOptimize(instantane.reqNombreProduits());
+    }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CopieCatalogue_PuisChangementPrix)->Apply(taillesCatalogue);
+
+static void BM_ChargerCatalogueDepuisFichier(benchmark::State& state)
+{
+  const CatalogueSynthetique& synthetique = catalogueSynthetique(state.range(0));
+  size_t allocationsAvant = nombreAllocations();
+  for (auto _ : state)
+    {
+      Catalogue catalogue = chargerCatalogueDepuisFichier(synthetique.nomFichier);
+      benchmark::DoNotOptimize(catalogue.reqNombreProduits());
+    }
+  compterAllocations(state, allocationsAvant);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * synthetique.texte.size());
+}
+BENCHMARK(BM_ChargerCatalogueDepuisFichier)->Apply(taillesCatalogue);
+
+static void BM_ValiderFormatFichier(benchmark::State& state)
+{
+  const CatalogueSynthetique& synthetique = catalogueSynthetique(state.range(0));
+  for (auto _ : state)
+    {
+      ifstream fichier(synthetique.nomFichier);
+      if (!validerFormatFichier(fichier))
+        {
+          state.SkipWithError("catalogue synthétique refusé par validerFormatFichier");
+          return;
+        }
+    }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * synthetique.texte.size());
+}
+BENCHMARK(BM_ValiderFormatFichier)->Apply(taillesCatalogue);
@@ -0,0 +1,62 @@
+/**
+ * \file CompteurAllocations.cpp
+ * \brief Remplacement des opérateurs new et delete globaux, pour compter les allocations
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ *
+ * Les opérateurs sont définis dans leur propre unité de compilation : le compilateur ne
+ * peut alors pas les intégrer aux expressions new et delete des benchmarks, où il
+ * prendrait le free() d'un delete pour la libération d'une mémoire obtenue par new.
+ */
+#include "CompteurAllocations.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+namespace {
+
+atomic<size_t> nbAllocations(0);
+
+} // namespace
+
+size_t nombreAllocations()
+{
+  return nbAllocations.load();
+}
+
+void* operator new(size_t p_taille)
+{
+  nbAllocations.fetch_add(1, memory_order_relaxed);
+  if (void* memoire = malloc(p_taille != 0 ? p_taille : 1))
+    {
+      return memoire;
+    }
+  throw bad_alloc();
+}
+
+void* operator new[](size_t p_taille)
+{
+  return operator new(p_taille);
+}
+
+void operator delete(void* p_memoire) noexcept
+{
+  free(p_memoire);
+}
+
+void operator delete(void* p_memoire, size_t) noexcept
+{
+  free(p_memoire);
+}
+
+void operator delete[](void* p_memoire) noexcept
+{
+  free(p_memoire);
+}
+
+void operator delete[](void* p_memoire, size_t) noexcept
+{
+  free(p_memoire);
+}
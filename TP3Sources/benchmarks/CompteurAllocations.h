@@ -0,0 +1,17 @@
+/**
+ * \file CompteurAllocations.h
+ * \brief Nombre d'allocations faites par les benchmarks
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ */
+#ifndef COMPTEURALLOCATIONS_H
+#define COMPTEURALLOCATIONS_H
+
+#include <cstddef>
+
+/**
+ * \brief Retourne le nombre d'appels aux opérateurs new et new[] depuis le début du programme.
+ */
+std::size_t nombreAllocations();
+
+#endif /* COMPTEURALLOCATIONS_H */
@@ -0,0 +1,57 @@
+/**
+ * \file DateBenchmark.cpp
+ * \brief Mesure du coût des calculs sur les dates
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ */
+#include <benchmark/benchmark.h>
+#include <string>
+#include "Date.h"
+
+using namespace std;
+using namespace util;
+
+static void BM_DifferenceDates(benchmark::State& state)
+{
+  Date debut(1, 1, 1990);
+  Date fin(21, 8, 2025);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(fin - debut);
+    }
+}
+BENCHMARK(BM_DifferenceDates);
+
+static void BM_AjouteNbJour(benchmark::State& state)
+{
+  Date date(21, 8, 2025);
+  for (auto _ : state)
+    {
+      date.ajouteNbJour(static_cast<int>(state.range(0)));
+      date.ajouteNbJour(-static_cast<int>(state.range(0)));
+      benchmark::DoNotOptimize(date);
+    }
+}
+BENCHMARK(BM_AjouteNbJour)->ArgName("jours")->Arg(1)->Arg(30)->Arg(365)->Arg(3650);
+
+static void BM_ComparerDates(benchmark::State& state)
+{
+  Date a(21, 8, 2025);
+  Date b(22, 8, 2025);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(a < b);
+      benchmark::DoNotOptimize(a == b);
+    }
+}
+BENCHMARK(BM_ComparerDates);
+
+static void BM_ReqDateFormatee(benchmark::State& state)
+{
+  Date date(21, 8, 2025);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(date.reqDateFormatee());
+    }
+}
+BENCHMARK(BM_ReqDateFormatee);
@@ -0,0 +1,216 @@
+/**
+ * \file ValidationFormatBenchmark.cpp
+ * \brief Mesure du coût par appel de la génération et de la validation des codes produits
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ *
+ * Les fonctions de référence (suffixe « Reference ») reprennent l'implémentation
+ * précédente, qui construisait des std::string temporaires à chaque appel; elles
+ * permettent de comparer les deux versions dans une même exécution.
+ */
+#include <benchmark/benchmark.h>
+#include <cctype>
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "validationFormat.h"
+
+using namespace std;
+using namespace util;
+
+namespace {
+
+string genererCodeProduitReference(const string& p_nom, double p_prix)
+{
+  string code = "PRD-";
+  string name;
+  int somme = 0;
+  for (char c : p_nom)
+    {
+      if (isalpha(static_cast<unsigned char>(c)))
+        {
+          name += static_cast<char>(toupper(static_cast<unsigned char>(c)));
+          if (name.size() == 4)
+            {
+              break;
+            }
+        }
+    }
+  for (char c : name)
+    {
+      somme += static_cast<int>(c) - 64;
+    }
+  code += name + "-";
+  int totalCents = static_cast<int>(std::round(p_prix * 100));
+  int cents = totalCents % 100;
+  somme += cents / 10 + cents % 10;
+  int cle = somme % 100;
+  if (cle < 10)
+    {
+      code += "0";
+    }
+  code += to_string(cle);
+  return code;
+}
+
+bool validerCodeProduitReference(const string& p_code, const string& p_nom, double p_prix)
+{
+  if (p_code.length() != 11 || p_code.substr(0, 4) != "PRD-")
+    {
+      return false;
+    }
+  return genererCodeProduitReference(p_nom, p_prix) == p_code;
+}
+
+const string DESCRIPTION = "Smartphone Galaxy";
+const double PRIX = 499.90;
+
+} // namespace
+
+static void BM_GenererCodeProduit_Reference(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(genererCodeProduitReference(DESCRIPTION, PRIX));
+    }
+}
+BENCHMARK(BM_GenererCodeProduit_Reference);
+
+static void BM_GenererCodeProduit(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(genererCodeProduit(DESCRIPTION, PRIX));
+    }
+}
+BENCHMARK(BM_GenererCodeProduit);
+
+static void BM_EcrireCodeProduit(benchmark::State& state)
+{
+  TamponCodeProduit code;
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ecrireCodeProduit(DESCRIPTION, PRIX, code));
+      benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_EcrireCodeProduit);
+
+static void BM_ValiderCodeProduit_Reference(benchmark::State& state)
+{
+  string code = genererCodeProduit(DESCRIPTION, PRIX);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(validerCodeProduitReference(code, DESCRIPTION, PRIX));
+    }
+}
+BENCHMARK(BM_ValiderCodeProduit_Reference);
+
+static void BM_ValiderCodeProduit(benchmark::State& state)
+{
+  string code = genererCodeProduit(DESCRIPTION, PRIX);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(validerCodeProduit(code, DESCRIPTION, PRIX));
+    }
+}
+BENCHMARK(BM_ValiderCodeProduit);
+
+namespace {
+
+/**
+ * \brief Lot de descriptions et de prix, repris cycliquement par les mesures par lot.
+ */
+struct LotCodesProduits
+{
+  explicit LotCodesProduits(size_t p_nb)
+  {
+    const char* mots[] = {"Smartphone Galaxy", "T-shirt coton", "Casque Bluetooth", "Manteau d'hiver",
+                          "Écran 4K Ultra", "Pull laine mérinos", "Tablette 10 pouces", "Jean droit"};
+    for (size_t i = 0; i < p_nb; ++i)
+      {
+        textes.push_back(mots[i % 8]);
+        prix.push_back(5 + (i % 9973) / 100.0);
+      }
+    noms.assign(textes.begin(), textes.end());
+    for (size_t i = 0; i < p_nb; ++i)
+      {
+        textesCodes.push_back(genererCodeProduit(noms[i], prix[i]));
+      }
+    codes.assign(textesCodes.begin(), textesCodes.end());
+  }
+
+  vector<string> textes;
+  vector<string_view> noms;
+  vector<double> prix;
+  vector<string> textesCodes;
+  vector<string_view> codes;
+};
+
+const size_t TAILLE_LOT = 4096;
+
+} // namespace
+
+static void BM_EcrireCodeProduit_Boucle(benchmark::State& state)
+{
+  LotCodesProduits lot(TAILLE_LOT);
+  vector<TamponCodeProduit> codes(TAILLE_LOT);
+  for (auto _ : state)
+    {
+      for (size_t i = 0; i < TAILLE_LOT; ++i)
+        {
+          benchmark::DoNotOptimize(ecrireCodeProduit(lot.noms[i], lot.prix[i], codes[i]));
+        }
+      benchmark::ClobberMemory();
+    }
+  state.SetItemsProcessed(state.iterations() * TAILLE_LOT);
+}
+BENCHMARK(BM_EcrireCodeProduit_Boucle);
+
+static void BM_GenererCodesProduits(benchmark::State& state)
+{
+  NoyauCodesProduits noyau = static_cast<NoyauCodesProduits>(state.range(0));
+  if (!noyauCodesProduitsDisponible(noyau))
+    {
+      state.SkipWithError("noyau non pris en charge par ce processeur");
+      return;
+    }
+  LotCodesProduits lot(TAILLE_LOT);
+  vector<TamponCodeProduit> codes(TAILLE_LOT);
+  vector<size_t> tailles(TAILLE_LOT);
+  for (auto _ : state)
+    {
+      genererCodesProduits(lot.noms.data(), lot.prix.data(), TAILLE_LOT, codes.data(), tailles.data(), noyau);
+      benchmark::ClobberMemory();
+    }
+  state.SetItemsProcessed(state.iterations() * TAILLE_LOT);
+}
+BENCHMARK(BM_GenererCodesProduits)
+    ->ArgName("noyau")
+    ->Arg(static_cast<int>(NoyauCodesProduits::SCALAIRE))
+    ->Arg(static_cast<int>(NoyauCodesProduits::SSE42))
+    ->Arg(static_cast<int>(NoyauCodesProduits::AVX2));
+
+static void BM_ValiderCodesProduits(benchmark::State& state)
+{
+  NoyauCodesProduits noyau = static_cast<NoyauCodesProduits>(state.range(0));
+  if (!noyauCodesProduitsDisponible(noyau))
+    {
+      state.SkipWithError("noyau non pris en charge par ce processeur");
+      return;
+    }
+  LotCodesProduits lot(TAILLE_LOT);
+  vector<char> valides(TAILLE_LOT);
+  for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(validerCodesProduits(lot.codes.data(), lot.noms.data(), lot.prix.data(), TAILLE_LOT,
+                                                    reinterpret_cast<bool*>(valides.data()), noyau));
+    }
+  state.SetItemsProcessed(state.iterations() * TAILLE_LOT);
+}
+BENCHMARK(BM_ValiderCodesProduits)
+    ->ArgName("noyau")
+    ->Arg(static_cast<int>(NoyauCodesProduits::SCALAIRE))
+    ->Arg(static_cast<int>(NoyauCodesProduits::SSE42))
+    ->Arg(static_cast<int>(NoyauCodesProduits::AVX2));
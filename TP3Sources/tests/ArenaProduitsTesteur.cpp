@@ -0,0 +1,72 @@
+/**
+ * \file ArenaProduitsTesteur.cpp
+ * \brief Tests unitaires de la classe ArenaProduits
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "ArenaProduits.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "validationFormat.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+/**
+ * \brief Test de la méthode std::shared_ptr<T> creer(Args&&...)
+ *        Cas valides :
+ *          - Creer_DeuxProduits_comptesEtOctetsMisAJour
+ *          - Creer_ProduitsSuccessifs_voisinsEnMemoire
+ *          - Creer_ArenaRelacheeAvantLesProduits_produitsToujoursValides
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(ArenaProduits, Creer_DeuxProduits_comptesEtOctetsMisAJour)
+{
+  auto arena = make_shared<ArenaProduits>();
+  ASSERT_EQ(0u, arena->reqNombreObjets());
+
+  auto casque = arena->creer<Electronique>("Casque Bluetooth", 89.99, genererCodeProduit("Casque Bluetooth", 89.99), 24, false);
+  auto chandail = arena->creer<Vetement>("Chandail en laine", 49.99, genererCodeProduit("Chandail en laine", 49.99), "M", "Rouge");
+
+  ASSERT_EQ(2u, arena->reqNombreObjets());
+  ASSERT_GE(arena->reqOctetsUtilises(), sizeof(Electronique) + sizeof(Vetement));
+  ASSERT_EQ(24, casque->reqGarantieMois());
+  ASSERT_EQ("Rouge", chandail->reqCouleur());
+}
+
+TEST(ArenaProduits, Creer_ProduitsSuccessifs_voisinsEnMemoire)
+{
+  auto arena = make_shared<ArenaProduits>();
+  auto premier = arena->creer<Electronique>("Souris optique", 19.99, genererCodeProduit("Souris optique", 19.99), 12, false);
+  auto second = arena->creer<Electronique>("Clavier sans fil", 39.99, genererCodeProduit("Clavier sans fil", 39.99), 12, true);
+
+  uintptr_t adressePremier = reinterpret_cast<uintptr_t>(premier.get());
+  uintptr_t adresseSecond = reinterpret_cast<uintptr_t>(second.get());
+
+  ASSERT_GT(adresseSecond, adressePremier);
+  ASSERT_LE(adresseSecond - adressePremier, arena->reqOctetsUtilises());
+}
+
+TEST(ArenaProduits, Creer_ArenaRelacheeAvantLesProduits_produitsToujoursValides)
+{
+  auto arena = make_shared<ArenaProduits>();
+  shared_ptr<Produit> produit = arena->creer<Vetement>("Manteau d'hiver doublé", 199.0,
+                                                       genererCodeProduit("Manteau d'hiver doublé", 199.0), "L", "Noir");
+  weak_ptr<ArenaProduits> observateur = arena;
+
+  arena.reset();
+
+  ASSERT_FALSE(observateur.expired());
+  ASSERT_EQ("Manteau d'hiver doublé", produit->reqDescription());
+
+  produit.reset();
+
+  ASSERT_TRUE(observateur.expired());
+}
@@ -6,6 +6,7 @@
  * \version 2.0
  */
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <sstream>
 #include "Catalogue.h"
 #include "Vetement.h"
@@ -149,6 +150,8 @@ TEST_F(UnCatalogue, AjouterProduit_ProduitAjoute_catalogueFormateContientProduit
  * \brief Test de la méthode void ajouterProduit(const Produit&)
  *        Cas invalides :
  *          - AjouterProduit_ProduitDejaPresent_ProduitDejaPresentException
+ *          - AjouterProduit_CodeMalForme_ProduitException (sans contrats seulement : en
+ *            mode débogage, le constructeur du produit refuse déjà le code)
  */
 TEST_F(UnCatalogue, AjouterProduit_ProduitDejaPresent_ProduitDejaPresentException)
 {
@@ -161,6 +164,122 @@ TEST_F(UnCatalogue, AjouterProduit_ProduitDejaPresent_ProduitDejaPresentExceptio
   ASSERT_THROW(f_catalogue.ajouterProduit(doublon), ProduitDejaPresentException);
 }
 
+#ifdef NDEBUG
+TEST_F(UnCatalogue, AjouterProduit_CodeMalForme_ProduitException)
+{
+  Vetement malForme("Tablette", 10, "garbage", "M", "Blanc");
+
+  ASSERT_THROW(f_catalogue.ajouterProduit(malForme), ProduitException);
+  ASSERT_THROW(f_catalogue.ajouterProduit(std::make_unique<Vetement>(malForme)), ProduitException);
+  ASSERT_FALSE(f_catalogue.contientProduit("autre code mal forme"));
+}
+#endif
+
+
+/**
+ * \brief Test de la méthode void ajouterProduit(std::unique_ptr<Produit>)
+ *        Cas valides :
+ *          - AjouterProduitPossede_ProduitAjoute_descriptionRepriseSansCopie
+ *        Cas invalides :
+ *          - AjouterProduitPossede_ProduitDejaPresent_ProduitDejaPresentException
+ */
+TEST_F(UnCatalogue, AjouterProduitPossede_ProduitAjoute_descriptionRepriseSansCopie)
+{
+  std::string desc = "Veste en laine bouillie, doublure satin";
+  double prix = 129.00;
+  auto veste = std::make_unique<Vetement>(desc, prix, genererCodeProduit(desc, prix), "L", "Gris");
+  const char* texteDescription = veste->reqDescription().data();
+
+  f_catalogue.ajouterProduit(std::move(veste));
+
+  const Produit& ajoute = f_catalogue.trouverProduit(genererCodeProduit(desc, prix));
+  ASSERT_EQ(desc, ajoute.reqDescription());
+  ASSERT_EQ(texteDescription, ajoute.reqDescription().data());
+}
+
+TEST_F(UnCatalogue, AjouterProduitPossede_ProduitDejaPresent_ProduitDejaPresentException)
+{
+  std::string codeV = genererCodeProduit("T-shirt coton", 19.95);
+
+  ASSERT_THROW(f_catalogue.ajouterProduit(std::make_unique<Vetement>("T-shirt coton", 19.95, codeV, "M", "Blanc")),
+               ProduitDejaPresentException);
+  ASSERT_EQ(2u, f_catalogue.reqNombreProduits());
+}
+
+namespace {
+/**
+ * \brief Vêtements dont les descriptions commencent par quatre lettres distinctes, donc de codes distincts.
+ */
+std::vector<std::unique_ptr<Produit>> vetementsDistincts(size_t p_nb)
+{
+  std::vector<std::unique_ptr<Produit>> vetements;
+  for (size_t i = 0; i < p_nb; ++i)
+    {
+      std::string description;
+      for (size_t reste = i, k = 0; k < 4; ++k, reste /= 26)
+        {
+          description += static_cast<char>('A' + reste % 26);
+        }
+      description += " lin";
+      vetements.push_back(std::make_unique<Vetement>(description, 10, genererCodeProduit(description, 10), "S", "Bleu"));
+    }
+  return vetements;
+}
+} // namespace
+
+/**
+ * \brief Test de la méthode void ajouterProduits(std::vector<std::unique_ptr<Produit>>)
+ *        Cas valides :
+ *          - AjouterProduits_PlusieursSousIndex_identiqueAAjouterProduit
+ *        Cas invalides :
+ *          - AjouterProduits_DoublonDansLeLot_precedentsAjoutesPuisProduitDejaPresentException
+ *          - AjouterProduits_CodeDejaPresent_precedentsAjoutesPuisProduitDejaPresentException
+ */
+TEST_F(UnCatalogue, AjouterProduits_PlusieursSousIndex_identiqueAAjouterProduit)
+{
+  Catalogue unParUn(f_catalogue);
+  for (auto& vetement : vetementsDistincts(10000))
+    {
+      unParUn.ajouterProduit(std::move(vetement));
+    }
+
+  f_catalogue.ajouterProduits(vetementsDistincts(10000));
+
+  ASSERT_EQ(10002u, f_catalogue.reqNombreProduits());
+  ASSERT_EQ(unParUn.reqCatalogueFormate(), f_catalogue.reqCatalogueFormate());
+  for (size_t i = 0; i < f_catalogue.reqNombreProduits(); ++i)
+    {
+      ASSERT_EQ(i, f_catalogue.reqPositionProduit(f_catalogue.reqProduit(i).reqCode()));
+    }
+}
+
+TEST_F(UnCatalogue, AjouterProduits_DoublonDansLeLot_precedentsAjoutesPuisProduitDejaPresentException)
+{
+  std::vector<std::unique_ptr<Produit>> vetements = vetementsDistincts(6000);
+  std::string codeDoublon = vetements[4000]->reqCode();
+  vetements[5000] = std::make_unique<Vetement>(*static_cast<const Vetement*>(vetements[4000].get()));
+  std::string codeNonAjoute = vetements[5500]->reqCode();
+
+  ASSERT_THROW(f_catalogue.ajouterProduits(std::move(vetements)), ProduitDejaPresentException);
+  ASSERT_EQ(5002u, f_catalogue.reqNombreProduits());
+  ASSERT_EQ(4002u, f_catalogue.reqPositionProduit(codeDoublon));
+  ASSERT_FALSE(f_catalogue.contientProduit(codeNonAjoute));
+  f_catalogue.supprimerProduit(codeDoublon);
+  ASSERT_FALSE(f_catalogue.contientProduit(codeDoublon));
+}
+
+TEST_F(UnCatalogue, AjouterProduits_CodeDejaPresent_precedentsAjoutesPuisProduitDejaPresentException)
+{
+  std::vector<std::unique_ptr<Produit>> vetements = vetementsDistincts(3);
+  std::string codeV = genererCodeProduit("T-shirt coton", 19.95);
+  vetements.insert(vetements.begin() + 1, std::make_unique<Vetement>("T-shirt coton", 19.95, codeV, "M", "Blanc"));
+  std::string codeNonAjoute = vetements[2]->reqCode();
+
+  ASSERT_THROW(f_catalogue.ajouterProduits(std::move(vetements)), ProduitDejaPresentException);
+  ASSERT_EQ(3u, f_catalogue.reqNombreProduits());
+  ASSERT_EQ(0u, f_catalogue.reqPositionProduit(codeV));
+  ASSERT_FALSE(f_catalogue.contientProduit(codeNonAjoute));
+}
 
 /**
  * \brief Test de la méthode supprimerProduit(const std::string&)
@@ -196,6 +315,646 @@ TEST_F(UnCatalogue, SupprimerProduit_ProduitAbsent_ProduitAbsentException)
 
 
 
+/**
+ * \brief Test de la méthode supprimerProduit(const std::string&, ModeSuppression)
+ *        Cas valides :
+ *          - SupprimerProduit_ModePermutation_dernierProduitDeplace
+ */
+TEST_F(UnCatalogue, SupprimerProduit_ModePermutation_dernierProduitDeplace)
+{
+  std::string codeV = genererCodeProduit("T-shirt coton", 19.95);
+  std::string codeE = genererCodeProduit("Casque Bluetooth", 89.99);
+
+  f_catalogue.supprimerProduit(codeV, Catalogue::ModeSuppression::PERMUTATION);
+
+  ASSERT_THROW(f_catalogue.trouverProduit(codeV), ProduitAbsentException);
+  ASSERT_EQ(codeE, f_catalogue.trouverProduit(codeE).reqCode());
+  ASSERT_EQ(std::string::npos, f_catalogue.reqCatalogueFormate().find("T-shirt coton"));
+}
+
+/**
+ * \brief Test de la méthode void asgModeSuppression(ModeSuppression)
+ *        Cas valides :
+ *          - AsgModeSuppression_ModePermutation_modeAssigne
+ */
+TEST_F(UnCatalogue, AsgModeSuppression_ModePermutation_modeAssigne)
+{
+  ASSERT_EQ(Catalogue::ModeSuppression::ORDONNEE, f_catalogue.reqModeSuppression());
+
+  f_catalogue.asgModeSuppression(Catalogue::ModeSuppression::PERMUTATION);
+
+  ASSERT_EQ(Catalogue::ModeSuppression::PERMUTATION, f_catalogue.reqModeSuppression());
+}
+
+/**
+ * \brief Test de la méthode supprimerProduits(const std::vector<std::string>&)
+ *        Cas valides :
+ *          - SupprimerProduits_CodesPresents_ordreConserve
+ *        Cas invalides :
+ *          - SupprimerProduits_UnCodeAbsent_catalogueInchange
+ */
+TEST_F(UnCatalogue, SupprimerProduits_CodesPresents_ordreConserve)
+{
+  std::string descJ = "Jean slim";
+  std::string codeJ = genererCodeProduit(descJ, 49.90);
+  f_catalogue.ajouterProduit(Vetement(descJ, 49.90, codeJ, "L", "Bleu"));
+
+  std::string codeV = genererCodeProduit("T-shirt coton", 19.95);
+  std::string codeE = genererCodeProduit("Casque Bluetooth", 89.99);
+
+  f_catalogue.supprimerProduits({codeV, codeV});
+
+  std::string resultat = f_catalogue.reqCatalogueFormate();
+  ASSERT_EQ(std::string::npos, resultat.find("T-shirt coton"));
+  ASSERT_LT(resultat.find("Casque Bluetooth"), resultat.find(descJ));
+  ASSERT_EQ(codeJ, f_catalogue.trouverProduit(codeJ).reqCode());
+  ASSERT_EQ(codeE, f_catalogue.trouverProduit(codeE).reqCode());
+}
+
+TEST_F(UnCatalogue, SupprimerProduits_UnCodeAbsent_catalogueInchange)
+{
+  std::string codeV = genererCodeProduit("T-shirt coton", 19.95);
+  std::string avant = f_catalogue.reqCatalogueFormate();
+
+  ASSERT_THROW(f_catalogue.supprimerProduits({codeV, "NNN005N"}), ProduitAbsentException);
+  ASSERT_EQ(avant, f_catalogue.reqCatalogueFormate());
+}
+
+/**
+ * \brief Test de la méthode const Produit& trouverProduit(const std::string&) const
+ *        Cas valides :
+ *          - TrouverProduit_ProduitPresent_retourneProduit
+ *          - TrouverProduit_ApresSuppression_indexMisAJour
+ *        Cas invalides :
+ *          - TrouverProduit_ProduitAbsent_ProduitAbsentException
+ */
+TEST_F(UnCatalogue, TrouverProduit_ProduitPresent_retourneProduit)
+{
+  std::string codeE = genererCodeProduit("Casque Bluetooth", 89.99);
+
+  const Produit& produit = f_catalogue.trouverProduit(codeE);
+
+  ASSERT_EQ(codeE, produit.reqCode());
+  ASSERT_EQ("Casque Bluetooth", produit.reqDescription());
+}
+
+TEST_F(UnCatalogue, TrouverProduit_ApresSuppression_indexMisAJour)
+{
+  std::string codeV = genererCodeProduit("T-shirt coton", 19.95);
+  std::string codeE = genererCodeProduit("Casque Bluetooth", 89.99);
+
+  f_catalogue.supprimerProduit(codeV);
+
+  ASSERT_THROW(f_catalogue.trouverProduit(codeV), ProduitAbsentException);
+  ASSERT_EQ(codeE, f_catalogue.trouverProduit(codeE).reqCode());
+}
+
+TEST_F(UnCatalogue, TrouverProduit_ProduitAbsent_ProduitAbsentException)
+{
+  ASSERT_THROW(f_catalogue.trouverProduit("NNN005N"), ProduitAbsentException);
+}
+
+/**
+ * \brief Test de la méthode const Produit& trouverProduit(const util::CodeProduit&) const
+ *        Cas valides :
+ *          - TrouverProduit_CodeCompacte_retourneProduit
+ *        Cas invalides :
+ *          - TrouverProduit_CodeCompacteAbsent_ProduitAbsentException
+ */
+TEST_F(UnCatalogue, TrouverProduit_CodeCompacte_retourneProduit)
+{
+  CodeProduit codeV = CodeProduit::generer("T-shirt coton", 19.95);
+
+  ASSERT_EQ("T-shirt coton", f_catalogue.trouverProduit(codeV).reqDescription());
+}
+
+TEST_F(UnCatalogue, TrouverProduit_CodeCompacteAbsent_ProduitAbsentException)
+{
+  ASSERT_THROW(f_catalogue.trouverProduit(CodeProduit("PRD-ABCD-12")), ProduitAbsentException);
+  ASSERT_THROW(f_catalogue.trouverProduit(CodeProduit()), ProduitAbsentException);
+}
+
+/**
+ * \brief Test de la méthode bool contientProduit(const std::string&) const
+ *        Cas valides :
+ *          - ContientProduit_ProduitPresent_true
+ *          - ContientProduit_ProduitAbsentOuCodeMalForme_false
+ */
+TEST_F(UnCatalogue, ContientProduit_ProduitPresent_true)
+{
+  ASSERT_TRUE(f_catalogue.contientProduit(genererCodeProduit("Casque Bluetooth", 89.99)));
+}
+
+TEST_F(UnCatalogue, ContientProduit_ProduitAbsentOuCodeMalForme_false)
+{
+  ASSERT_FALSE(f_catalogue.contientProduit("PRD-ABCD-12"));
+  ASSERT_FALSE(f_catalogue.contientProduit("NNN005N"));
+}
+
+/**
+ * \brief Test de la méthode std::size_t reqPositionProduit(const std::string&) const
+ *        Cas valides :
+ *          - ReqPositionProduit_ProduitPresent_positionDansLaListe
+ *          - ReqPositionProduit_ApresSuppression_positionMiseAJour
+ *        Cas invalides :
+ *          - ReqPositionProduit_ProduitAbsent_ProduitAbsentException
+ */
+TEST_F(UnCatalogue, ReqPositionProduit_ProduitPresent_positionDansLaListe)
+{
+  ASSERT_EQ(0u, f_catalogue.reqPositionProduit(genererCodeProduit("T-shirt coton", 19.95)));
+  ASSERT_EQ(1u, f_catalogue.reqPositionProduit(genererCodeProduit("Casque Bluetooth", 89.99)));
+}
+
+TEST_F(UnCatalogue, ReqPositionProduit_ApresSuppression_positionMiseAJour)
+{
+  f_catalogue.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+
+  ASSERT_EQ(0u, f_catalogue.reqPositionProduit(genererCodeProduit("Casque Bluetooth", 89.99)));
+}
+
+TEST_F(UnCatalogue, ReqPositionProduit_ProduitAbsent_ProduitAbsentException)
+{
+  ASSERT_THROW(f_catalogue.reqPositionProduit("PRD-ABCD-12"), ProduitAbsentException);
+}
+
+/**
+ * \brief Test de la méthode void asgPrixProduit(const std::string&, double)
+ *        Cas valides :
+ *          - AsgPrixProduit_ProduitPresent_prixEtIndexMisAJour
+ *          - AsgPrixProduit_ApresFormatage_texteFormateMisAJour
+ *        Cas invalides :
+ *          - AsgPrixProduit_ProduitAbsent_ProduitAbsentException
+ *          - AsgPrixProduit_NouveauCodeDejaPresent_catalogueInchange
+ *          - AsgPrixProduit_PrixNegatif_PreconditionException
+ */
+TEST_F(UnCatalogue, AsgPrixProduit_ProduitPresent_prixEtIndexMisAJour)
+{
+  std::string ancienCode = genererCodeProduit("Casque Bluetooth", 89.99);
+  std::string nouveauCode = genererCodeProduit("Casque Bluetooth", 79.95);
+
+  f_catalogue.asgPrixProduit(ancienCode, 79.95);
+
+  ASSERT_EQ(2u, f_catalogue.reqNombreProduits());
+  ASSERT_EQ(79.95, f_catalogue.trouverProduit(nouveauCode).reqPrix());
+  ASSERT_EQ("Casque Bluetooth", f_catalogue.reqProduit(1).reqDescription());
+  ASSERT_THROW(f_catalogue.trouverProduit(ancienCode), ProduitAbsentException);
+}
+
+TEST_F(UnCatalogue, AsgPrixProduit_ApresFormatage_texteFormateMisAJour)
+{
+  std::string avant = f_catalogue.reqCatalogueFormate();
+
+  f_catalogue.asgPrixProduit(genererCodeProduit("Casque Bluetooth", 89.99), 79.95);
+
+  std::string apres = f_catalogue.reqCatalogueFormate();
+  ASSERT_NE(std::string::npos, avant.find("Casque Bluetooth\n89.99\n"));
+  ASSERT_EQ(std::string::npos, apres.find("Casque Bluetooth\n89.99\n"));
+  ASSERT_NE(std::string::npos, apres.find("Casque Bluetooth\n79.95\n" + genererCodeProduit("Casque Bluetooth", 79.95)));
+  ASSERT_EQ(0u, apres.find(avant.substr(0, avant.find("Produit Electronique"))));
+
+  Catalogue reference(f_nom, f_date);
+  for (std::size_t i = 0; i < f_catalogue.reqNombreProduits(); ++i)
+    {
+      reference.ajouterProduit(f_catalogue.reqProduit(i));
+    }
+  ASSERT_EQ(reference.reqCatalogueFormate(), apres);
+}
+
+TEST_F(UnCatalogue, AsgPrixProduit_ProduitAbsent_ProduitAbsentException)
+{
+  ASSERT_THROW(f_catalogue.asgPrixProduit("PRD-ABCD-12", 10.0), ProduitAbsentException);
+}
+
+TEST_F(UnCatalogue, AsgPrixProduit_NouveauCodeDejaPresent_catalogueInchange)
+{
+  // « T-shirt lin » à 19.95 aurait le même code que « T-shirt coton » à 19.95.
+  std::string codeLin = genererCodeProduit("T-shirt lin", 19.50);
+  f_catalogue.ajouterProduit(Vetement("T-shirt lin", 19.50, codeLin, "S", "Bleu"));
+  std::string avant = f_catalogue.reqCatalogueFormate();
+
+  ASSERT_THROW(f_catalogue.asgPrixProduit(codeLin, 19.95), ProduitDejaPresentException);
+  ASSERT_EQ(19.50, f_catalogue.trouverProduit(codeLin).reqPrix());
+  ASSERT_EQ("T-shirt coton", f_catalogue.trouverProduit(genererCodeProduit("T-shirt coton", 19.95)).reqDescription());
+  ASSERT_EQ(avant, f_catalogue.reqCatalogueFormate());
+}
+
+TEST_F(UnCatalogue, AsgPrixProduit_PrixNegatif_PreconditionException)
+{
+  ASSERT_THROW(f_catalogue.asgPrixProduit(genererCodeProduit("Casque Bluetooth", 89.99), -1.0), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode double reqValeurTotale() const
+ *        Cas valides :
+ *          - ReqValeurTotale_DeuxProduits_sommeDesPrix
+ *          - ReqValeurTotale_CatalogueVide_zero
+ *          - ReqValeurTotale_ApresChangementPrixEtSuppression_valeurMiseAJour
+ */
+TEST_F(UnCatalogue, ReqValeurTotale_DeuxProduits_sommeDesPrix)
+{
+  ASSERT_DOUBLE_EQ(19.95 + 89.99, f_catalogue.reqValeurTotale());
+}
+
+TEST(CatalogueTest, ReqValeurTotale_CatalogueVide_zero)
+{
+  Catalogue catalogue("Vide", Date(1, 1, 2025));
+
+  ASSERT_DOUBLE_EQ(0.0, catalogue.reqValeurTotale());
+}
+
+TEST_F(UnCatalogue, ReqValeurTotale_ApresChangementPrixEtSuppression_valeurMiseAJour)
+{
+  f_catalogue.asgPrixProduit(genererCodeProduit("Casque Bluetooth", 89.99), 1.50);
+  ASSERT_DOUBLE_EQ(19.95 + 1.50, f_catalogue.reqValeurTotale());
+
+  f_catalogue.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+  ASSERT_DOUBLE_EQ(1.50, f_catalogue.reqValeurTotale());
+}
+
+/**
+ * \brief Test de la méthode std::vector<std::size_t> trouverPositionsParPrix(double, double) const
+ *        Cas valides :
+ *          - TrouverPositionsParPrix_Fourchette_positionsCroissantesBornesIncluses
+ *          - TrouverPositionsParPrix_PlusieursBlocsApresSuppression_positionsDecalees
+ *        Cas invalides :
+ *          - TrouverPositionsParPrix_MinSuperieurAuMax_PreconditionException
+ */
+TEST_F(UnCatalogue, TrouverPositionsParPrix_Fourchette_positionsCroissantesBornesIncluses)
+{
+  f_catalogue.ajouterProduit(Vetement("Chandail en laine", 49.99, genererCodeProduit("Chandail en laine", 49.99), "L", "Rouge"));
+
+  ASSERT_EQ(std::vector<size_t>({0, 2}), f_catalogue.trouverPositionsParPrix(19.95, 50.0));
+  ASSERT_EQ(std::vector<size_t>({1}), f_catalogue.trouverPositionsParPrix(89.99, 89.99));
+  ASSERT_TRUE(f_catalogue.trouverPositionsParPrix(100.0, 200.0).empty());
+}
+
+TEST(CatalogueTest, TrouverPositionsParPrix_PlusieursBlocsApresSuppression_positionsDecalees)
+{
+  Catalogue catalogue("Grand", Date(1, 9, 2025));
+  std::string premierCode;
+  double total = 0;
+  for (int i = 0; i < 2100; ++i)
+    {
+      std::string description;
+      description += static_cast<char>('A' + i % 26);
+      description += static_cast<char>('a' + i / 26 % 26);
+      description += static_cast<char>('a' + i / 676);
+      description += "rticle";
+      double prix = 10 + i;
+      catalogue.ajouterProduit(Vetement(description, prix, genererCodeProduit(description, prix), "M", "Noir"));
+      if (i == 0)
+        {
+          premierCode = genererCodeProduit(description, prix);
+        }
+      total += prix;
+    }
+
+  catalogue.supprimerProduit(premierCode);
+
+  ASSERT_DOUBLE_EQ(total - 10, catalogue.reqValeurTotale());
+  ASSERT_EQ(std::vector<size_t>({1029, 1030}), catalogue.trouverPositionsParPrix(1040, 1041));
+  ASSERT_DOUBLE_EQ(1040, catalogue.reqProduit(1029).reqPrix());
+}
+
+TEST_F(UnCatalogue, TrouverPositionsParPrix_MinSuperieurAuMax_PreconditionException)
+{
+  ASSERT_THROW(f_catalogue.trouverPositionsParPrix(50.0, 10.0), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes produitsDansIntervallePrix(double, double), moinsChers(size_t) et plusChers(size_t)
+ *        Cas valides :
+ *          - ProduitsDansIntervallePrix_Fourchette_produitsDuCatalogueSansCopie
+ *          - MoinsChersPlusChers_TroisProduits_ordreDesPrix
+ *          - ProduitsDansIntervallePrix_ApresAjoutSuppressionEtChangementPrix_indexAJour
+ *          - ProduitsDansIntervallePrix_CopieModifiee_originalInchange
+ *        Cas invalides :
+ *          - ProduitsDansIntervallePrix_MinSuperieurAuMax_PreconditionException
+ */
+TEST_F(UnCatalogue, ProduitsDansIntervallePrix_Fourchette_produitsDuCatalogueSansCopie)
+{
+  std::vector<const Produit*> produits = f_catalogue.produitsDansIntervallePrix(10.0, 20.0);
+
+  ASSERT_EQ(1u, produits.size());
+  ASSERT_EQ(&f_catalogue.trouverProduit(genererCodeProduit("T-shirt coton", 19.95)), produits[0]);
+}
+
+TEST_F(UnCatalogue, MoinsChersPlusChers_TroisProduits_ordreDesPrix)
+{
+  f_catalogue.ajouterProduit(Vetement("Chandail en laine", 49.99, genererCodeProduit("Chandail en laine", 49.99), "L", "Rouge"));
+
+  std::vector<const Produit*> moinsChers = f_catalogue.moinsChers(2);
+  std::vector<const Produit*> plusChers = f_catalogue.plusChers(5);
+
+  ASSERT_EQ(2u, moinsChers.size());
+  ASSERT_DOUBLE_EQ(19.95, moinsChers[0]->reqPrix());
+  ASSERT_DOUBLE_EQ(49.99, moinsChers[1]->reqPrix());
+  ASSERT_EQ(3u, plusChers.size());
+  ASSERT_DOUBLE_EQ(89.99, plusChers[0]->reqPrix());
+  ASSERT_DOUBLE_EQ(19.95, plusChers[2]->reqPrix());
+}
+
+TEST_F(UnCatalogue, ProduitsDansIntervallePrix_ApresAjoutSuppressionEtChangementPrix_indexAJour)
+{
+  ASSERT_EQ(2u, f_catalogue.produitsDansIntervallePrix(0.0, 100.0).size());
+
+  f_catalogue.ajouterProduit(Vetement("Chandail en laine", 49.99, genererCodeProduit("Chandail en laine", 49.99), "L", "Rouge"));
+  f_catalogue.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+  f_catalogue.asgPrixProduit(genererCodeProduit("Casque Bluetooth", 89.99), 1.50);
+
+  std::vector<const Produit*> produits = f_catalogue.produitsDansIntervallePrix(0.0, 100.0);
+  ASSERT_EQ(2u, produits.size());
+  ASSERT_DOUBLE_EQ(1.50, produits[0]->reqPrix());
+  ASSERT_EQ("Chandail en laine", produits[1]->reqDescription());
+  ASSERT_TRUE(f_catalogue.produitsDansIntervallePrix(80.0, 100.0).empty());
+}
+
+TEST_F(UnCatalogue, ProduitsDansIntervallePrix_CopieModifiee_originalInchange)
+{
+  ASSERT_EQ(2u, f_catalogue.moinsChers(10).size());
+  Catalogue copie(f_catalogue);
+
+  copie.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+
+  ASSERT_EQ(1u, copie.moinsChers(10).size());
+  ASSERT_EQ(2u, f_catalogue.moinsChers(10).size());
+}
+
+TEST_F(UnCatalogue, ProduitsDansIntervallePrix_MinSuperieurAuMax_PreconditionException)
+{
+  ASSERT_THROW(f_catalogue.produitsDansIntervallePrix(50.0, 10.0), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes rechercherProduits(const std::string&) et
+ *        rechercherProduits(const std::string&, OperateurRecherche)
+ *        Cas valides :
+ *          - RechercherProduits_MotsSansAccentNiMajuscule_produitsDuCatalogue
+ *          - RechercherProduits_OuEtPrefixe_produitsDuCatalogue
+ *          - RechercherProduits_ApresAjoutSuppressionEtChangementPrix_indexAJour
+ *          - RechercherProduits_CopieModifiee_originalInchange
+ *          - RechercherProduits_RequeteSansMot_aucunProduit
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnCatalogue, RechercherProduits_MotsSansAccentNiMajuscule_produitsDuCatalogue)
+{
+  f_catalogue.ajouterProduit(Electronique("Écran plat", 249.99, genererCodeProduit("Écran plat", 249.99), 24, false));
+
+  std::vector<const Produit*> produits = f_catalogue.rechercherProduits("ECRAN");
+
+  ASSERT_EQ(1u, produits.size());
+  ASSERT_EQ(&f_catalogue.reqProduit(2), produits[0]);
+  ASSERT_EQ(1u, f_catalogue.rechercherProduits("casque bluetooth").size());
+  ASSERT_TRUE(f_catalogue.rechercherProduits("casque coton").empty());
+}
+
+TEST_F(UnCatalogue, RechercherProduits_OuEtPrefixe_produitsDuCatalogue)
+{
+  f_catalogue.ajouterProduit(Vetement("Chandail en coton", 49.99, genererCodeProduit("Chandail en coton", 49.99), "L", "Rouge"));
+
+  std::vector<const Produit*> ou = f_catalogue.rechercherProduits("casque chandail", Catalogue::OperateurRecherche::OU);
+  std::vector<const Produit*> prefixe = f_catalogue.rechercherProduits("co*");
+
+  ASSERT_EQ(2u, ou.size());
+  ASSERT_NE(ou.end(), std::find(ou.begin(), ou.end(), &f_catalogue.reqProduit(1)));
+  ASSERT_NE(ou.end(), std::find(ou.begin(), ou.end(), &f_catalogue.reqProduit(2)));
+  ASSERT_EQ(2u, prefixe.size());
+  ASSERT_NE(prefixe.end(), std::find(prefixe.begin(), prefixe.end(), &f_catalogue.reqProduit(0)));
+  ASSERT_EQ(1u, f_catalogue.rechercherProduits("cha* cot*").size());
+}
+
+TEST_F(UnCatalogue, RechercherProduits_ApresAjoutSuppressionEtChangementPrix_indexAJour)
+{
+  ASSERT_EQ(1u, f_catalogue.rechercherProduits("coton").size());
+
+  f_catalogue.ajouterProduit(Vetement("Chandail en coton", 49.99, genererCodeProduit("Chandail en coton", 49.99), "L", "Rouge"));
+  f_catalogue.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+  f_catalogue.asgPrixProduit(genererCodeProduit("Chandail en coton", 49.99), 39.99);
+
+  std::vector<const Produit*> produits = f_catalogue.rechercherProduits("coton");
+  ASSERT_EQ(1u, produits.size());
+  ASSERT_DOUBLE_EQ(39.99, produits[0]->reqPrix());
+  ASSERT_TRUE(f_catalogue.rechercherProduits("t-shirt").empty());
+}
+
+TEST_F(UnCatalogue, RechercherProduits_CopieModifiee_originalInchange)
+{
+  ASSERT_EQ(1u, f_catalogue.rechercherProduits("coton").size());
+  Catalogue copie(f_catalogue);
+
+  copie.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+
+  ASSERT_TRUE(copie.rechercherProduits("coton").empty());
+  ASSERT_EQ(1u, f_catalogue.rechercherProduits("coton").size());
+}
+
+TEST_F(UnCatalogue, RechercherProduits_RequeteSansMot_aucunProduit)
+{
+  ASSERT_TRUE(f_catalogue.rechercherProduits("").empty());
+  ASSERT_TRUE(f_catalogue.rechercherProduits(" - * ", Catalogue::OperateurRecherche::OU).empty());
+}
+
+/**
+ * \brief Test de la méthode rechercherApprox(const std::string&, size_t)
+ *        Cas valides :
+ *          - RechercherApprox_FauteDeFrappe_produitsDuCatalogue
+ *          - RechercherApprox_PlusieursProduits_duPlusProcheAuMoinsProche
+ *          - RechercherApprox_ApresSuppressionEtCopie_indexAJour
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnCatalogue, RechercherApprox_FauteDeFrappe_produitsDuCatalogue)
+{
+  std::vector<const Produit*> produits = f_catalogue.rechercherApprox("casqe blutooth", 10);
+
+  ASSERT_EQ(1u, produits.size());
+  ASSERT_EQ(&f_catalogue.reqProduit(1), produits[0]);
+  ASSERT_EQ(1u, f_catalogue.rechercherApprox("t-shirt cot", 10).size());
+  ASSERT_TRUE(f_catalogue.rechercherApprox("casque coton", 10).empty());
+}
+
+TEST_F(UnCatalogue, RechercherApprox_PlusieursProduits_duPlusProcheAuMoinsProche)
+{
+  f_catalogue.ajouterProduit(Vetement("Chandail en coton", 49.99, genererCodeProduit("Chandail en coton", 49.99), "L", "Rouge"));
+  f_catalogue.ajouterProduit(Vetement("Chandail en cotons", 45.50, genererCodeProduit("Chandail en cotons", 45.50), "L", "Bleu"));
+
+  std::vector<const Produit*> produits = f_catalogue.rechercherApprox("chandial cotons", 10);
+
+  ASSERT_EQ(2u, produits.size());
+  ASSERT_EQ(&f_catalogue.reqProduit(3), produits[0]);
+  ASSERT_EQ(&f_catalogue.reqProduit(2), produits[1]);
+  ASSERT_EQ(1u, f_catalogue.rechercherApprox("chandial cotons", 1).size());
+}
+
+TEST_F(UnCatalogue, RechercherApprox_ApresSuppressionEtCopie_indexAJour)
+{
+  ASSERT_EQ(1u, f_catalogue.rechercherApprox("cotton", 10).size());
+  Catalogue copie(f_catalogue);
+
+  copie.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+
+  ASSERT_TRUE(copie.rechercherApprox("cotton", 10).empty());
+  ASSERT_EQ(1u, f_catalogue.rechercherApprox("cotton", 10).size());
+}
+
+/**
+ * \brief Test de la méthode construireIndex()
+ *        Cas valides :
+ *          - ConstruireIndex_PuisAjoutDansUneCopie_indexAJourEtPartages
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnCatalogue, ConstruireIndex_PuisAjoutDansUneCopie_indexAJourEtPartages)
+{
+  f_catalogue.construireIndex();
+  Catalogue copie(f_catalogue);
+
+  copie.ajouterProduit(Vetement("Chandail en coton", 49.99, genererCodeProduit("Chandail en coton", 49.99), "L", "Rouge"));
+
+  ASSERT_EQ(2u, copie.rechercherProduits("coton").size());
+  ASSERT_EQ(1u, copie.produitsDansIntervallePrix(40, 60).size());
+  ASSERT_EQ(1u, f_catalogue.rechercherProduits("coton").size());
+  ASSERT_TRUE(f_catalogue.produitsDansIntervallePrix(40, 60).empty());
+}
+
+namespace {
+/**
+ * \brief Produits retenus en examinant chaque produit : les vêtements noirs d'une taille
+ *        et les produits électroniques reconditionnés garantis au moins p_garantieMinimale mois.
+ */
+std::vector<const Produit*> filtrerParParcours(const Catalogue& p_catalogue, const std::string& p_taille,
+                                               int p_garantieMinimale)
+{
+  std::vector<const Produit*> produits;
+  for (size_t i = 0; i < p_catalogue.reqNombreProduits(); ++i)
+    {
+      const Produit* produit = &p_catalogue.reqProduit(i);
+      const Vetement* vetement = dynamic_cast<const Vetement*>(produit);
+      const Electronique* electronique = dynamic_cast<const Electronique*>(produit);
+      if ((vetement && vetement->reqTaille() == p_taille && vetement->reqCouleur() == "Noir")
+          || (electronique && electronique->reqEstReconditionne() && electronique->reqGarantieMois() >= p_garantieMinimale))
+        {
+          produits.push_back(produit);
+        }
+    }
+  return produits;
+}
+} // namespace
+
+/**
+ * \brief Test des méthodes filtrerProduits(const FiltreAttributs&) et compterProduits(const FiltreAttributs&)
+ *        Cas valides :
+ *          - FiltrerProduits_TailleEtCouleur_vetementsRetenus
+ *          - FiltrerProduits_ReconditionneEtGarantie_electroniquesRetenus
+ *          - FiltrerProduits_SansCritere_tousLesProduits
+ *          - FiltrerProduits_PlusieursBlocsApresSuppressions_memeResultatQuUnParcours
+ *          - FiltrerProduits_ApresCopieEtViderCache_indexAJour
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnCatalogue, FiltrerProduits_TailleEtCouleur_vetementsRetenus)
+{
+  f_catalogue.ajouterProduit(Vetement("Chandail en laine", 49.99, genererCodeProduit("Chandail en laine", 49.99), "XL", "Noir"));
+  f_catalogue.ajouterProduit(Vetement("Manteau d'hiver", 199.0, genererCodeProduit("Manteau d'hiver", 199.0), "XL", "Rouge"));
+
+  ASSERT_EQ(std::vector<const Produit*>({&f_catalogue.reqProduit(2)}),
+            f_catalogue.filtrerProduits(FiltreAttributs().taille("XL").couleur("Noir")));
+  ASSERT_EQ(2u, f_catalogue.compterProduits(FiltreAttributs().taille("XL")));
+  ASSERT_EQ(2u, f_catalogue.compterProduits(FiltreAttributs().couleur("Blanc").couleur("Rouge")));
+}
+
+TEST_F(UnCatalogue, FiltrerProduits_ReconditionneEtGarantie_electroniquesRetenus)
+{
+  f_catalogue.ajouterProduit(Electronique("Tablette", 299.99, genererCodeProduit("Tablette", 299.99), 24, true));
+
+  ASSERT_EQ(std::vector<const Produit*>({&f_catalogue.reqProduit(2)}),
+            f_catalogue.filtrerProduits(FiltreAttributs().reconditionne(true).garantieMinimale(24)));
+  ASSERT_EQ(2u, f_catalogue.compterProduits(FiltreAttributs().reconditionne(true)));
+  ASSERT_EQ(0u, f_catalogue.compterProduits(FiltreAttributs().reconditionne(false)));
+}
+
+TEST_F(UnCatalogue, FiltrerProduits_SansCritere_tousLesProduits)
+{
+  ASSERT_EQ(std::vector<const Produit*>({&f_catalogue.reqProduit(0), &f_catalogue.reqProduit(1)}),
+            f_catalogue.filtrerProduits(FiltreAttributs()));
+}
+
+TEST(CatalogueTest, FiltrerProduits_PlusieursBlocsApresSuppressions_memeResultatQuUnParcours)
+{
+  const char* const tailles[] = {"XS", "S", "M", "L", "XL", "XXL"};
+  const char* const couleurs[] = {"Noir", "Blanc", "Rouge"};
+  Catalogue catalogue("Grand", Date(1, 9, 2025));
+  std::vector<std::string> codes;
+  for (int i = 0; i < 2500; ++i)
+    {
+      std::string description;
+      description += static_cast<char>('A' + i % 26);
+      description += static_cast<char>('a' + i / 26 % 26);
+      description += static_cast<char>('a' + i / 676);
+      description += "rticle";
+      double prix = 10 + i;
+      codes.push_back(genererCodeProduit(description, prix));
+      if (i % 3 == 0)
+        {
+          catalogue.ajouterProduit(Electronique(description, prix, codes.back(), i % 37, i % 2 == 0));
+        }
+      else
+        {
+          catalogue.ajouterProduit(Vetement(description, prix, codes.back(), tailles[i % 6], couleurs[i % 7 % 3]));
+        }
+    }
+
+  catalogue.supprimerProduit(codes[5]);
+  catalogue.supprimerProduits({codes[1023], codes[1024], codes[2048]});
+  catalogue.asgModeSuppression(Catalogue::ModeSuppression::PERMUTATION);
+  catalogue.supprimerProduit(codes[0]);
+  catalogue.supprimerProduits({codes[700], codes[1500]});
+  catalogue.asgPrixProduit(codes[2001], 1.5);
+
+  for (const std::string taille : {"S", "M", "XL"})
+    {
+      FiltreAttributs filtre;
+      filtre.taille(taille).couleur("Noir");
+      std::vector<const Produit*> attendus = filtrerParParcours(catalogue, taille, 1000);
+      ASSERT_EQ(attendus, catalogue.filtrerProduits(filtre));
+      ASSERT_EQ(attendus.size(), catalogue.compterProduits(filtre));
+    }
+  FiltreAttributs filtre;
+  filtre.reconditionne(true).garantieMinimale(24);
+  std::vector<const Produit*> attendus = filtrerParParcours(catalogue, "", 24);
+  ASSERT_EQ(attendus, catalogue.filtrerProduits(filtre));
+  ASSERT_EQ(attendus.size(), catalogue.compterProduits(filtre));
+  ASSERT_EQ(2493u, catalogue.compterProduits(FiltreAttributs()));
+}
+
+TEST_F(UnCatalogue, FiltrerProduits_ApresCopieEtViderCache_indexAJour)
+{
+  f_catalogue.reqCatalogueFormate();
+  Catalogue copie(f_catalogue);
+
+  copie.supprimerProduit(genererCodeProduit("Casque Bluetooth", 89.99));
+  f_catalogue.viderCacheFormate();
+
+  ASSERT_EQ(0u, copie.compterProduits(FiltreAttributs().reconditionne(true)));
+  ASSERT_EQ(1u, f_catalogue.compterProduits(FiltreAttributs().reconditionne(true)));
+  ASSERT_EQ(1u, copie.compterProduits(FiltreAttributs().taille("M").couleur("Blanc")));
+}
+
+/**
+ * \brief Test de la méthode void viderCacheFormate()
+ *        Cas valides :
+ *          - ViderCacheFormate_texteInchange
+ */
+TEST_F(UnCatalogue, ViderCacheFormate_texteInchange)
+{
+  std::string avant = f_catalogue.reqCatalogueFormate();
+
+  f_catalogue.viderCacheFormate();
+
+  ASSERT_EQ(avant, f_catalogue.reqCatalogueFormate());
+}
+
 /**
  * \brief Test de la méthode std::string reqCatalogueFormate() const
  *        Cas valides :
@@ -213,6 +972,35 @@ TEST_F(UnCatalogue, ReqCatalogueFormate_EnteteValide)
   ASSERT_TRUE(resultat.find(enteteAttendu) == 0);
 }
 
+/**
+ * \brief Test de la méthode void formater(std::ostream&) const
+ *        Cas valides :
+ *          - Formater_Flux_texteDeReqCatalogueFormate
+ */
+TEST_F(UnCatalogue, Formater_Flux_texteDeReqCatalogueFormate)
+{
+  std::ostringstream os;
+  f_catalogue.formater(os);
+
+  ASSERT_EQ(f_catalogue.reqCatalogueFormate(), os.str());
+  ASSERT_NE(std::string::npos, os.str().find("Produit Electronique\nCasque Bluetooth\n89.99\n"));
+}
+
+/**
+ * \brief Test de la méthode void formater(util::TamponTexte&) const
+ *        Cas valides :
+ *          - Formater_TamponReutilise_texteDeReqCatalogueFormate
+ */
+TEST_F(UnCatalogue, Formater_TamponReutilise_texteDeReqCatalogueFormate)
+{
+  TamponTexte tampon;
+  f_catalogue.formater(tampon);
+  tampon.vider();
+  f_catalogue.formater(tampon);
+
+  ASSERT_EQ(f_catalogue.reqCatalogueFormate(), tampon.reqTexte());
+}
+
 /**
  * \brief Test du constructeur de copie Catalogue(const Catalogue&)
  *        Cas valides :
@@ -239,4 +1027,130 @@ TEST_F(UnCatalogue, ConstructeurCopie_CopieProfonde)
 
   ASSERT_NE(originalAvant, originalApres);
   ASSERT_EQ(copieAvant, copieApres);
-}
\ No newline at end of file
+}
+
+/**
+ * \brief Test de la copie sur écriture
+ *        Cas valides :
+ *          - Copie_ProduitsPartages_memeObjetDansLesDeuxCatalogues
+ *          - Copie_ChangementPrixDansOriginal_copieInchangee
+ *          - Copie_SuppressionsDansLaCopie_originalInchange
+ *          - Copie_OriginalDetruit_copieConserveSesProduits
+ *          - Copie_PlusieursBlocs_modificationsIndependantes
+ */
+TEST_F(UnCatalogue, Copie_ProduitsPartages_memeObjetDansLesDeuxCatalogues)
+{
+  Catalogue copie(f_catalogue);
+
+  ASSERT_EQ(&f_catalogue.reqProduit(0), &copie.reqProduit(0));
+  ASSERT_EQ(&f_catalogue.reqProduit(1), &copie.reqProduit(1));
+}
+
+TEST_F(UnCatalogue, Copie_ChangementPrixDansOriginal_copieInchangee)
+{
+  std::string code = genererCodeProduit("Casque Bluetooth", 89.99);
+  std::string texteAvant = f_catalogue.reqCatalogueFormate();
+  Catalogue copie(f_catalogue);
+
+  f_catalogue.asgPrixProduit(code, 1.50);
+
+  ASSERT_DOUBLE_EQ(89.99, copie.trouverProduit(code).reqPrix());
+  ASSERT_DOUBLE_EQ(1.50, f_catalogue.trouverProduit(genererCodeProduit("Casque Bluetooth", 1.50)).reqPrix());
+  ASSERT_FALSE(copie.contientProduit(genererCodeProduit("Casque Bluetooth", 1.50)));
+  ASSERT_EQ(texteAvant, copie.reqCatalogueFormate());
+  ASSERT_NE(texteAvant, f_catalogue.reqCatalogueFormate());
+}
+
+TEST_F(UnCatalogue, Copie_SuppressionsDansLaCopie_originalInchange)
+{
+  std::string texteAvant = f_catalogue.reqCatalogueFormate();
+  Catalogue copie(f_catalogue);
+
+  copie.supprimerProduit(genererCodeProduit("T-shirt coton", 19.95));
+  copie.supprimerProduit(genererCodeProduit("Casque Bluetooth", 89.99), Catalogue::ModeSuppression::PERMUTATION);
+
+  ASSERT_EQ(0u, copie.reqNombreProduits());
+  ASSERT_EQ(2u, f_catalogue.reqNombreProduits());
+  ASSERT_EQ(texteAvant, f_catalogue.reqCatalogueFormate());
+}
+
+TEST_F(UnCatalogue, Copie_OriginalDetruit_copieConserveSesProduits)
+{
+  auto original = std::make_unique<Catalogue>(f_catalogue);
+  original->ajouterProduit(Vetement("Manteau d'hiver doublé", 199.0, genererCodeProduit("Manteau d'hiver doublé", 199.0), "L", "Noir"));
+  Catalogue copie(*original);
+
+  original.reset();
+  copie.ajouterProduit(Vetement("Tuque", 15.0, genererCodeProduit("Tuque", 15.0), "M", "Gris"));
+
+  ASSERT_EQ(4u, copie.reqNombreProduits());
+  ASSERT_EQ("Manteau d'hiver doublé", copie.trouverProduit(genererCodeProduit("Manteau d'hiver doublé", 199.0)).reqDescription());
+  ASSERT_EQ("Tuque", copie.reqProduit(3).reqDescription());
+}
+
+TEST(CatalogueTest, Copie_PlusieursBlocs_modificationsIndependantes)
+{
+  Catalogue original("Grand", Date(1, 9, 2025));
+  std::vector<std::string> codes;
+  for (int i = 0; i < 2500; ++i)
+    {
+      std::string description;
+      description += static_cast<char>('A' + i % 26);
+      description += static_cast<char>('a' + i / 26 % 26);
+      description += static_cast<char>('a' + i / 676);
+      description += "rticle";
+      double prix = 10 + i;
+      codes.push_back(genererCodeProduit(description, prix));
+      original.ajouterProduit(Vetement(description, prix, codes.back(), "M", "Noir"));
+    }
+  std::string texteOriginal = original.reqCatalogueFormate();
+
+  Catalogue copie(original);
+  copie.supprimerProduit(codes[10]);
+  copie.supprimerProduits({codes[1500], codes[2499]});
+  copie.asgModeSuppression(Catalogue::ModeSuppression::PERMUTATION);
+  copie.supprimerProduit(codes[0]);
+  copie.asgPrixProduit(codes[2000], 1.5);
+
+  ASSERT_EQ(texteOriginal, original.reqCatalogueFormate());
+  ASSERT_EQ(2500u, original.reqNombreProduits());
+  ASSERT_EQ(2496u, copie.reqNombreProduits());
+  ASSERT_EQ(codes[2498], copie.reqProduit(0).reqCode());
+  ASSERT_EQ(codes[11], copie.reqProduit(10).reqCode());
+  ASSERT_EQ(copie.reqPositionProduit(codes[1501]), copie.reqPositionProduit(codes[1499]) + 1);
+  ASSERT_FALSE(copie.contientProduit(codes[2000]));
+  ASSERT_DOUBLE_EQ(2010, original.trouverProduit(codes[2000]).reqPrix());
+  for (size_t i = 0; i < copie.reqNombreProduits(); ++i)
+    {
+      ASSERT_EQ(i, copie.reqPositionProduit(copie.reqProduit(i).reqCode()));
+    }
+}
+
+/**
+ * \brief Test du constructeur et de l'opérateur de déplacement
+ *        Cas valides :
+ *          - ConstructeurDeplacement_ReprendLesProduits
+ *          - OperateurDeplacement_RemplaceLeContenu
+ */
+TEST_F(UnCatalogue, ConstructeurDeplacement_ReprendLesProduits)
+{
+  std::string texteAvant = f_catalogue.reqCatalogueFormate();
+  const Produit* premier = &f_catalogue.reqProduit(0);
+
+  Catalogue deplace(std::move(f_catalogue));
+
+  ASSERT_EQ(texteAvant, deplace.reqCatalogueFormate());
+  ASSERT_EQ(premier, &deplace.reqProduit(0));
+}
+
+TEST_F(UnCatalogue, OperateurDeplacement_RemplaceLeContenu)
+{
+  std::string texteAvant = f_catalogue.reqCatalogueFormate();
+  Catalogue autre("Hiver", Date(1, 12, 2024));
+
+  autre = std::move(f_catalogue);
+
+  ASSERT_EQ(texteAvant, autre.reqCatalogueFormate());
+  ASSERT_EQ("Automne", autre.reqNom());
+  ASSERT_TRUE(autre.contientProduit(genererCodeProduit("Casque Bluetooth", 89.99)));
+}
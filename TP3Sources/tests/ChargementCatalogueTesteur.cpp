@@ -0,0 +1,308 @@
+/**
+ * \file ChargementCatalogueTesteur.cpp
+ * \brief Tests unitaires du chargement d'un catalogue à partir de sa représentation texte
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "ChargementCatalogue.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "ProduitException.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+namespace {
+const std::string CONTENU_VALIDE =
+    "mon catalogue\n"
+    "21 08 2025 \n"
+    "Electronique,Smartphone Galaxy,499.90,PRD-SMAR-60,24,0\n"
+    "Vetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc\n"
+    "\n"
+    "Electronique,Casque Bluetooth,89.99,PRD-CASQ-58,12,1\n";
+
+/**
+ * \brief Construit un contenu de catalogue comptant p_nbProduits vêtements distincts.
+ */
+std::string contenuVolumineux(int p_nbProduits)
+{
+  std::ostringstream os;
+  os << "gros catalogue\n1 9 2025\n";
+  for (int i = 0; i < p_nbProduits; ++i)
+    {
+      std::string description;
+      description += static_cast<char>('A' + i % 26);
+      description += static_cast<char>('a' + i / 26 % 26);
+      description += "emise lin";
+      double prix = 10 + i / 100.0;
+      os << "Vetement," << description << "," << prix << "," << genererCodeProduit(description, prix) << ",S,Bleu\n";
+    }
+  return os.str();
+}
+}
+
+/**
+ * \brief Test de la fonction Catalogue chargerCatalogueDepuisTexte(std::string_view)
+ *        Cas valides :
+ *          - ChargerDepuisTexte_ContenuValide_catalogueComplet
+ *          - ChargerDepuisTexte_FinsDeLigneWindows_catalogueComplet
+ *          - ChargerDepuisTexte_TailleMinuscule_tailleStandardIndexee
+ *        Cas invalides :
+ *          - ChargerDepuisTexte_PrixInvalide_ChargementCatalogueException
+ *          - ChargerDepuisTexte_PrixNonFiniOuNegatif_ChargementCatalogueException
+ *          - ChargerDepuisTexte_CodeInvalide_ChargementCatalogueException
+ *          - ChargerDepuisTexte_DescriptionVide_ChargementCatalogueException
+ *          - ChargerDepuisTexte_TailleNonStandard_ChargementCatalogueException
+ *          - ChargerDepuisTexte_DateInvalide_ChargementCatalogueException
+ *          - ChargerDepuisTexte_CodeEnDouble_ProduitDejaPresentException
+ */
+TEST(ChargementCatalogue, ChargerDepuisTexte_ContenuValide_catalogueComplet)
+{
+  Catalogue catalogue = chargerCatalogueDepuisTexte(CONTENU_VALIDE);
+
+  ASSERT_EQ("mon catalogue", catalogue.reqNom());
+  ASSERT_EQ(Date(21, 8, 2025), catalogue.reqDateDerniereMiseAJour());
+
+  const Electronique& casque = dynamic_cast<const Electronique&>(catalogue.trouverProduit("PRD-CASQ-58"));
+  ASSERT_EQ("Casque Bluetooth", casque.reqDescription());
+  ASSERT_DOUBLE_EQ(89.99, casque.reqPrix());
+  ASSERT_EQ(12, casque.reqGarantieMois());
+  ASSERT_TRUE(casque.reqEstReconditionne());
+
+  const Vetement& tshirt = dynamic_cast<const Vetement&>(catalogue.trouverProduit("PRD-TSHI-70"));
+  ASSERT_EQ("M", tshirt.reqTaille());
+  ASSERT_EQ("Blanc", tshirt.reqCouleur());
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_FinsDeLigneWindows_catalogueComplet)
+{
+  Catalogue catalogue = chargerCatalogueDepuisTexte(
+      "mon catalogue\r\n21 8 2025\r\nVetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc\r\n");
+
+  ASSERT_EQ("mon catalogue", catalogue.reqNom());
+  ASSERT_EQ("Blanc", dynamic_cast<const Vetement&>(catalogue.trouverProduit("PRD-TSHI-70")).reqCouleur());
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_TailleMinuscule_tailleStandardIndexee)
+{
+  Catalogue catalogue = chargerCatalogueDepuisTexte(
+      "mon catalogue\n21 8 2025\nVetement,T-shirt coton,19.95,PRD-TSHI-70,xl,Noir\n");
+
+  ASSERT_EQ("XL", dynamic_cast<const Vetement&>(catalogue.trouverProduit("PRD-TSHI-70")).reqTaille());
+  ASSERT_EQ(1u, catalogue.compterProduits(FiltreAttributs().taille("XL").couleur("Noir")));
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_PrixInvalide_ChargementCatalogueException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,T-shirt coton,abc,PRD-TSHI-70,M,Blanc\n"),
+               ChargementCatalogueException);
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_PrixNonFiniOuNegatif_ChargementCatalogueException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,T-shirt coton,nan,PRD-TSHI-70,M,Blanc\n"),
+               ChargementCatalogueException);
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,T-shirt coton,inf,PRD-TSHI-70,M,Blanc\n"),
+               ChargementCatalogueException);
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,T-shirt coton,-19.95,PRD-TSHI-70,M,Blanc\n"),
+               ChargementCatalogueException);
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_CodeInvalide_ChargementCatalogueException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nElectronique,Tablette,10,garbage,24,0\n"),
+               ChargementCatalogueException);
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,T-shirt coton,19.95,,M,Blanc\n"),
+               ChargementCatalogueException);
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_DescriptionVide_ChargementCatalogueException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,,19.95,PRD-TSHI-70,M,Blanc\n"),
+               ChargementCatalogueException);
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_TailleNonStandard_ChargementCatalogueException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n21 8 2025\nVetement,T-shirt coton,19.95,PRD-TSHI-70,XXXL,Noir\n"),
+               ChargementCatalogueException);
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_DateInvalide_ChargementCatalogueException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte("mon catalogue\n31 2 2025\n"), ChargementCatalogueException);
+}
+
+TEST(ChargementCatalogue, ChargerDepuisTexte_CodeEnDouble_ProduitDejaPresentException)
+{
+  ASSERT_THROW(chargerCatalogueDepuisTexte(CONTENU_VALIDE + "Vetement,T-shirt coton,19.95,PRD-TSHI-70,S,Noir\n"),
+               ProduitDejaPresentException);
+}
+
+/**
+ * \brief Test de la fonction Catalogue chargerCatalogueDepuisFichier(const std::string&)
+ *        Cas valides :
+ *          - ChargerDepuisFichier_FichierValide_memeCatalogueQueTexte
+ *        Cas invalides :
+ *          - ChargerDepuisFichier_FichierInexistant_runtime_error
+ */
+TEST(ChargementCatalogue, ChargerDepuisFichier_FichierValide_memeCatalogueQueTexte)
+{
+  std::string nomFichier = "chargement_catalogue_test.txt";
+  {
+    std::ofstream fichier(nomFichier);
+    fichier << CONTENU_VALIDE;
+  }
+
+  Catalogue catalogue = chargerCatalogueDepuisFichier(nomFichier);
+  std::remove(nomFichier.c_str());
+
+  ASSERT_EQ(chargerCatalogueDepuisTexte(CONTENU_VALIDE).reqCatalogueFormate(), catalogue.reqCatalogueFormate());
+}
+
+TEST(ChargementCatalogue, ChargerDepuisFichier_FichierInexistant_runtime_error)
+{
+  ASSERT_THROW(chargerCatalogueDepuisFichier("fichier_inexistant.txt"), std::runtime_error);
+}
+
+
+/**
+ * \brief Test de la fonction Catalogue chargerCatalogueDepuisTexte(std::string_view, SuiviChargement&)
+ *        Cas valides :
+ *          - ChargerAvecSuivi_ContenuValide_progressionComplete
+ *        Cas invalides :
+ *          - ChargerAvecSuivi_AnnulationDemandee_ChargementAnnuleException
+ */
+TEST(ChargementCatalogue, ChargerAvecSuivi_ContenuValide_progressionComplete)
+{
+  std::string contenu = contenuVolumineux(100);
+  SuiviChargement suivi;
+
+  Catalogue catalogue = chargerCatalogueDepuisTexte(contenu, suivi);
+
+  ASSERT_EQ(chargerCatalogueDepuisTexte(contenu).reqCatalogueFormate(), catalogue.reqCatalogueFormate());
+  ASSERT_EQ(contenu.size(), suivi.octetsTotal.load());
+  ASSERT_EQ(contenu.size(), suivi.octetsLus.load());
+}
+
+TEST(ChargementCatalogue, ChargerAvecSuivi_AnnulationDemandee_ChargementAnnuleException)
+{
+  SuiviChargement suivi;
+  suivi.annulationDemandee = true;
+
+  ASSERT_THROW(chargerCatalogueDepuisTexte(CONTENU_VALIDE, suivi), ChargementAnnuleException);
+}
+
+/**
+ * \brief Test de la fonction Catalogue chargerCatalogueDepuisTexteEnParallele(std::string_view, unsigned int)
+ *        Cas valides :
+ *          - ChargerEnParallele_PlusieursTroncons_identiqueAuSequentiel
+ *        Cas invalides :
+ *          - ChargerEnParallele_ErreurDansUnTroncon_memeErreurQueSequentiel
+ *          - ChargerEnParallele_DoublonEntreTroncons_ProduitDejaPresentException
+ */
+TEST(ChargementCatalogue, ChargerEnParallele_PlusieursTroncons_identiqueAuSequentiel)
+{
+  std::string contenu = contenuVolumineux(100);
+
+  Catalogue sequentiel = chargerCatalogueDepuisTexte(contenu);
+  Catalogue parallele = chargerCatalogueDepuisTexteEnParallele(contenu, 4);
+
+  ASSERT_EQ(sequentiel.reqCatalogueFormate(), parallele.reqCatalogueFormate());
+}
+
+TEST(ChargementCatalogue, ChargerEnParallele_ErreurDansUnTroncon_memeErreurQueSequentiel)
+{
+  std::string contenu = contenuVolumineux(100) + "Vetement,Chemise lin,prix,PRD-CHEM-00,S,Bleu\n";
+  std::string erreurSequentielle;
+  try
+    {
+      chargerCatalogueDepuisTexte(contenu);
+    }
+  catch (ChargementCatalogueException& e)
+    {
+      erreurSequentielle = e.what();
+    }
+
+  try
+    {
+      chargerCatalogueDepuisTexteEnParallele(contenu, 4);
+      FAIL();
+    }
+  catch (ChargementCatalogueException& e)
+    {
+      ASSERT_EQ("Ligne 103 : prix invalide", erreurSequentielle);
+      ASSERT_EQ(erreurSequentielle, e.what());
+    }
+}
+
+TEST(ChargementCatalogue, ChargerEnParallele_DoublonEntreTroncons_ProduitDejaPresentException)
+{
+  std::string contenu = contenuVolumineux(100) + "Vetement,Aaemise lin,10," + genererCodeProduit("Aaemise lin", 10) + ",M,Noir\n";
+
+  ASSERT_THROW(chargerCatalogueDepuisTexteEnParallele(contenu, 4), ProduitDejaPresentException);
+}
+
+/**
+ * \brief Test de la fonction ResultatChargement validerEtChargerCatalogue(std::istream&)
+ *        Cas valides :
+ *          - ValiderEtCharger_ContenuValide_catalogueSansErreur
+ *        Cas invalides :
+ *          - ValiderEtCharger_PlusieursErreurs_toutesLesErreursSignalees
+ *          - ValiderEtCharger_FluxInvalide_erreurFichier
+ */
+TEST(ChargementCatalogue, ValiderEtCharger_ContenuValide_catalogueSansErreur)
+{
+  std::istringstream is(CONTENU_VALIDE.substr(0, CONTENU_VALIDE.find("\n\n") + 1)
+                        + "Vetement, Jean slim , 49.90 ,PRD-JEAN-39,l,Bleu\n");
+
+  ResultatChargement resultat = validerEtChargerCatalogue(is);
+
+  ASSERT_TRUE(resultat.estValide());
+  ASSERT_TRUE(resultat.catalogue.has_value());
+  ASSERT_EQ("mon catalogue", resultat.catalogue->reqNom());
+  ASSERT_EQ("L", dynamic_cast<const Vetement&>(resultat.catalogue->trouverProduit("PRD-JEAN-39")).reqTaille());
+}
+
+TEST(ChargementCatalogue, ValiderEtCharger_PlusieursErreurs_toutesLesErreursSignalees)
+{
+  std::istringstream is("mon catalogue\n"
+                        "21 13 2025\n"
+                        "Vetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc\n"
+                        "Vetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc\n"
+                        "Electronique,Casque Bluetooth,89.99,PRD-CASQ-00,12,2\n"
+                        "Vetement,Jean slim,49.90,PRD-JEAN-39,L\n");
+
+  ResultatChargement resultat = validerEtChargerCatalogue(is);
+
+  ASSERT_FALSE(resultat.estValide());
+  ASSERT_FALSE(resultat.catalogue.has_value());
+  ASSERT_EQ(5u, resultat.erreurs.size());
+  ASSERT_EQ(2u, resultat.erreurs[0].ligne);
+  ASSERT_EQ("date", resultat.erreurs[0].champ);
+  ASSERT_EQ(4u, resultat.erreurs[1].ligne);
+  ASSERT_EQ("code", resultat.erreurs[1].champ);
+  ASSERT_EQ(5u, resultat.erreurs[2].ligne);
+  ASSERT_EQ("code", resultat.erreurs[2].champ);
+  ASSERT_EQ(5u, resultat.erreurs[3].ligne);
+  ASSERT_EQ("reconditionne", resultat.erreurs[3].champ);
+  ASSERT_EQ(6u, resultat.erreurs[4].ligne);
+  ASSERT_EQ("ligne", resultat.erreurs[4].champ);
+}
+
+TEST(ChargementCatalogue, ValiderEtCharger_FluxInvalide_erreurFichier)
+{
+  std::ifstream is("fichier_inexistant.txt");
+
+  ResultatChargement resultat = validerEtChargerCatalogue(is);
+
+  ASSERT_EQ(1u, resultat.erreurs.size());
+  ASSERT_EQ(0u, resultat.erreurs[0].ligne);
+}
@@ -0,0 +1,109 @@
+/**
+ * \file CodeProduitTesteur.cpp
+ * \brief Tests unitaires de la classe CodeProduit
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include "CodeProduit.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace util;
+
+/**
+ * \brief Test de l'analyse et du formatage d'un code produit
+ *        Cas valides :
+ *          - Analyser_CodeValide_texteIdentique
+ *          - Generer_DescriptionEtPrix_identiqueAGenererCodeProduit
+ *          - OperateurSortie_CodeValide_texteDuCode
+ *        Cas invalides :
+ *          - Analyser_FormatInvalide_aucunCode
+ *          - Constructeur_FormatInvalide_PreconditionException
+ *          - Generer_MoinsDeQuatreLettres_codeVide
+ */
+TEST(CodeProduit, Analyser_CodeValide_texteIdentique)
+{
+  optional<CodeProduit> code = CodeProduit::analyser("PRD-SMAR-42");
+
+  ASSERT_TRUE(code.has_value());
+  ASSERT_FALSE(code->estVide());
+  ASSERT_EQ("PRD-SMAR-42", code->reqTexte());
+}
+
+TEST(CodeProduit, Analyser_FormatInvalide_aucunCode)
+{
+  ASSERT_FALSE(CodeProduit::analyser("").has_value());
+  ASSERT_FALSE(CodeProduit::analyser("PRD-SMAR-4").has_value());
+  ASSERT_FALSE(CodeProduit::analyser("PRX-SMAR-42").has_value());
+  ASSERT_FALSE(CodeProduit::analyser("PRD-SmAR-42").has_value());
+  ASSERT_FALSE(CodeProduit::analyser("PRD-SMAR_42").has_value());
+  ASSERT_FALSE(CodeProduit::analyser("PRD-SMAR-4X").has_value());
+}
+
+TEST(CodeProduit, Constructeur_FormatInvalide_PreconditionException)
+{
+  ASSERT_THROW(CodeProduit("PRD-SMAR-4X"), PreconditionException);
+}
+
+TEST(CodeProduit, Generer_DescriptionEtPrix_identiqueAGenererCodeProduit)
+{
+  ASSERT_EQ(genererCodeProduit("Smartphone Galaxy", 499.90), CodeProduit::generer("Smartphone Galaxy", 499.90).reqTexte());
+  ASSERT_EQ(CodeProduit(genererCodeProduit("T-shirt coton", 19.95)), CodeProduit::generer("T-shirt coton", 19.95));
+}
+
+TEST(CodeProduit, Generer_MoinsDeQuatreLettres_codeVide)
+{
+  CodeProduit code = CodeProduit::generer("Zo 42", 1.0);
+
+  ASSERT_TRUE(code.estVide());
+  ASSERT_EQ("", code.reqTexte());
+}
+
+TEST(CodeProduit, OperateurSortie_CodeValide_texteDuCode)
+{
+  ostringstream os;
+  os << CodeProduit("PRD-CASQ-07");
+
+  ASSERT_EQ("PRD-CASQ-07", os.str());
+}
+
+/**
+ * \brief Test des comparaisons et du hachage d'un code produit
+ *        Cas valides :
+ *          - Comparer_DeuxCodes_ordreDesTextes
+ *          - Hacher_CodesDistincts_ensembleSansCollisionDeCle
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(CodeProduit, Comparer_DeuxCodes_ordreDesTextes)
+{
+  const string textes[] = {"PRD-AAAA-00", "PRD-AAAA-99", "PRD-AAAB-00", "PRD-BAAA-05", "PRD-ZZZZ-99"};
+
+  for (const string& a : textes)
+    {
+      for (const string& b : textes)
+        {
+          ASSERT_EQ(a < b, CodeProduit(a) < CodeProduit(b));
+          ASSERT_EQ(a == b, CodeProduit(a) == CodeProduit(b));
+          ASSERT_EQ(a != b, CodeProduit(a) != CodeProduit(b));
+        }
+    }
+  ASSERT_TRUE(CodeProduit() < CodeProduit("PRD-AAAA-00"));
+}
+
+TEST(CodeProduit, Hacher_CodesDistincts_ensembleSansCollisionDeCle)
+{
+  unordered_set<CodeProduit> codes;
+  codes.insert(CodeProduit("PRD-SMAR-42"));
+  codes.insert(CodeProduit("PRD-SMAR-42"));
+  codes.insert(CodeProduit("PRD-SMAR-43"));
+
+  ASSERT_EQ(2u, codes.size());
+  ASSERT_EQ(1u, codes.count(CodeProduit("PRD-SMAR-42")));
+  ASSERT_EQ(0u, codes.count(CodeProduit()));
+}
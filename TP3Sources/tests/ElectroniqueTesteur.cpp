@@ -8,7 +8,9 @@
 
 #include <gtest/gtest.h>
 #include <sstream>
+#include <type_traits>
 #include "Electronique.h"
+#include "ArenaProduits.h"
 #include "validationFormat.h"
 #include "ContratException.h"
 
@@ -125,6 +127,21 @@ TEST_F(UnElectronique, ReqProduitFormate_formatConforme)
   ASSERT_EQ(os.str(), f_electronique.reqProduitFormate());
 }
 
+/**
+ * \brief Test de la méthode void ecrireFormate(std::ostream&) const
+ *        Cas valides :
+ *          - EcrireFormate_appelPolymorphique_texteDeReqProduitFormate
+ */
+TEST_F(UnElectronique, EcrireFormate_appelPolymorphique_texteDeReqProduitFormate)
+{
+  const Produit& produit = f_electronique;
+  std::ostringstream os;
+  os << "avant|";
+  produit.ecrireFormate(os);
+
+  ASSERT_EQ("avant|" + f_electronique.reqProduitFormate(), os.str());
+}
+
 /**
  * \brief Test de la méthode std::unique_ptr<Produit> clone() const
  *        Cas valides :
@@ -145,3 +162,35 @@ TEST_F(UnElectronique, Clone_CopieProfonde)
   ASSERT_NE(f_electronique.reqPrix(), copie->reqPrix());
   ASSERT_NE(f_electronique.reqCode(), copie->reqCode());
 }
+
+/**
+ * \brief Test du constructeur de déplacement
+ *        Cas valides :
+ *          - ConstructeurDeplacement_AttributsRepris
+ */
+TEST_F(UnElectronique, ConstructeurDeplacement_AttributsRepris)
+{
+  static_assert(std::is_nothrow_move_constructible<Electronique>::value, "Electronique doit être déplaçable");
+
+  Electronique deplace(std::move(f_electronique));
+
+  ASSERT_EQ(f_description, deplace.reqDescription());
+  ASSERT_EQ(f_code, deplace.reqCode());
+  ASSERT_EQ(24, deplace.reqGarantieMois());
+}
+
+/**
+ * \brief Test de la méthode std::shared_ptr<Produit> cloneDans(ArenaProduits&) const
+ *        Cas valides :
+ *          - CloneDans_Arena_copieDuMemeTypeDansLArene
+ */
+TEST_F(UnElectronique, CloneDans_Arena_copieDuMemeTypeDansLArene)
+{
+  auto arena = std::make_shared<ArenaProduits>();
+
+  std::shared_ptr<Produit> copie = f_electronique.cloneDans(*arena);
+
+  ASSERT_EQ(1u, arena->reqNombreObjets());
+  ASSERT_EQ(f_electronique.reqCode(), copie->reqCode());
+  ASSERT_EQ(24, dynamic_cast<const Electronique&>(*copie).reqGarantieMois());
+}
@@ -0,0 +1,164 @@
+/**
+ * \file GenerateurCatalogueTesteur.cpp
+ * \brief Tests unitaires de la génération de catalogues synthétiques
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include "GenerateurCatalogue.h"
+#include "ChargementCatalogue.h"
+#include "ContratException.h"
+#include "Electronique.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+/**
+ * \brief Test de la fonction genererCatalogue
+ *        Cas valides :
+ *          - GenererCatalogue_MilleProduits_catalogueChargeable
+ *          - GenererCatalogue_MemeGraine_memeTexte
+ *          - GenererCatalogue_GrainesDifferentes_textesDifferents
+ *        Cas invalides :
+ *          - GenererCatalogue_NomVide_PreconditionException
+ *          - GenererCatalogue_LongueurMinimaleTropCourte_PreconditionException
+ *          - GenererCatalogue_ProportionInvalide_PreconditionException
+ */
+TEST(GenerateurCatalogue, GenererCatalogue_MilleProduits_catalogueChargeable)
+{
+  ParametresGeneration parametres;
+  parametres.nomCatalogue = "essai";
+  parametres.date = Date(21, 8, 2025);
+  parametres.nbProduits = 1000;
+
+  Catalogue catalogue = chargerCatalogueDepuisTexte(genererTexteCatalogue(parametres));
+
+  ASSERT_EQ("essai", catalogue.reqNom());
+  ASSERT_EQ(Date(21, 8, 2025), catalogue.reqDateDerniereMiseAJour());
+  ASSERT_EQ(1000u, catalogue.reqNombreProduits());
+  ASSERT_TRUE(validerEtChargerCatalogueDepuisTexte(genererTexteCatalogue(parametres)).estValide());
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_MemeGraine_memeTexte)
+{
+  ParametresGeneration parametres;
+  parametres.nbProduits = 200;
+
+  ASSERT_EQ(genererTexteCatalogue(parametres), genererTexteCatalogue(parametres));
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_GrainesDifferentes_textesDifferents)
+{
+  ParametresGeneration parametres;
+  parametres.nbProduits = 200;
+  string texte = genererTexteCatalogue(parametres);
+  parametres.graine = 7;
+
+  ASSERT_NE(texte, genererTexteCatalogue(parametres));
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_NomVide_PreconditionException)
+{
+  ParametresGeneration parametres;
+  parametres.nomCatalogue = "";
+
+  ASSERT_THROW(genererTexteCatalogue(parametres), PreconditionException);
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_LongueurMinimaleTropCourte_PreconditionException)
+{
+  ParametresGeneration parametres;
+  parametres.longueurDescriptionMin = 3;
+
+  ASSERT_THROW(genererTexteCatalogue(parametres), PreconditionException);
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_ProportionInvalide_PreconditionException)
+{
+  ParametresGeneration parametres;
+  parametres.proportionElectronique = 1.5;
+
+  ASSERT_THROW(genererTexteCatalogue(parametres), PreconditionException);
+}
+
+/**
+ * \brief Test des paramètres de composition du catalogue généré
+ *        Cas valides :
+ *          - GenererCatalogue_ProportionElectroniqueUn_queDesElectroniques
+ *          - GenererCatalogue_LongueurFixe_descriptionsDeLongueurFixe
+ *          - GenererCatalogue_LongueurNormale_longueursDansLesBornes
+ *          - GenererCatalogue_TauxDoublons_doublonsSignales
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(GenerateurCatalogue, GenererCatalogue_ProportionElectroniqueUn_queDesElectroniques)
+{
+  ParametresGeneration parametres;
+  parametres.nbProduits = 300;
+  parametres.proportionElectronique = 1.0;
+
+  Catalogue catalogue = chargerCatalogueDepuisTexte(genererTexteCatalogue(parametres));
+
+  for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+    {
+      ASSERT_NE(nullptr, dynamic_cast<const Electronique*>(&catalogue.reqProduit(i)));
+    }
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_LongueurFixe_descriptionsDeLongueurFixe)
+{
+  ParametresGeneration parametres;
+  parametres.nbProduits = 300;
+  parametres.longueurDescriptionMin = 24;
+  parametres.longueurDescriptionMax = 60;
+  parametres.distributionLongueur = DistributionLongueur::FIXE;
+
+  Catalogue catalogue = chargerCatalogueDepuisTexte(genererTexteCatalogue(parametres));
+
+  for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+    {
+      // un mot coupé en fin de description peut laisser une espace finale, retirée
+      ASSERT_LE(catalogue.reqProduit(i).reqDescription().size(), 24u);
+      ASSERT_GE(catalogue.reqProduit(i).reqDescription().size(), 23u);
+    }
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_LongueurNormale_longueursDansLesBornes)
+{
+  ParametresGeneration parametres;
+  parametres.nbProduits = 300;
+  parametres.longueurDescriptionMin = 12;
+  parametres.longueurDescriptionMax = 80;
+  parametres.distributionLongueur = DistributionLongueur::NORMALE;
+
+  Catalogue catalogue = chargerCatalogueDepuisTexte(genererTexteCatalogue(parametres));
+
+  size_t total = 0;
+  for (size_t i = 0; i < catalogue.reqNombreProduits(); ++i)
+    {
+      size_t longueur = catalogue.reqProduit(i).reqDescription().size();
+      ASSERT_LE(longueur, 80u);
+      total += longueur;
+    }
+  ASSERT_NEAR(46.0, static_cast<double>(total) / catalogue.reqNombreProduits(), 4.0);
+}
+
+TEST(GenerateurCatalogue, GenererCatalogue_TauxDoublons_doublonsSignales)
+{
+  ParametresGeneration parametres;
+  parametres.nbProduits = 1000;
+  parametres.tauxDoublons = 0.1;
+
+  ResultatChargement resultat = validerEtChargerCatalogueDepuisTexte(genererTexteCatalogue(parametres));
+
+  ASSERT_FALSE(resultat.estValide());
+  ASSERT_GT(resultat.erreurs.size(), 50u);
+  ASSERT_LT(resultat.erreurs.size(), 150u);
+  for (const ErreurFormat& erreur : resultat.erreurs)
+    {
+      ASSERT_EQ("code", erreur.champ);
+    }
+}
@@ -0,0 +1,287 @@
+/**
+ * \file IndexAttributsTesteur.cpp
+ * \brief Tests unitaires des classes FiltreAttributs et IndexAttributs
+ * \author Omar Mahamat
+ * \date 17 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "IndexAttributs.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+/**
+ * \class UnIndexAttributs
+ * \brief Fixture qui indexe quatre vêtements et trois produits électroniques, en alternance.
+ */
+class UnIndexAttributs : public ::testing::Test
+{
+public:
+  UnIndexAttributs()
+  {
+    ajouterVetement("Chemise lin", 39.99, "XL", "Noir");          // rang 0
+    ajouterElectronique("Casque audio", 89.99, 24, true);         // rang 1
+    ajouterVetement("Pantalon toile", 59.99, "M", "Noir");        // rang 2
+    ajouterElectronique("Tablette", 299.99, 12, true);            // rang 3
+    ajouterVetement("Manteau laine", 199.99, "XL", "Beige");      // rang 4
+    ajouterElectronique("Montre connectee", 149.99, 36, false);   // rang 5
+    ajouterVetement("Chandail coton", 49.99, "S", "Blanc");       // rang 6
+  }
+
+  void ajouterVetement(const string& p_description, double p_prix, const string& p_taille, const string& p_couleur)
+  {
+    f_index.ajouter(Vetement(p_description, p_prix, genererCodeProduit(p_description, p_prix), p_taille, p_couleur));
+  }
+
+  void ajouterElectronique(const string& p_description, double p_prix, int p_garantie, bool p_reconditionne)
+  {
+    f_index.ajouter(Electronique(p_description, p_prix, genererCodeProduit(p_description, p_prix), p_garantie,
+                                 p_reconditionne));
+  }
+
+  vector<size_t> rangs(const FiltreAttributs& p_filtre) const
+  {
+    vector<size_t> resultat;
+    f_index.selectionner(p_filtre, resultat);
+    return resultat;
+  }
+
+  IndexAttributs f_index;
+};
+
+/**
+ * \brief Test des méthodes de composition de FiltreAttributs
+ *        Cas valides :
+ *          - Filtre_SansCritere_neConcerneAucunType
+ *          - Filtre_TypeSeul_concerneCeType
+ *          - Filtre_TaillesEtCouleurs_concerneLesVetements
+ *          - Filtre_GarantieNulle_concerneLesElectroniques
+ *        Cas invalides :
+ *          - Taille_NonStandard_PreconditionException
+ *          - Couleur_Vide_PreconditionException
+ *          - GarantieMinimale_Negative_PreconditionException
+ */
+TEST(FiltreAttributs, Filtre_SansCritere_neConcerneAucunType)
+{
+  FiltreAttributs filtre;
+
+  ASSERT_FALSE(filtre.concerneVetements());
+  ASSERT_FALSE(filtre.concerneElectroniques());
+  ASSERT_TRUE(filtre.estVide());
+}
+
+TEST(FiltreAttributs, Filtre_TypeSeul_concerneCeType)
+{
+  ASSERT_TRUE(FiltreAttributs().vetements().concerneVetements());
+  ASSERT_FALSE(FiltreAttributs().vetements().concerneElectroniques());
+  ASSERT_TRUE(FiltreAttributs().electroniques().concerneElectroniques());
+  ASSERT_FALSE(FiltreAttributs().electroniques().estVide());
+}
+
+TEST(FiltreAttributs, Filtre_TaillesEtCouleurs_concerneLesVetements)
+{
+  FiltreAttributs filtre;
+  filtre.taille("XS").taille("XL").couleur("Noir").couleur("Noir");
+
+  ASSERT_TRUE(filtre.concerneVetements());
+  ASSERT_FALSE(filtre.concerneElectroniques());
+  ASSERT_EQ(0b010001, filtre.reqTailles());
+  ASSERT_EQ(vector<string>{"Noir"}, filtre.reqCouleurs());
+}
+
+TEST(FiltreAttributs, Filtre_GarantieNulle_concerneLesElectroniques)
+{
+  FiltreAttributs filtre;
+  filtre.garantieMinimale(0);
+
+  ASSERT_TRUE(filtre.concerneElectroniques());
+  ASSERT_FALSE(filtre.filtreReconditionnement());
+}
+
+TEST(FiltreAttributs, Taille_NonStandard_PreconditionException)
+{
+  ASSERT_THROW(FiltreAttributs().taille("XXXL"), PreconditionException);
+}
+
+TEST(FiltreAttributs, Couleur_Vide_PreconditionException)
+{
+  ASSERT_THROW(FiltreAttributs().couleur(""), PreconditionException);
+}
+
+TEST(FiltreAttributs, GarantieMinimale_Negative_PreconditionException)
+{
+  ASSERT_THROW(FiltreAttributs().garantieMinimale(-1), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes selectionner(const FiltreAttributs&, std::vector<size_t>&) et compter(const FiltreAttributs&)
+ *        Cas valides :
+ *          - Selectionner_TailleEtCouleur_rangsDesVetements
+ *          - Selectionner_PlusieursCouleurs_lUneOuLAutre
+ *          - Selectionner_ReconditionneEtGarantie_rangsDesElectroniques
+ *          - Selectionner_CriteresDesDeuxTypes_aucunRang
+ *          - Selectionner_SansCritere_tousLesRangs
+ *          - Selectionner_TypeSeul_rangsDeCeType
+ *          - AjouterRangs_bitmapDuFiltre_memesRangs
+ *          - Compter_memeNombreQueSelectionner
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnIndexAttributs, Selectionner_TailleEtCouleur_rangsDesVetements)
+{
+  ASSERT_EQ((vector<size_t>{0, 4}), rangs(FiltreAttributs().taille("XL")));
+  ASSERT_EQ((vector<size_t>{0}), rangs(FiltreAttributs().taille("XL").couleur("Noir")));
+  ASSERT_EQ((vector<size_t>{0, 2}), rangs(FiltreAttributs().couleur("Noir")));
+  ASSERT_TRUE(rangs(FiltreAttributs().couleur("Rouge")).empty());
+}
+
+TEST_F(UnIndexAttributs, Selectionner_PlusieursCouleurs_lUneOuLAutre)
+{
+  ASSERT_EQ((vector<size_t>{0, 4, 6}), rangs(FiltreAttributs().couleur("Beige").couleur("Blanc").couleur("Noir")
+                                             .taille("XL").taille("S")));
+}
+
+TEST_F(UnIndexAttributs, Selectionner_ReconditionneEtGarantie_rangsDesElectroniques)
+{
+  ASSERT_EQ((vector<size_t>{1, 3}), rangs(FiltreAttributs().reconditionne(true)));
+  ASSERT_EQ((vector<size_t>{5}), rangs(FiltreAttributs().reconditionne(false)));
+  ASSERT_EQ((vector<size_t>{1, 5}), rangs(FiltreAttributs().garantieMinimale(24)));
+  ASSERT_EQ((vector<size_t>{1}), rangs(FiltreAttributs().reconditionne(true).garantieMinimale(24)));
+  ASSERT_EQ((vector<size_t>{1, 3, 5}), rangs(FiltreAttributs().garantieMinimale(0)));
+  ASSERT_TRUE(rangs(FiltreAttributs().garantieMinimale(37)).empty());
+}
+
+TEST_F(UnIndexAttributs, Selectionner_CriteresDesDeuxTypes_aucunRang)
+{
+  ASSERT_TRUE(rangs(FiltreAttributs().taille("XL").reconditionne(true)).empty());
+}
+
+TEST_F(UnIndexAttributs, Selectionner_SansCritere_tousLesRangs)
+{
+  ASSERT_EQ((vector<size_t>{0, 1, 2, 3, 4, 5, 6}), rangs(FiltreAttributs()));
+}
+
+TEST_F(UnIndexAttributs, Selectionner_TypeSeul_rangsDeCeType)
+{
+  ASSERT_EQ((vector<size_t>{0, 2, 4, 6}), rangs(FiltreAttributs().vetements()));
+  ASSERT_EQ((vector<size_t>{1, 3, 5}), rangs(FiltreAttributs().electroniques()));
+  ASSERT_EQ((vector<size_t>{1, 3}), rangs(FiltreAttributs().electroniques().reconditionne(true)));
+  ASSERT_TRUE(rangs(FiltreAttributs().vetements().electroniques()).empty());
+}
+
+TEST_F(UnIndexAttributs, AjouterRangs_bitmapDuFiltre_memesRangs)
+{
+  IndexAttributs::Bitmap bitmap = f_index.bitmap(FiltreAttributs().taille("XL"));
+  vector<size_t> resultat;
+  IndexAttributs::ajouterRangs(bitmap, resultat);
+
+  ASSERT_EQ((vector<size_t>{0, 4}), resultat);
+  ASSERT_TRUE(IndexAttributs::contient(bitmap, 4));
+  ASSERT_FALSE(IndexAttributs::contient(bitmap, 2));
+}
+
+TEST_F(UnIndexAttributs, Compter_memeNombreQueSelectionner)
+{
+  ASSERT_EQ(7u, f_index.compter(FiltreAttributs()));
+  ASSERT_EQ(2u, f_index.compter(FiltreAttributs().couleur("Noir")));
+  ASSERT_EQ(1u, f_index.compter(FiltreAttributs().reconditionne(false)));
+}
+
+/**
+ * \brief Test des méthodes ajouter(const Produit&), copier(size_t, const IndexAttributs&, size_t),
+ *        retirer(size_t) et tronquer(size_t)
+ *        Cas valides :
+ *          - Retirer_RangDuMilieu_rangsSuivantsDecales
+ *          - Retirer_PlusieursMots_bitsReportes
+ *          - Copier_RangExistant_attributsRemplaces
+ *          - Copier_AutreIndexEnFin_produitAjoute
+ *          - Tronquer_valeursSansRangOubliees
+ *        Cas invalides :
+ *          - Ajouter_IndexPlein_PreconditionException
+ *          - Retirer_RangAbsent_PreconditionException
+ */
+TEST_F(UnIndexAttributs, Retirer_RangDuMilieu_rangsSuivantsDecales)
+{
+  f_index.retirer(2);
+
+  ASSERT_EQ(6u, f_index.reqNombreProduits());
+  ASSERT_EQ((vector<size_t>{0}), rangs(FiltreAttributs().couleur("Noir")));
+  ASSERT_EQ((vector<size_t>{0, 3}), rangs(FiltreAttributs().taille("XL")));
+  ASSERT_EQ((vector<size_t>{1, 2}), rangs(FiltreAttributs().reconditionne(true)));
+  ASSERT_TRUE(rangs(FiltreAttributs().taille("M")).empty());
+}
+
+TEST_F(UnIndexAttributs, Retirer_PlusieursMots_bitsReportes)
+{
+  for (size_t i = 7; i < 200; ++i)
+    {
+      ajouterElectronique("Produit" + to_string(i), 10 + static_cast<double>(i), static_cast<int>(i), false);
+    }
+
+  f_index.retirer(63);
+  f_index.retirer(0);
+
+  vector<size_t> attendus;
+  for (size_t rang = 61; rang < 198; ++rang)
+    {
+      attendus.push_back(rang);
+    }
+  ASSERT_EQ(198u, f_index.reqNombreProduits());
+  ASSERT_EQ(attendus, rangs(FiltreAttributs().garantieMinimale(62)));
+  ASSERT_EQ((vector<size_t>{3, 5}), rangs(FiltreAttributs().taille("XL").taille("S")));
+}
+
+TEST_F(UnIndexAttributs, Copier_RangExistant_attributsRemplaces)
+{
+  f_index.copier(0, f_index, 5);
+
+  ASSERT_EQ(7u, f_index.reqNombreProduits());
+  ASSERT_EQ((vector<size_t>{0, 5}), rangs(FiltreAttributs().reconditionne(false)));
+  ASSERT_EQ((vector<size_t>{4}), rangs(FiltreAttributs().taille("XL")));
+  ASSERT_EQ((vector<size_t>{2}), rangs(FiltreAttributs().couleur("Noir")));
+}
+
+TEST_F(UnIndexAttributs, Copier_AutreIndexEnFin_produitAjoute)
+{
+  IndexAttributs autre;
+
+  autre.copier(0, f_index, 4);
+  autre.copier(1, f_index, 3);
+
+  ASSERT_EQ(2u, autre.reqNombreProduits());
+  ASSERT_EQ(1u, autre.compter(FiltreAttributs().taille("XL").couleur("Beige")));
+  ASSERT_EQ(1u, autre.compter(FiltreAttributs().reconditionne(true).garantieMinimale(12)));
+}
+
+TEST_F(UnIndexAttributs, Tronquer_valeursSansRangOubliees)
+{
+  f_index.tronquer(3);
+
+  ASSERT_EQ(3u, f_index.reqNombreProduits());
+  ASSERT_EQ(3u, f_index.compter(FiltreAttributs()));
+  ASSERT_TRUE(rangs(FiltreAttributs().couleur("Beige")).empty());
+  ASSERT_TRUE(rangs(FiltreAttributs().garantieMinimale(25)).empty());
+}
+
+TEST_F(UnIndexAttributs, Ajouter_IndexPlein_PreconditionException)
+{
+  for (size_t i = f_index.reqNombreProduits(); i < IndexAttributs::CAPACITE; ++i)
+    {
+      f_index.copier(i, f_index, 0);
+    }
+
+  ASSERT_THROW(ajouterVetement("Chemise lin", 39.99, "XL", "Noir"), PreconditionException);
+}
+
+TEST_F(UnIndexAttributs, Retirer_RangAbsent_PreconditionException)
+{
+  ASSERT_THROW(f_index.retirer(7), PreconditionException);
+}
@@ -0,0 +1,192 @@
+/**
+ * \file IndexPrixTesteur.cpp
+ * \brief Tests unitaires de la classe IndexPrix
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "IndexPrix.h"
+#include "Vetement.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+/**
+ * \class UnIndexPrix
+ * \brief Fixture qui indexe des vêtements dont le prix est donné par p_prix.
+ */
+class UnIndexPrix : public ::testing::Test
+{
+public:
+  /**
+   * \brief Crée un vêtement de ce prix et retourne son entrée d'index.
+   */
+  IndexPrix::Entree creerEntree(double p_prix)
+  {
+    string description = "Article ";
+    description += static_cast<char>('A' + f_vetements.size() % 26);
+    description += static_cast<char>('a' + f_vetements.size() / 26 % 26);
+    description += static_cast<char>('a' + f_vetements.size() / 676);
+    f_vetements.push_back(make_unique<Vetement>(description, p_prix, genererCodeProduit(description, p_prix), "M", "Noir"));
+    return {p_prix, f_vetements.back()->reqCodeProduit(), f_vetements.back().get()};
+  }
+
+  /**
+   * \brief Prix des produits, dans l'ordre où ils sont donnés.
+   */
+  static vector<double> prix(const vector<const Produit*>& p_produits)
+  {
+    vector<double> resultat;
+    for (const Produit* produit : p_produits)
+      {
+        resultat.push_back(produit->reqPrix());
+      }
+    return resultat;
+  }
+
+  vector<unique_ptr<Vetement>> f_vetements;
+};
+
+/**
+ * \brief Test du constructeur IndexPrix(std::vector<Entree>) et des requêtes
+ *        Cas valides :
+ *          - Constructeur_EntreesDesordonnees_requetesTriees
+ *          - DansIntervalle_BornesIncluses_produitsDeLIntervalle
+ *          - PlusChers_NombreSuperieurALaTaille_tousLesProduits
+ *          - EstimerDansIntervalle_SansRetrait_nombreExact
+ *          - EstimerDansIntervalle_ApresRetrait_majoreLeNombre
+ *        Cas invalides :
+ *          - DansIntervalle_MinSuperieurAuMax_PreconditionException
+ */
+TEST_F(UnIndexPrix, Constructeur_EntreesDesordonnees_requetesTriees)
+{
+  IndexPrix index({creerEntree(30), creerEntree(10), creerEntree(20)});
+
+  ASSERT_EQ(3u, index.reqNombreProduits());
+  ASSERT_EQ(vector<double>({10, 20}), prix(index.moinsChers(2)));
+  ASSERT_EQ(vector<double>({30, 20}), prix(index.plusChers(2)));
+}
+
+TEST_F(UnIndexPrix, DansIntervalle_BornesIncluses_produitsDeLIntervalle)
+{
+  IndexPrix index({creerEntree(5), creerEntree(10), creerEntree(15), creerEntree(20)});
+  index.ajouter(creerEntree(12));
+
+  ASSERT_EQ(vector<double>({10, 12, 15}), prix(index.dansIntervalle(10, 15)));
+  ASSERT_TRUE(index.dansIntervalle(16, 19).empty());
+}
+
+TEST_F(UnIndexPrix, PlusChers_NombreSuperieurALaTaille_tousLesProduits)
+{
+  IndexPrix index({creerEntree(1), creerEntree(2)});
+
+  ASSERT_EQ(vector<double>({2, 1}), prix(index.plusChers(10)));
+}
+
+TEST_F(UnIndexPrix, EstimerDansIntervalle_SansRetrait_nombreExact)
+{
+  IndexPrix index({creerEntree(5), creerEntree(10), creerEntree(15), creerEntree(20)});
+  index.ajouter(creerEntree(12));
+
+  ASSERT_EQ(3u, index.estimerDansIntervalle(10, 15));
+  ASSERT_EQ(0u, index.estimerDansIntervalle(16, 19));
+}
+
+TEST_F(UnIndexPrix, EstimerDansIntervalle_ApresRetrait_majoreLeNombre)
+{
+  IndexPrix::Entree milieu = creerEntree(20);
+  IndexPrix index({creerEntree(10), milieu, creerEntree(30)});
+
+  index.retirer(milieu.prix, milieu.code);
+
+  ASSERT_LE(index.dansIntervalle(0, 100).size(), index.estimerDansIntervalle(0, 100));
+  ASSERT_GE(3u, index.estimerDansIntervalle(0, 100));
+}
+
+TEST_F(UnIndexPrix, DansIntervalle_MinSuperieurAuMax_PreconditionException)
+{
+  IndexPrix index({creerEntree(1)});
+
+  ASSERT_THROW(index.dansIntervalle(2, 1), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes void ajouter(const Entree&) et void retirer(double, const CodeProduit&)
+ *        Cas valides :
+ *          - Retirer_EntreeTriee_ignoreeParLesRequetes
+ *          - Retirer_EntreeAjoutee_ignoreeParLesRequetes
+ *          - Ajouter_AuDelaDuVecteurDesAjouts_fusionneEtResteTrie
+ *          - RetirerPuisAjouter_MemeProduit_indexeUneSeuleFois
+ *        Cas invalides :
+ *          - Retirer_EntreeAbsente_PreconditionException
+ */
+TEST_F(UnIndexPrix, Retirer_EntreeTriee_ignoreeParLesRequetes)
+{
+  IndexPrix::Entree milieu = creerEntree(20);
+  IndexPrix index({creerEntree(10), milieu, creerEntree(30)});
+
+  index.retirer(milieu.prix, milieu.code);
+
+  ASSERT_EQ(2u, index.reqNombreProduits());
+  ASSERT_EQ(vector<double>({10, 30}), prix(index.moinsChers(3)));
+  ASSERT_EQ(vector<double>({30, 10}), prix(index.plusChers(3)));
+}
+
+TEST_F(UnIndexPrix, Retirer_EntreeAjoutee_ignoreeParLesRequetes)
+{
+  IndexPrix index({creerEntree(10)});
+  IndexPrix::Entree ajout = creerEntree(5);
+  index.ajouter(ajout);
+
+  index.retirer(ajout.prix, ajout.code);
+
+  ASSERT_EQ(vector<double>({10}), prix(index.moinsChers(3)));
+}
+
+TEST_F(UnIndexPrix, Ajouter_AuDelaDuVecteurDesAjouts_fusionneEtResteTrie)
+{
+  IndexPrix index({});
+  vector<IndexPrix::Entree> entrees;
+  for (int i = 0; i < 1000; ++i)
+    {
+      entrees.push_back(creerEntree((i * 37) % 1000 + 1));
+      index.ajouter(entrees.back());
+    }
+  for (int i = 0; i < 1000; i += 2)
+    {
+      index.retirer(entrees[i].prix, entrees[i].code);
+    }
+
+  vector<double> tries = prix(index.moinsChers(1000));
+  ASSERT_EQ(500u, tries.size());
+  ASSERT_EQ(500u, index.reqNombreProduits());
+  ASSERT_TRUE(is_sorted(tries.begin(), tries.end()));
+}
+
+TEST_F(UnIndexPrix, RetirerPuisAjouter_MemeProduit_indexeUneSeuleFois)
+{
+  IndexPrix::Entree entree = creerEntree(20);
+  IndexPrix index({creerEntree(10), entree});
+
+  index.retirer(entree.prix, entree.code);
+  index.ajouter(entree);
+  index.retirer(entree.prix, entree.code);
+
+  ASSERT_EQ(vector<double>({10}), prix(index.dansIntervalle(0, 100)));
+}
+
+TEST_F(UnIndexPrix, Retirer_EntreeAbsente_PreconditionException)
+{
+  IndexPrix index({creerEntree(10)});
+  IndexPrix::Entree absente = creerEntree(20);
+
+  ASSERT_THROW(index.retirer(absente.prix, absente.code), PreconditionException);
+}
@@ -0,0 +1,235 @@
+/**
+ * \file IndexTexteTesteur.cpp
+ * \brief Tests unitaires de la classe IndexTexte
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "IndexTexte.h"
+#include "Vetement.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+/**
+ * \class UnIndexTexte
+ * \brief Fixture qui indexe trois vêtements.
+ */
+class UnIndexTexte : public ::testing::Test
+{
+public:
+  UnIndexTexte() :
+    f_chemise(creerVetement("Chemise en lin")),
+    f_chaussure(creerVetement("Chaussures de course en cuir")),
+    f_ecran(creerVetement("Écran 4K, très lumineux")),
+    f_index({f_chemise, f_chaussure, f_ecran})
+  {
+  }
+
+  /**
+   * \brief Crée un vêtement de cette description, que le fixture conserve.
+   */
+  const Produit* creerVetement(const string& p_description)
+  {
+    double prix = 10.0 + static_cast<double>(f_vetements.size());
+    f_vetements.push_back(make_unique<Vetement>(p_description, prix, genererCodeProduit(p_description, prix), "M", "Noir"));
+    return f_vetements.back().get();
+  }
+
+  /**
+   * \brief Produits donnés, triés par adresse comme ceux que retourne rechercher().
+   */
+  static vector<const Produit*> tries(vector<const Produit*> p_produits)
+  {
+    sort(p_produits.begin(), p_produits.end());
+    return p_produits;
+  }
+
+  vector<unique_ptr<Vetement>> f_vetements;
+  const Produit* f_chemise;
+  const Produit* f_chaussure;
+  const Produit* f_ecran;
+  IndexTexte f_index;
+};
+
+/**
+ * \brief Test de la méthode extraireMots(std::string_view)
+ *        Cas valides :
+ *          - ExtraireMots_AccentsMajusculesEtPonctuation_motsRepliesTriesSansDoublon
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(IndexTexte, ExtraireMots_AccentsMajusculesEtPonctuation_motsRepliesTriesSansDoublon)
+{
+  ASSERT_EQ(vector<string>({"4k", "ecran", "led"}), IndexTexte::extraireMots("Écran LED, écran 4K"));
+  ASSERT_EQ(vector<string>({"coeur", "l", "oeuvre"}), IndexTexte::extraireMots("L’Œuvre « cœur »"));
+  ASSERT_EQ(vector<string>({"cafe", "garcon", "noel"}), IndexTexte::extraireMots("Café-GARÇON Noël"));
+  ASSERT_TRUE(IndexTexte::extraireMots(" ,;- ").empty());
+}
+
+/**
+ * \brief Test de la méthode rechercher(std::string_view, Operateur)
+ *        Cas valides :
+ *          - Rechercher_MotSansAccent_produitAvecAccent
+ *          - Rechercher_Et_produitsAvecTousLesMots
+ *          - Rechercher_Ou_produitsAvecUnDesMots
+ *          - Rechercher_Prefixe_tousLesMotsDuPrefixe
+ *          - Rechercher_RequeteSansMot_aucunProduit
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnIndexTexte, Rechercher_MotSansAccent_produitAvecAccent)
+{
+  ASSERT_EQ(vector<const Produit*>({f_ecran}), f_index.rechercher("ECRAN tres", IndexTexte::Operateur::ET));
+  ASSERT_EQ(vector<const Produit*>({f_ecran}), f_index.rechercher("écran", IndexTexte::Operateur::ET));
+}
+
+TEST_F(UnIndexTexte, Rechercher_Et_produitsAvecTousLesMots)
+{
+  ASSERT_EQ(vector<const Produit*>({f_chaussure}), f_index.rechercher("en cuir", IndexTexte::Operateur::ET));
+  ASSERT_TRUE(f_index.rechercher("lin cuir", IndexTexte::Operateur::ET).empty());
+  ASSERT_TRUE(f_index.rechercher("lin inconnu", IndexTexte::Operateur::ET).empty());
+}
+
+TEST_F(UnIndexTexte, Rechercher_Ou_produitsAvecUnDesMots)
+{
+  ASSERT_EQ(tries({f_chemise, f_chaussure}), f_index.rechercher("lin cuir inconnu", IndexTexte::Operateur::OU));
+}
+
+TEST_F(UnIndexTexte, Rechercher_Prefixe_tousLesMotsDuPrefixe)
+{
+  ASSERT_EQ(tries({f_chemise, f_chaussure}), f_index.rechercher("ch*", IndexTexte::Operateur::ET));
+  ASSERT_EQ(tries({f_chemise, f_chaussure, f_ecran}), f_index.rechercher("c* e*", IndexTexte::Operateur::OU));
+  ASSERT_EQ(vector<const Produit*>({f_chaussure}), f_index.rechercher("ch* cou*", IndexTexte::Operateur::ET));
+  ASSERT_TRUE(f_index.rechercher("chemises*", IndexTexte::Operateur::ET).empty());
+}
+
+TEST_F(UnIndexTexte, Rechercher_RequeteSansMot_aucunProduit)
+{
+  ASSERT_TRUE(f_index.rechercher("", IndexTexte::Operateur::OU).empty());
+  ASSERT_TRUE(f_index.rechercher("* ,", IndexTexte::Operateur::ET).empty());
+}
+
+/**
+ * \brief Test de la méthode rechercherApprox(std::string_view, size_t)
+ *        Cas valides :
+ *          - RechercherApprox_UneFaute_produitTrouve
+ *          - RechercherApprox_DernierMotIncomplet_motsQuiCommencentAinsi
+ *          - RechercherApprox_PlusieursProduits_duPlusProcheAuMoinsProche
+ *          - RechercherApprox_AucunMotProche_aucunProduit
+ *          - RechercherApprox_MotAjouteEtRetire_indexTenuAJour
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnIndexTexte, RechercherApprox_UneFaute_produitTrouve)
+{
+  ASSERT_EQ(vector<const Produit*>({f_chemise}), f_index.rechercherApprox("chemse", 10));
+  ASSERT_EQ(vector<const Produit*>({f_chaussure}), f_index.rechercherApprox("CHAUSURES en cuir", 10));
+  ASSERT_EQ(vector<const Produit*>({f_ecran}), f_index.rechercherApprox("écran lumineus", 10));
+}
+
+TEST_F(UnIndexTexte, RechercherApprox_DernierMotIncomplet_motsQuiCommencentAinsi)
+{
+  ASSERT_EQ(vector<const Produit*>({f_chaussure}), f_index.rechercherApprox("chaussures de cou", 10));
+  ASSERT_EQ(tries({f_chemise, f_chaussure}), tries(f_index.rechercherApprox("ch", 10)));
+}
+
+TEST_F(UnIndexTexte, RechercherApprox_PlusieursProduits_duPlusProcheAuMoinsProche)
+{
+  const Produit* ecrin = creerVetement("Écrin lumineux");
+  f_index.ajouter(*ecrin);
+
+  ASSERT_EQ(vector<const Produit*>({f_ecran, ecrin}), f_index.rechercherApprox("ecran lumineux", 10));
+  ASSERT_EQ(vector<const Produit*>({ecrin}), f_index.rechercherApprox("ecrin lumineux", 1));
+  ASSERT_TRUE(f_index.rechercherApprox("ecran lumineux", 0).empty());
+}
+
+TEST_F(UnIndexTexte, RechercherApprox_AucunMotProche_aucunProduit)
+{
+  ASSERT_TRUE(f_index.rechercherApprox("ordinateur", 10).empty());
+  ASSERT_TRUE(f_index.rechercherApprox("chemise cuir", 10).empty());
+  ASSERT_TRUE(f_index.rechercherApprox(" ,;", 10).empty());
+}
+
+TEST_F(UnIndexTexte, RechercherApprox_MotAjouteEtRetire_indexTenuAJour)
+{
+  const Produit* sandale = creerVetement("Sandale en daim");
+  f_index.ajouter(*sandale);
+  f_index.retirer(*f_chemise);
+
+  ASSERT_EQ(vector<const Produit*>({sandale}), f_index.rechercherApprox("sandalle daim", 10));
+  ASSERT_TRUE(f_index.rechercherApprox("chemse", 10).empty());
+}
+
+/**
+ * \brief Test des méthodes ajouter(const Produit&) et retirer(const Produit&)
+ *        Cas valides :
+ *          - Ajouter_NouveauProduit_trouveParSesMots
+ *          - Retirer_DernierProduitDUnMot_motRetire
+ *          - AjouterRetirer_NombreuxProduits_resultatsExacts
+ *          - Copie_CopieModifiee_originalInchange
+ *        Cas invalides :
+ *          - Retirer_MotNonIndexe_PreconditionException
+ */
+TEST_F(UnIndexTexte, Ajouter_NouveauProduit_trouveParSesMots)
+{
+  const Produit* sandale = creerVetement("Sandale en cuir");
+  f_index.ajouter(*sandale);
+
+  ASSERT_EQ(tries({f_chaussure, sandale}), f_index.rechercher("cuir", IndexTexte::Operateur::ET));
+}
+
+TEST_F(UnIndexTexte, Retirer_DernierProduitDUnMot_motRetire)
+{
+  size_t nbMots = f_index.reqNombreMots();
+
+  f_index.retirer(*f_chemise);
+
+  ASSERT_EQ(nbMots - 2, f_index.reqNombreMots());
+  ASSERT_TRUE(f_index.rechercher("lin", IndexTexte::Operateur::ET).empty());
+  ASSERT_EQ(vector<const Produit*>({f_chaussure}), f_index.rechercher("en", IndexTexte::Operateur::ET));
+}
+
+TEST_F(UnIndexTexte, AjouterRetirer_NombreuxProduits_resultatsExacts)
+{
+  vector<const Produit*> pairs;
+  vector<const Produit*> impairs;
+  for (size_t i = 0; i < 300; ++i)
+    {
+      const Produit* produit = creerVetement(i % 2 == 0 ? "Article pair" : "Article impair");
+      f_index.ajouter(*produit);
+      (i % 2 == 0 ? pairs : impairs).push_back(produit);
+    }
+  for (const Produit* produit : impairs)
+    {
+      f_index.retirer(*produit);
+    }
+
+  ASSERT_EQ(tries(pairs), f_index.rechercher("article", IndexTexte::Operateur::ET));
+  ASSERT_TRUE(f_index.rechercher("impair", IndexTexte::Operateur::ET).empty());
+}
+
+TEST_F(UnIndexTexte, Copie_CopieModifiee_originalInchange)
+{
+  IndexTexte copie(f_index);
+
+  copie.retirer(*f_chemise);
+  copie.ajouter(*creerVetement("Chemise en soie"));
+
+  ASSERT_EQ(vector<const Produit*>({f_chemise}), f_index.rechercher("chemise", IndexTexte::Operateur::ET));
+  ASSERT_TRUE(f_index.rechercher("soie", IndexTexte::Operateur::ET).empty());
+  ASSERT_TRUE(copie.rechercher("lin", IndexTexte::Operateur::ET).empty());
+}
+
+TEST_F(UnIndexTexte, Retirer_MotNonIndexe_PreconditionException)
+{
+  ASSERT_THROW(f_index.retirer(*creerVetement("Chemise en soie")), PreconditionException);
+}
@@ -0,0 +1,171 @@
+/**
+ * \file IndexTrigrammesTesteur.cpp
+ * \brief Tests unitaires de la classe IndexTrigrammes
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "IndexTrigrammes.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace commerce;
+
+/**
+ * \class UnIndexTrigrammes
+ * \brief Fixture qui indexe quelques mots de descriptions.
+ */
+class UnIndexTrigrammes : public ::testing::Test
+{
+public:
+  UnIndexTrigrammes() :
+    f_index({"chemise", "chemisier", "chaussure", "casque", "tablette", "lin"})
+  {
+  }
+
+  /**
+   * \brief Mots proches retournés par motsProches(), triés, avec leur distance.
+   */
+  vector<pair<string, size_t>> proches(string_view p_mot, size_t p_distanceMax, bool p_prefixe) const
+  {
+    vector<pair<string, size_t>> mots;
+    for (const IndexTrigrammes::MotProche& proche : f_index.motsProches(p_mot, p_distanceMax, p_prefixe))
+      {
+        mots.emplace_back(proche.mot, proche.distance);
+      }
+    sort(mots.begin(), mots.end());
+    return mots;
+  }
+
+  IndexTrigrammes f_index;
+};
+
+/**
+ * \brief Test de la méthode distance(std::string_view, std::string_view, size_t, bool)
+ *        Cas valides :
+ *          - Distance_MotsComplets_distanceDeLevenshtein
+ *          - Distance_Prefixe_distanceAuDebutLePlusProche
+ *          - Distance_AuDelaDuMaximum_maximumPlusUn
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(IndexTrigrammes, Distance_MotsComplets_distanceDeLevenshtein)
+{
+  ASSERT_EQ(0u, IndexTrigrammes::distance("chemise", "chemise", 2, false));
+  ASSERT_EQ(1u, IndexTrigrammes::distance("chemse", "chemise", 2, false));
+  ASSERT_EQ(1u, IndexTrigrammes::distance("chemiss", "chemise", 2, false));
+  ASSERT_EQ(2u, IndexTrigrammes::distance("hcemise", "chemise", 2, false));
+  ASSERT_EQ(3u, IndexTrigrammes::distance("kitten", "sitting", 3, false));
+}
+
+TEST(IndexTrigrammes, Distance_Prefixe_distanceAuDebutLePlusProche)
+{
+  ASSERT_EQ(0u, IndexTrigrammes::distance("tabl", "tablette", 1, true));
+  ASSERT_EQ(1u, IndexTrigrammes::distance("tabk", "tablette", 1, true));
+  ASSERT_EQ(2u, IndexTrigrammes::distance("tabl", "tablette", 1, false));
+}
+
+TEST(IndexTrigrammes, Distance_AuDelaDuMaximum_maximumPlusUn)
+{
+  ASSERT_EQ(2u, IndexTrigrammes::distance("chaussure", "casque", 1, false));
+  ASSERT_EQ(2u, IndexTrigrammes::distance("abc", "xyz", 1, true));
+}
+
+/**
+ * \brief Test de la méthode motsProches(std::string_view, size_t, bool)
+ *        Cas valides :
+ *          - MotsProches_UneFaute_motCorrige
+ *          - MotsProches_Prefixe_motsQuiCommencentAinsi
+ *          - MotsProches_MotCourtDistanceElevee_tousLesMotsCompares
+ *          - MotsProches_AucunMotProche_vide
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnIndexTrigrammes, MotsProches_UneFaute_motCorrige)
+{
+  ASSERT_EQ((vector<pair<string, size_t>>{{"chemise", 1}}), proches("chemse", 1, false));
+  ASSERT_EQ((vector<pair<string, size_t>>{{"chemise", 1}, {"chemisier", 1}}), proches("chemiser", 2, false));
+  ASSERT_EQ((vector<pair<string, size_t>>{{"tablette", 1}}), proches("tablete", 1, false));
+}
+
+TEST_F(UnIndexTrigrammes, MotsProches_Prefixe_motsQuiCommencentAinsi)
+{
+  ASSERT_EQ((vector<pair<string, size_t>>{{"chemise", 0}, {"chemisier", 0}}), proches("chemis", 1, true));
+  ASSERT_EQ((vector<pair<string, size_t>>{{"chaussure", 1}}), proches("chaos", 1, true));
+}
+
+TEST_F(UnIndexTrigrammes, MotsProches_MotCourtDistanceElevee_tousLesMotsCompares)
+{
+  ASSERT_EQ((vector<pair<string, size_t>>{{"lin", 1}}), proches("lit", 2, false));
+}
+
+TEST_F(UnIndexTrigrammes, MotsProches_AucunMotProche_vide)
+{
+  ASSERT_TRUE(proches("ordinateur", 2, false).empty());
+}
+
+/**
+ * \brief Test des méthodes ajouter(std::string_view) et retirer(uint32_t)
+ *        Cas valides :
+ *          - Ajouter_NouveauMot_trouveAvecUneFaute
+ *          - Retirer_MotRetire_plusTrouve
+ *          - AjouterRetirer_NombreuxMots_resultatsExacts
+ *        Cas invalides :
+ *          - Ajouter_MotVide_PreconditionException
+ *          - Retirer_NumeroInconnu_PreconditionException
+ */
+TEST_F(UnIndexTrigrammes, Ajouter_NouveauMot_trouveAvecUneFaute)
+{
+  f_index.ajouter("sandale");
+
+  ASSERT_EQ(7u, f_index.reqNombreMots());
+  ASSERT_EQ((vector<pair<string, size_t>>{{"sandale", 1}}), proches("sandalle", 1, false));
+}
+
+TEST_F(UnIndexTrigrammes, Retirer_MotRetire_plusTrouve)
+{
+  f_index.retirer(0);
+
+  ASSERT_EQ(5u, f_index.reqNombreMots());
+  ASSERT_EQ((vector<pair<string, size_t>>{{"chemisier", 0}}), proches("chemis", 1, true));
+}
+
+TEST_F(UnIndexTrigrammes, AjouterRetirer_NombreuxMots_resultatsExacts)
+{
+  vector<uint32_t> numeros;
+  for (size_t i = 0; i < 500; ++i)
+    {
+      numeros.push_back(f_index.ajouter("article" + to_string(i)));
+    }
+  for (size_t i = 0; i < 500; i += 2)
+    {
+      f_index.retirer(numeros[i]);
+    }
+  for (size_t i = 0; i < 100; ++i)
+    {
+      f_index.ajouter("vetement" + to_string(i));
+    }
+
+  ASSERT_EQ(6u + 250 + 100, f_index.reqNombreMots());
+  ASSERT_EQ((vector<pair<string, size_t>>{{"article499", 1}}), proches("artcle499", 1, false));
+  ASSERT_TRUE(proches("article498", 0, false).empty());
+  ASSERT_EQ((vector<pair<string, size_t>>{{"vetement42", 1}}), proches("vetemant42", 1, false));
+}
+
+TEST_F(UnIndexTrigrammes, Ajouter_MotVide_PreconditionException)
+{
+  ASSERT_THROW(f_index.ajouter(""), PreconditionException);
+}
+
+TEST_F(UnIndexTrigrammes, Retirer_NumeroInconnu_PreconditionException)
+{
+  f_index.retirer(1);
+
+  ASSERT_THROW(f_index.retirer(1), PreconditionException);
+  ASSERT_THROW(f_index.retirer(100), PreconditionException);
+}
@@ -107,9 +107,9 @@ public:
 };
 
 /**
- * \brief Test des accesseurs (reqDescription(), reqPrix(), reqCode())
+ * \brief Test des accesseurs (reqDescription(), reqPrix(), reqCode(), reqCodeProduit())
  *        Cas valides :
- *          - reqDescription, reqPrix, reqCode : vérification des valeurs retournées
+ *          - reqDescription, reqPrix, reqCode, reqCodeProduit : vérification des valeurs retournées
  *        Cas invalides : aucun
  */
 TEST_F(UnProduit, ReqDescription_retourValide)
@@ -127,6 +127,11 @@ TEST_F(UnProduit, ReqCode_retourValide)
   ASSERT_EQ(f_code, f_produit.reqCode());
 }
 
+TEST_F(UnProduit, ReqCodeProduit_retourValide)
+{
+  ASSERT_EQ(util::CodeProduit(f_code), f_produit.reqCodeProduit());
+}
+
 /**
  * \brief Test de la méthode void asgPrix(double)
  *        Cas valides :
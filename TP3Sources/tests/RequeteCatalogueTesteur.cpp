@@ -0,0 +1,354 @@
+/**
+ * \file RequeteCatalogueTesteur.cpp
+ * \brief Tests unitaires de la classe RequeteCatalogue et de Catalogue::executerRequete()
+ * \author Omar Mahamat
+ * \date 17 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Catalogue.h"
+#include "RequeteCatalogue.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+#include "Date.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+namespace {
+
+using Tri = RequeteCatalogue::Tri;
+using Plan = RequeteCatalogue::Plan;
+
+/**
+ * \brief Indique si une description contient un mot entier.
+ */
+bool contientMot(const string& p_description, const string& p_mot)
+{
+  istringstream mots(p_description);
+  string mot;
+  while (mots >> mot)
+    {
+      if (mot == p_mot)
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+/**
+ * \brief Résultat attendu d'une requête : chaque produit est examiné, puis les produits
+ *        retenus sont entièrement triés et tronqués.
+ */
+vector<const Produit*> executerParParcours(const Catalogue& p_catalogue, const function<bool(const Produit&)>& p_retenir,
+                                           Tri p_tri, size_t p_limite)
+{
+  vector<const Produit*> produits;
+  for (size_t i = 0; i < p_catalogue.reqNombreProduits(); ++i)
+    {
+      if (p_retenir(p_catalogue.reqProduit(i)))
+        {
+          produits.push_back(&p_catalogue.reqProduit(i));
+        }
+    }
+  auto parPrix = [](const Produit* p_a, const Produit* p_b) {
+    return p_a->reqPrix() < p_b->reqPrix()
+        || (p_a->reqPrix() == p_b->reqPrix() && p_a->reqCodeProduit() < p_b->reqCodeProduit());
+  };
+  switch (p_tri)
+    {
+    case Tri::PRIX_CROISSANT:
+      sort(produits.begin(), produits.end(), parPrix);
+      break;
+    case Tri::PRIX_DECROISSANT:
+      sort(produits.begin(), produits.end(), [&parPrix](const Produit* p_a, const Produit* p_b) { return parPrix(p_b, p_a); });
+      break;
+    case Tri::DESCRIPTION:
+      sort(produits.begin(), produits.end(), [](const Produit* p_a, const Produit* p_b) {
+        return p_a->reqDescription() < p_b->reqDescription()
+            || (p_a->reqDescription() == p_b->reqDescription() && p_a->reqCodeProduit() < p_b->reqCodeProduit());
+      });
+      break;
+    case Tri::AUCUN:
+      sort(produits.begin(), produits.end());
+      break;
+    }
+  if (produits.size() > p_limite)
+    {
+      produits.resize(p_limite);
+    }
+  return produits;
+}
+
+bool estElectronique(const Produit& p_produit)
+{
+  return dynamic_cast<const Electronique*>(&p_produit) != nullptr;
+}
+
+bool estVetementXL(const Produit& p_produit)
+{
+  const Vetement* vetement = dynamic_cast<const Vetement*>(&p_produit);
+  return vetement && vetement->reqTaille() == "XL";
+}
+
+bool prixEntre(const Produit& p_produit, double p_prixMin, double p_prixMax)
+{
+  return p_produit.reqPrix() >= p_prixMin && p_produit.reqPrix() <= p_prixMax;
+}
+
+} // namespace
+
+/**
+ * \class UnGrandCatalogue
+ * \brief Fixture d'un catalogue de trois blocs, dont des produits ont été retirés ou ont changé de prix.
+ *
+ * La description du i-ème produit est « <préfixe unique> <nom> <qualité> <série> », avec
+ * quatre noms, cinq qualités et sept séries en alternance : trois mots choisis parmi ceux-ci
+ * se retrouvent ensemble dans 21 ou 22 produits. Chaque prix est partagé par six produits.
+ */
+class UnGrandCatalogue : public ::testing::Test
+{
+public:
+  UnGrandCatalogue() : f_catalogue("Grand", Date(1, 9, 2025))
+  {
+    const char* const noms[] = {"chemise", "pantalon", "casque", "tablette"};
+    const char* const qualites[] = {"rouge", "bleu", "leger", "solide", "compact"};
+    const char* const series[] = {"lundi", "mardi", "mercredi", "jeudi", "vendredi", "samedi", "dimanche"};
+    const char* const tailles[] = {"XS", "S", "M", "L", "XL", "XXL"};
+    for (int i = 0; i < 3000; ++i)
+      {
+        string description;
+        description += static_cast<char>('a' + i % 26);
+        description += static_cast<char>('a' + i / 26 % 26);
+        description += static_cast<char>('a' + i / 676);
+        description += string("x ") + noms[i % 4] + " " + qualites[i % 5] + " " + series[i % 7];
+        double prix = 10 + i * 37 % 500;
+        f_codes.push_back(genererCodeProduit(description, prix));
+        if (i % 3 == 0)
+          {
+            f_catalogue.ajouterProduit(Electronique(description, prix, f_codes.back(), i % 37, i % 2 == 0));
+          }
+        else
+          {
+            f_catalogue.ajouterProduit(Vetement(description, prix, f_codes.back(), tailles[i % 6], "Noir"));
+          }
+      }
+    f_catalogue.supprimerProduit(f_codes[3]);
+    f_catalogue.supprimerProduits({f_codes[1023], f_codes[2050]});
+    f_catalogue.asgModeSuppression(Catalogue::ModeSuppression::PERMUTATION);
+    f_catalogue.supprimerProduits({f_codes[8], f_codes[1700]});
+    f_catalogue.asgPrixProduit(f_codes[2004], 12.0);
+  }
+
+  Catalogue f_catalogue;
+  vector<string> f_codes;
+};
+
+/**
+ * \brief Test des méthodes de composition de RequeteCatalogue
+ *        Cas valides :
+ *          - Requete_SansCritere_valeursParDefaut
+ *          - Texte_DeuxAppels_motsMisBoutABout
+ *          - PrixEntre_DeuxAppels_intersectionDesIntervalles
+ *        Cas invalides :
+ *          - PrixEntre_MinSuperieurAuMax_PreconditionException
+ */
+TEST(RequeteCatalogue, Requete_SansCritere_valeursParDefaut)
+{
+  RequeteCatalogue requete;
+
+  ASSERT_FALSE(requete.filtreTexte());
+  ASSERT_FALSE(requete.filtrePrix());
+  ASSERT_TRUE(requete.reqAttributs().estVide());
+  ASSERT_EQ(Tri::AUCUN, requete.reqTri());
+  ASSERT_EQ(static_cast<size_t>(-1), requete.reqLimite());
+}
+
+TEST(RequeteCatalogue, Texte_DeuxAppels_motsMisBoutABout)
+{
+  RequeteCatalogue requete;
+  requete.texte("chemise").texte("lin");
+
+  ASSERT_TRUE(requete.filtreTexte());
+  ASSERT_EQ("chemise lin", requete.reqTexte());
+}
+
+TEST(RequeteCatalogue, PrixEntre_DeuxAppels_intersectionDesIntervalles)
+{
+  RequeteCatalogue requete;
+  requete.prixEntre(10, 50).prixEntre(20, 80).trierPar(Tri::DESCRIPTION).limiter(3);
+
+  ASSERT_TRUE(requete.filtrePrix());
+  ASSERT_EQ(20, requete.reqPrixMin());
+  ASSERT_EQ(50, requete.reqPrixMax());
+  ASSERT_EQ(Tri::DESCRIPTION, requete.reqTri());
+  ASSERT_EQ(3u, requete.reqLimite());
+}
+
+TEST(RequeteCatalogue, PrixEntre_MinSuperieurAuMax_PreconditionException)
+{
+  ASSERT_THROW(RequeteCatalogue().prixEntre(2, 1), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes executerRequete(const RequeteCatalogue&) et planifierRequete(const RequeteCatalogue&)
+ *        Cas valides :
+ *          - PlanifierRequete_MotsSelectifs_indexDesMots
+ *          - PlanifierRequete_MotsFrequents_parcoursDesBlocs
+ *          - PlanifierRequete_PrixSelectif_indexDesPrixSeulementSIlExiste
+ *          - ExecuterRequete_IndexDesMots_memeResultatQuUnParcours
+ *          - ExecuterRequete_ParcoursDesBlocs_memeResultatQuUnParcours
+ *          - ExecuterRequete_IndexDesPrix_memeResultatQueLeParcoursDesBlocs
+ *          - ExecuterRequete_SansTriAvecLimite_premiersProduitsRetenus
+ *          - ExecuterRequete_ApresModification_indexAJour
+ *          - ExecuterRequete_CriteresIncompatibles_aucunProduit
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnGrandCatalogue, PlanifierRequete_MotsSelectifs_indexDesMots)
+{
+  ASSERT_EQ(Plan::INDEX_TEXTE, f_catalogue.planifierRequete(RequeteCatalogue().texte("chemise leger lundi")));
+  ASSERT_EQ(Plan::INDEX_TEXTE, f_catalogue.planifierRequete(RequeteCatalogue().texte("introuvable").prixEntre(0, 1000)));
+}
+
+TEST_F(UnGrandCatalogue, PlanifierRequete_MotsFrequents_parcoursDesBlocs)
+{
+  ASSERT_EQ(Plan::PARCOURS_BLOCS, f_catalogue.planifierRequete(RequeteCatalogue().texte("chemise")));
+  ASSERT_EQ(Plan::PARCOURS_BLOCS, f_catalogue.planifierRequete(RequeteCatalogue()));
+}
+
+TEST_F(UnGrandCatalogue, PlanifierRequete_PrixSelectif_indexDesPrixSeulementSIlExiste)
+{
+  RequeteCatalogue requete;
+  requete.prixEntre(10, 14).texte("casque");
+
+  ASSERT_EQ(Plan::PARCOURS_BLOCS, f_catalogue.planifierRequete(requete));
+  f_catalogue.moinsChers(1);
+  ASSERT_EQ(Plan::INDEX_PRIX, f_catalogue.planifierRequete(requete));
+  ASSERT_EQ(Plan::PARCOURS_BLOCS, f_catalogue.planifierRequete(RequeteCatalogue().prixEntre(10, 400)));
+}
+
+TEST_F(UnGrandCatalogue, ExecuterRequete_IndexDesMots_memeResultatQuUnParcours)
+{
+  auto chemiseLegere = [](const Produit& p_produit) {
+    return contientMot(p_produit.reqDescription(), "chemise") && contientMot(p_produit.reqDescription(), "leger")
+        && contientMot(p_produit.reqDescription(), "lundi");
+  };
+
+  for (Tri tri : {Tri::PRIX_CROISSANT, Tri::PRIX_DECROISSANT, Tri::DESCRIPTION})
+    {
+      RequeteCatalogue requete;
+      requete.texte("chemise leger lundi").trierPar(tri);
+      ASSERT_EQ(21u, f_catalogue.executerRequete(requete).size());
+      ASSERT_EQ(executerParParcours(f_catalogue, chemiseLegere, tri, 1000), f_catalogue.executerRequete(requete));
+      requete.limiter(7);
+      ASSERT_EQ(executerParParcours(f_catalogue, chemiseLegere, tri, 7), f_catalogue.executerRequete(requete));
+    }
+
+  RequeteCatalogue requete;
+  requete.texte("chemise leger lundi").prixEntre(50, 400).attributs(FiltreAttributs().vetements()).trierPar(Tri::PRIX_CROISSANT);
+  ASSERT_EQ(Plan::INDEX_TEXTE, f_catalogue.planifierRequete(requete));
+  ASSERT_EQ(executerParParcours(f_catalogue, [&chemiseLegere](const Produit& p_produit) {
+              return chemiseLegere(p_produit) && !estElectronique(p_produit) && prixEntre(p_produit, 50, 400);
+            }, Tri::PRIX_CROISSANT, 1000),
+            f_catalogue.executerRequete(requete));
+}
+
+TEST_F(UnGrandCatalogue, ExecuterRequete_ParcoursDesBlocs_memeResultatQuUnParcours)
+{
+  RequeteCatalogue requete;
+  requete.texte("casque").prixEntre(100, 300).attributs(FiltreAttributs().electroniques()).trierPar(Tri::DESCRIPTION).limiter(15);
+
+  ASSERT_EQ(Plan::PARCOURS_BLOCS, f_catalogue.planifierRequete(requete));
+  ASSERT_EQ(15u, f_catalogue.executerRequete(requete).size());
+  ASSERT_EQ(executerParParcours(f_catalogue, [](const Produit& p_produit) {
+              return contientMot(p_produit.reqDescription(), "casque") && estElectronique(p_produit)
+                  && prixEntre(p_produit, 100, 300);
+            }, Tri::DESCRIPTION, 15),
+            f_catalogue.executerRequete(requete));
+
+  RequeteCatalogue tous;
+  tous.trierPar(Tri::PRIX_DECROISSANT).limiter(20);
+  ASSERT_EQ(executerParParcours(f_catalogue, [](const Produit&) { return true; }, Tri::PRIX_DECROISSANT, 20),
+            f_catalogue.executerRequete(tous));
+}
+
+TEST_F(UnGrandCatalogue, ExecuterRequete_IndexDesPrix_memeResultatQueLeParcoursDesBlocs)
+{
+  auto casqueBonMarche = [](const Produit& p_produit) {
+    return contientMot(p_produit.reqDescription(), "casque") && prixEntre(p_produit, 10, 14);
+  };
+  auto electroniqueBonMarche = [](const Produit& p_produit) {
+    return estElectronique(p_produit) && prixEntre(p_produit, 10, 14);
+  };
+  RequeteCatalogue parMots;
+  parMots.texte("casque").prixEntre(10, 14).trierPar(Tri::PRIX_CROISSANT);
+  RequeteCatalogue parAttributs;
+  parAttributs.prixEntre(10, 14).attributs(FiltreAttributs().electroniques()).trierPar(Tri::PRIX_DECROISSANT).limiter(5);
+  vector<const Produit*> parMotsSansIndex = f_catalogue.executerRequete(parMots);
+  vector<const Produit*> parAttributsSansIndex = f_catalogue.executerRequete(parAttributs);
+
+  ASSERT_FALSE(parMotsSansIndex.empty());
+  ASSERT_EQ(5u, parAttributsSansIndex.size());
+  f_catalogue.produitsDansIntervallePrix(0, 0);
+
+  ASSERT_EQ(Plan::INDEX_PRIX, f_catalogue.planifierRequete(parMots));
+  ASSERT_EQ(Plan::INDEX_PRIX, f_catalogue.planifierRequete(parAttributs));
+  ASSERT_EQ(parMotsSansIndex, f_catalogue.executerRequete(parMots));
+  ASSERT_EQ(parAttributsSansIndex, f_catalogue.executerRequete(parAttributs));
+  ASSERT_EQ(executerParParcours(f_catalogue, casqueBonMarche, Tri::PRIX_CROISSANT, 1000), parMotsSansIndex);
+  ASSERT_EQ(executerParParcours(f_catalogue, electroniqueBonMarche, Tri::PRIX_DECROISSANT, 5), parAttributsSansIndex);
+  parMots.trierPar(Tri::DESCRIPTION).limiter(4);
+  ASSERT_EQ(executerParParcours(f_catalogue, casqueBonMarche, Tri::DESCRIPTION, 4), f_catalogue.executerRequete(parMots));
+}
+
+TEST_F(UnGrandCatalogue, ExecuterRequete_SansTriAvecLimite_premiersProduitsRetenus)
+{
+  vector<const Produit*> produits = f_catalogue.executerRequete(RequeteCatalogue().attributs(FiltreAttributs().taille("XL")).limiter(9));
+
+  ASSERT_EQ(9u, produits.size());
+  for (const Produit* produit : produits)
+    {
+      ASSERT_TRUE(estVetementXL(*produit));
+    }
+  vector<const Produit*> tous = f_catalogue.executerRequete(RequeteCatalogue().texte("tablette"));
+  sort(tous.begin(), tous.end());
+  ASSERT_EQ(executerParParcours(f_catalogue, [](const Produit& p_produit) {
+              return contientMot(p_produit.reqDescription(), "tablette");
+            }, Tri::AUCUN, 1000), tous);
+}
+
+TEST_F(UnGrandCatalogue, ExecuterRequete_ApresModification_indexAJour)
+{
+  RequeteCatalogue requete;
+  requete.prixEntre(10, 12).trierPar(Tri::PRIX_CROISSANT).limiter(1);
+  f_catalogue.moinsChers(1);
+  Catalogue copie(f_catalogue);
+
+  copie.asgPrixProduit(f_codes[2001], 5.0);
+  copie.asgPrixProduit(f_codes[2002], 11.0);
+
+  ASSERT_EQ(Plan::INDEX_PRIX, copie.planifierRequete(requete));
+  ASSERT_EQ(executerParParcours(copie, [](const Produit& p_produit) { return prixEntre(p_produit, 10, 12); },
+                                Tri::PRIX_CROISSANT, 1), copie.executerRequete(requete));
+  ASSERT_EQ(executerParParcours(f_catalogue, [](const Produit& p_produit) { return prixEntre(p_produit, 10, 12); },
+                                Tri::PRIX_CROISSANT, 1), f_catalogue.executerRequete(requete));
+  ASSERT_EQ(11.0, copie.executerRequete(requete.prixEntre(11, 11))[0]->reqPrix());
+}
+
+TEST_F(UnGrandCatalogue, ExecuterRequete_CriteresIncompatibles_aucunProduit)
+{
+  ASSERT_TRUE(f_catalogue.executerRequete(RequeteCatalogue().prixEntre(10, 20).prixEntre(30, 40)).empty());
+  ASSERT_TRUE(f_catalogue.executerRequete(RequeteCatalogue().texte("introuvable")).empty());
+  ASSERT_TRUE(f_catalogue.executerRequete(RequeteCatalogue().attributs(FiltreAttributs().vetements().electroniques())).empty());
+  ASSERT_TRUE(f_catalogue.executerRequete(RequeteCatalogue().limiter(0)).empty());
+}
@@ -0,0 +1,166 @@
+/**
+ * \file SnapshotCatalogueTesteur.cpp
+ * \brief Tests unitaires de la sauvegarde et de la restauration d'un instantané binaire de catalogue
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include "SnapshotCatalogue.h"
+#include "ChargementCatalogue.h"
+#include "Electronique.h"
+#include "Vetement.h"
+#include "ProduitException.h"
+
+using namespace std;
+using namespace commerce;
+using namespace util;
+
+namespace {
+const size_t TAILLE_ENTETE = 56;
+const size_t POSITION_SOMME_CONTROLE = 24;
+
+/**
+ * \brief Remplace le prix du premier produit d'un instantané et recalcule la somme de
+ *        contrôle (FNV-1a par mots de 64 bits), pour que seul le produit soit invalide.
+ */
+void modifierPremierPrix(const std::string& p_nomFichier, double p_prix)
+{
+  std::string contenu;
+  {
+    std::ifstream fichier(p_nomFichier, ios::binary);
+    contenu.assign(std::istreambuf_iterator<char>(fichier), std::istreambuf_iterator<char>());
+  }
+  memcpy(&contenu[TAILLE_ENTETE], &p_prix, sizeof(p_prix));
+
+  uint64_t somme = 14695981039346656037ULL;
+  size_t i = TAILLE_ENTETE;
+  for (; i + sizeof(uint64_t) <= contenu.size(); i += sizeof(uint64_t))
+    {
+      uint64_t mot;
+      memcpy(&mot, contenu.data() + i, sizeof(mot));
+      somme = (somme ^ mot) * 1099511628211ULL;
+    }
+  for (; i < contenu.size(); ++i)
+    {
+      somme = (somme ^ static_cast<unsigned char>(contenu[i])) * 1099511628211ULL;
+    }
+  memcpy(&contenu[POSITION_SOMME_CONTROLE], &somme, sizeof(somme));
+
+  std::ofstream fichier(p_nomFichier, ios::binary | ios::trunc);
+  fichier.write(contenu.data(), contenu.size());
+}
+} // namespace
+
+/**
+ * \class UnSnapshot
+ * \brief Fixture qui sauvegarde un petit catalogue dans un instantané temporaire
+ */
+class UnSnapshot : public ::testing::Test
+{
+public:
+  UnSnapshot() :
+    f_nomFichier("snapshot_catalogue_test.bin"),
+    f_catalogue("Automne", Date(26, 8, 2025))
+  {
+    f_catalogue.ajouterProduit(Vetement("T-shirt coton", 19.95, genererCodeProduit("T-shirt coton", 19.95), "XXL", "Blanc"));
+    f_catalogue.ajouterProduit(Electronique("Casque Bluetooth", 89.99, genererCodeProduit("Casque Bluetooth", 89.99), 12, true));
+    sauvegarderSnapshot(f_catalogue, f_nomFichier);
+  }
+
+  ~UnSnapshot()
+  {
+    std::remove(f_nomFichier.c_str());
+  }
+
+  std::string f_nomFichier;
+  Catalogue f_catalogue;
+};
+
+/**
+ * \brief Test des fonctions sauvegarderSnapshot et chargerSnapshot
+ *        Cas valides :
+ *          - ChargerSnapshot_InstantaneValide_catalogueIdentique
+ *        Cas invalides :
+ *          - ChargerSnapshot_OctetModifie_ChargementCatalogueException
+ *          - ChargerSnapshot_FichierTronque_ChargementCatalogueException
+ *          - ChargerSnapshot_FichierTexte_ChargementCatalogueException
+ *          - ChargerSnapshot_PrixSansRapportAuCode_ChargementCatalogueException
+ *          - ChargerSnapshot_PrixNonFini_ChargementCatalogueException
+ *          - SauvegarderSnapshot_TailleNonStandard_ProduitException (sans contrats
+ *            seulement : en mode débogage, le constructeur du vêtement refuse déjà la taille)
+ */
+TEST_F(UnSnapshot, ChargerSnapshot_InstantaneValide_catalogueIdentique)
+{
+  Catalogue restaure = chargerSnapshot(f_nomFichier);
+
+  ASSERT_EQ(f_catalogue.reqNom(), restaure.reqNom());
+  ASSERT_EQ(f_catalogue.reqDateDerniereMiseAJour(), restaure.reqDateDerniereMiseAJour());
+  ASSERT_EQ(f_catalogue.reqCatalogueFormate(), restaure.reqCatalogueFormate());
+}
+
+TEST_F(UnSnapshot, ChargerSnapshot_OctetModifie_ChargementCatalogueException)
+{
+  {
+    std::fstream fichier(f_nomFichier, ios::in | ios::out | ios::binary);
+    fichier.seekp(-3, ios::end);
+    fichier.put('#');
+  }
+
+  ASSERT_THROW(chargerSnapshot(f_nomFichier), ChargementCatalogueException);
+}
+
+TEST_F(UnSnapshot, ChargerSnapshot_FichierTronque_ChargementCatalogueException)
+{
+  std::string contenu;
+  {
+    std::ifstream fichier(f_nomFichier, ios::binary);
+    contenu.assign(std::istreambuf_iterator<char>(fichier), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream fichier(f_nomFichier, ios::binary | ios::trunc);
+    fichier.write(contenu.data(), contenu.size() - 10);
+  }
+
+  ASSERT_THROW(chargerSnapshot(f_nomFichier), ChargementCatalogueException);
+}
+
+TEST_F(UnSnapshot, ChargerSnapshot_FichierTexte_ChargementCatalogueException)
+{
+  {
+    std::ofstream fichier(f_nomFichier, ios::trunc);
+    fichier << "mon catalogue\n21 8 2025\n"
+               "Vetement,T-shirt coton,19.95,PRD-TSHI-70,M,Blanc\n";
+  }
+
+  ASSERT_THROW(chargerSnapshot(f_nomFichier), ChargementCatalogueException);
+}
+
+TEST_F(UnSnapshot, ChargerSnapshot_PrixSansRapportAuCode_ChargementCatalogueException)
+{
+  modifierPremierPrix(f_nomFichier, 25.0);
+
+  ASSERT_THROW(chargerSnapshot(f_nomFichier), ChargementCatalogueException);
+}
+
+TEST_F(UnSnapshot, ChargerSnapshot_PrixNonFini_ChargementCatalogueException)
+{
+  modifierPremierPrix(f_nomFichier, std::numeric_limits<double>::quiet_NaN());
+
+  ASSERT_THROW(chargerSnapshot(f_nomFichier), ChargementCatalogueException);
+}
+
+#ifdef NDEBUG
+TEST_F(UnSnapshot, SauvegarderSnapshot_TailleNonStandard_ProduitException)
+{
+  f_catalogue.ajouterProduit(Vetement("Chemise lin", 20, genererCodeProduit("Chemise lin", 20), "xl", "Noir"));
+
+  ASSERT_THROW(sauvegarderSnapshot(f_catalogue, f_nomFichier), ProduitException);
+}
+#endif
@@ -0,0 +1,99 @@
+/**
+ * \file TamponTexteTesteur.cpp
+ * \brief Tests unitaires de la classe TamponTexte
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "TamponTexte.h"
+#include "Date.h"
+
+using namespace std;
+using namespace util;
+
+/**
+ * \brief Test des méthodes d'ajout de la classe TamponTexte
+ *        Cas valides :
+ *          - Ajouter_TexteEtCaracteres_concatenes
+ *          - AjouterEntier_EntiersSignes_commeUnFlux
+ *          - AjouterReel_ValeursVariees_commeUnFlux
+ *          - AjouterDate_JourEtMoisAUnChiffre_commeUnFlux
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(TamponTexte, Ajouter_TexteEtCaracteres_concatenes)
+{
+  TamponTexte tampon;
+  tampon.ajouter("Taille : ").ajouter(string("XL")).ajouter('\n');
+
+  ASSERT_EQ("Taille : XL\n", tampon.reqTexte());
+  ASSERT_EQ(12u, tampon.reqTaille());
+}
+
+TEST(TamponTexte, AjouterEntier_EntiersSignes_commeUnFlux)
+{
+  TamponTexte tampon;
+  tampon.ajouterEntier(0).ajouter(' ').ajouterEntier(-42).ajouter(' ').ajouterEntier(1234567890123LL);
+
+  ASSERT_EQ("0 -42 1234567890123", tampon.reqTexte());
+}
+
+TEST(TamponTexte, AjouterReel_ValeursVariees_commeUnFlux)
+{
+  const double valeurs[] = {0.0, 19.95, 89.99, 499.9, 100.0, 0.1 + 0.2, 1e-5, 123456.5, 1234567.0, 2.5e20};
+
+  for (double valeur : valeurs)
+    {
+      ostringstream os;
+      os << valeur;
+      TamponTexte tampon;
+      tampon.ajouterReel(valeur);
+
+      ASSERT_EQ(os.str(), tampon.reqTexte());
+    }
+}
+
+TEST(TamponTexte, AjouterDate_JourEtMoisAUnChiffre_commeUnFlux)
+{
+  const Date dates[] = {Date(1, 2, 2025), Date(21, 8, 2025), Date(31, 12, 1999)};
+
+  for (const Date& date : dates)
+    {
+      ostringstream os;
+      os << date;
+      TamponTexte tampon;
+      tampon.ajouterDate(date);
+
+      ASSERT_EQ(os.str(), tampon.reqTexte());
+    }
+}
+
+/**
+ * \brief Test de la réutilisation d'un TamponTexte
+ *        Cas valides :
+ *          - Vider_TamponRempli_tamponVideReutilisable
+ *          - PrendreTexte_TamponRempli_texteRetireDuTampon
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST(TamponTexte, Vider_TamponRempli_tamponVideReutilisable)
+{
+  TamponTexte tampon(64);
+  tampon.ajouter("premier");
+  tampon.vider();
+  tampon.ajouter("second");
+
+  ASSERT_EQ("second", tampon.reqTexte());
+}
+
+TEST(TamponTexte, PrendreTexte_TamponRempli_texteRetireDuTampon)
+{
+  TamponTexte tampon;
+  tampon.ajouter("catalogue");
+
+  ASSERT_EQ("catalogue", tampon.prendreTexte());
+  ASSERT_EQ(0u, tampon.reqTaille());
+}
@@ -0,0 +1,168 @@
+/**
+ * \file ValidationFormatLotTesteur.cpp
+ * \brief Tests unitaires de la génération et de la validation des codes produits par lot
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \version 1.0
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "validationFormat.h"
+
+using namespace std;
+using namespace util;
+
+namespace {
+
+const NoyauCodesProduits NOYAUX[] = {NoyauCodesProduits::AUTOMATIQUE, NoyauCodesProduits::SCALAIRE,
+                                     NoyauCodesProduits::SSE42, NoyauCodesProduits::AVX2};
+
+} // namespace
+
+/**
+ * \class UnLotDeProduits
+ * \brief Fixture qui prépare des descriptions variées : accents, chiffres, ponctuation,
+ *        moins de quatre lettres et lettres situées au-delà des 16 et 32 premiers octets.
+ */
+class UnLotDeProduits : public ::testing::Test
+{
+public:
+  UnLotDeProduits() :
+    f_textes({"Smartphone Galaxy", "T-shirt coton", "Écran 4K Ultra", "a1b2c3d4", "Zo", "",
+              "123 456 789 012 345 678 abc d", "                                      Pull laine",
+              "@[`{ AZaz", "Manteau d'hiver à capuche", "x", "ÀÉÎÕÜ déjà vu"}),
+    f_prix({499.90, 19.95, 0.005, 12.345, 1.0, 2.5, 99.99, 45.67, 0.01, 159.0, 3.14, 7.77})
+  {
+    f_noms.assign(f_textes.begin(), f_textes.end());
+  }
+
+  vector<string> f_textes;
+  vector<double> f_prix;
+  vector<string_view> f_noms;
+};
+
+/**
+ * \brief Test de la fonction genererCodesProduits
+ *        Cas valides :
+ *          - GenererCodesProduits_TousLesNoyaux_codesIdentiquesAEcrireCodeProduit
+ *          - GenererCodesProduits_PrixVaries_codesIdentiquesAEcrireCodeProduit
+ *        Cas invalides :
+ *          - aucun
+ */
+TEST_F(UnLotDeProduits, GenererCodesProduits_TousLesNoyaux_codesIdentiquesAEcrireCodeProduit)
+{
+  for (NoyauCodesProduits noyau : NOYAUX)
+    {
+      if (!noyauCodesProduitsDisponible(noyau))
+        {
+          continue;
+        }
+      vector<TamponCodeProduit> codes(f_noms.size());
+      vector<size_t> tailles(f_noms.size());
+      genererCodesProduits(f_noms.data(), f_prix.data(), f_noms.size(), codes.data(), tailles.data(), noyau);
+
+      for (size_t i = 0; i < f_noms.size(); ++i)
+        {
+          TamponCodeProduit attendu;
+          size_t tailleAttendue = ecrireCodeProduit(f_noms[i], f_prix[i], attendu);
+          ASSERT_EQ(string(attendu.data(), tailleAttendue), string(codes[i].data(), tailles[i]));
+        }
+    }
+}
+
+TEST(ValidationFormatLot, GenererCodesProduits_PrixVaries_codesIdentiquesAEcrireCodeProduit)
+{
+  vector<double> prix;
+  for (int cents = 0; cents < 2000; ++cents)
+    {
+      prix.push_back(cents * 0.005);
+      prix.push_back(1000 + cents * 0.125);
+    }
+  for (double special : {2.675, 1.005, 0.045, -0.005, -12.34, -99.995, 12345678.905, 1e10 + 0.015, 1e13 + 0.5, 1e15})
+    {
+      prix.push_back(special);
+    }
+  prix.push_back(4.99);
+  vector<string_view> noms(prix.size(), "Casque Bluetooth");
+  for (size_t i = 0; i < noms.size(); i += 3)
+    {
+      noms[i] = i % 2 == 0 ? "Zo" : "zzzz yyyy";
+    }
+
+  for (NoyauCodesProduits noyau : NOYAUX)
+    {
+      if (!noyauCodesProduitsDisponible(noyau))
+        {
+          continue;
+        }
+      vector<TamponCodeProduit> codes(noms.size());
+      vector<size_t> tailles(noms.size());
+      genererCodesProduits(noms.data(), prix.data(), noms.size(), codes.data(), tailles.data(), noyau);
+
+      for (size_t i = 0; i < noms.size(); ++i)
+        {
+          TamponCodeProduit attendu;
+          size_t tailleAttendue = ecrireCodeProduit(noms[i], prix[i], attendu);
+          ASSERT_EQ(string(attendu.data(), tailleAttendue), string(codes[i].data(), tailles[i])) << prix[i];
+        }
+    }
+}
+
+/**
+ * \brief Test de la fonction validerCodesProduits
+ *        Cas valides :
+ *          - ValiderCodesProduits_TousLesNoyaux_resultatsIdentiquesAValiderCodeProduit
+ *        Cas invalides :
+ *          - ValiderCodesProduits_CodesAlteres_codesRefuses
+ */
+TEST_F(UnLotDeProduits, ValiderCodesProduits_TousLesNoyaux_resultatsIdentiquesAValiderCodeProduit)
+{
+  vector<string> textesCodes;
+  for (size_t i = 0; i < f_noms.size(); ++i)
+    {
+      textesCodes.push_back(genererCodeProduit(f_noms[i], f_prix[i]));
+    }
+  vector<string_view> codes(textesCodes.begin(), textesCodes.end());
+
+  for (NoyauCodesProduits noyau : NOYAUX)
+    {
+      if (!noyauCodesProduitsDisponible(noyau))
+        {
+          continue;
+        }
+      bool valides[12];
+      size_t nbValides = validerCodesProduits(codes.data(), f_noms.data(), f_prix.data(), codes.size(), valides, noyau);
+
+      size_t nbAttendus = 0;
+      for (size_t i = 0; i < codes.size(); ++i)
+        {
+          ASSERT_EQ(validerCodeProduit(codes[i], f_noms[i], f_prix[i]), valides[i]);
+          nbAttendus += valides[i] ? 1 : 0;
+        }
+      ASSERT_EQ(nbAttendus, nbValides);
+    }
+}
+
+TEST_F(UnLotDeProduits, ValiderCodesProduits_CodesAlteres_codesRefuses)
+{
+  string_view noms[] = {"Smartphone Galaxy", "Smartphone Galaxy", "Smartphone Galaxy", "Zo"};
+  double prix[] = {499.90, 499.91, 499.90, 1.0};
+  string valide = genererCodeProduit(noms[0], prix[0]);
+  string_view codes[] = {valide, valide, "PRD-SMAX-01", "PRD-ZO-42"};
+
+  for (NoyauCodesProduits noyau : NOYAUX)
+    {
+      if (!noyauCodesProduitsDisponible(noyau))
+        {
+          continue;
+        }
+      bool valides[4];
+      ASSERT_EQ(1u, validerCodesProduits(codes, noms, prix, 4, valides, noyau));
+      ASSERT_TRUE(valides[0]);
+      ASSERT_FALSE(valides[1]);
+      ASSERT_FALSE(valides[2]);
+      ASSERT_FALSE(valides[3]);
+    }
+}
@@ -8,7 +8,9 @@
 
 #include <gtest/gtest.h>
 #include <sstream>
+#include <type_traits>
 #include "Vetement.h"
+#include "ArenaProduits.h"
 #include "validationFormat.h"
 #include "ContratException.h"
 
@@ -127,6 +129,20 @@ TEST_F(UnVetement, ReqProduitFormate_formatConforme)
   ASSERT_EQ(os.str(), f_vetement.reqProduitFormate());
 }
 
+/**
+ * \brief Test de la méthode void ecrireFormate(std::ostream&) const
+ *        Cas valides :
+ *          - EcrireFormate_appelPolymorphique_texteDeReqProduitFormate
+ */
+TEST_F(UnVetement, EcrireFormate_appelPolymorphique_texteDeReqProduitFormate)
+{
+  const Produit& produit = f_vetement;
+  std::ostringstream os;
+  produit.ecrireFormate(os);
+
+  ASSERT_EQ(f_vetement.reqProduitFormate(), os.str());
+}
+
 /**
  * \brief Test de la méthode std::unique_ptr<Produit> clone() const
  *        Cas valides :
@@ -145,4 +161,35 @@ TEST_F(UnVetement, Clone_CopieProfonde)
   ASSERT_DOUBLE_EQ(59.00, f_vetement.reqPrix());
   ASSERT_NE(f_vetement.reqPrix(), copie->reqPrix());
   ASSERT_NE(f_vetement.reqCode(), copie->reqCode());
-}
\ No newline at end of file
+}
+/**
+ * \brief Test du constructeur de déplacement
+ *        Cas valides :
+ *          - ConstructeurDeplacement_AttributsRepris
+ */
+TEST_F(UnVetement, ConstructeurDeplacement_AttributsRepris)
+{
+  static_assert(std::is_nothrow_move_constructible<Vetement>::value, "Vetement doit être déplaçable");
+
+  Vetement deplace(std::move(f_vetement));
+
+  ASSERT_EQ(f_description, deplace.reqDescription());
+  ASSERT_EQ(f_code, deplace.reqCode());
+  ASSERT_EQ(f_couleur, deplace.reqCouleur());
+}
+
+/**
+ * \brief Test de la méthode std::shared_ptr<Produit> cloneDans(ArenaProduits&) const
+ *        Cas valides :
+ *          - CloneDans_Arena_copieDuMemeTypeDansLArene
+ */
+TEST_F(UnVetement, CloneDans_Arena_copieDuMemeTypeDansLArene)
+{
+  auto arena = std::make_shared<ArenaProduits>();
+
+  std::shared_ptr<Produit> copie = f_vetement.cloneDans(*arena);
+
+  ASSERT_EQ(1u, arena->reqNombreObjets());
+  ASSERT_EQ(f_vetement.reqCode(), copie->reqCode());
+  ASSERT_EQ(f_couleur, dynamic_cast<const Vetement&>(*copie).reqCouleur());
+}
@@ -9,47 +9,63 @@
 using namespace std;
 
 namespace util {
-bool validerCodeProduit(const string& p_code, const string& p_nom, double p_prix)
+namespace {
+
+/**
+ * \brief Extrait les quatre premières lettres du nom, en majuscules, et calcule la clé de contrôle.
+ *
+ *        Seules les lettres ASCII sont retenues; la valeur d'une lettre est son rang
+ *        dans l'alphabet (A=1, B=2... Z=26). La clé est la somme de ces valeurs et des
+ *        deux chiffres des cents du prix, modulo 100.
+ *
+ * \return Le nombre de lettres extraites (au plus 4).
+ */
+size_t calculerLettresEtCle(string_view p_nom, double p_prix, char p_lettres[4], int& p_cle)
 {
-    if (p_code.length() != 11 || p_code.substr(0, 4) != "PRD-") {
-        return false;
-    }
-    string code = "PRD-";
-    string name = "";
+    size_t nbLettres = 0;
     int somme = 0;
-
-    // Extraire les 4 premières lettres du nom
-   for (char c : p_nom) {
-        if (isalpha(static_cast<unsigned char>(c))) {
-            name += static_cast<char>(toupper(c));
-            if (name.size() == 4) break;
+    for (char c : p_nom) {
+        char majuscule = (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+        if (majuscule >= 'A' && majuscule <= 'Z') {
+            p_lettres[nbLettres++] = majuscule;
+            somme += majuscule - 64; // 'A' = 65 → 65-64=1
+            if (nbLettres == 4) break;
         }
     }
 
-    // Ajouter les valeurs ASCII (A=1, B=2... Z=26)
-    for (char c : name) {
-        int valeur = static_cast<int>(c) - 64; // 'A' = 65 → 65-64=1
-        somme += valeur;
-    }
-
-    code += name + "-";
-
     // Récupérer les cents
-    int totalCents = static_cast<int>(round(p_prix * 100));
-    int cents = totalCents % 100;
-    int dizaine = cents / 10;
-    int unite  = cents % 10;
-
-    somme += dizaine + unite;
+    long long totalCents = static_cast<long long>(round(p_prix * 100));
+    int cents = static_cast<int>(totalCents % 100);
+    somme += cents / 10 + cents % 10;
 
     // Clé de contrôle = somme % 100
-    int cle = somme % 100;
+    p_cle = somme % 100;
+    return nbLettres;
+}
 
-    if (cle < 10)
-        code += "0";
-    code += to_string(cle);
+} // namespace
 
-    return (code == p_code);
+/**
+ * \brief Vérifie qu'un code produit correspond à un nom et à un prix.
+ *
+ *        Le code est comparé sur place, caractère par caractère, à celui que
+ *        produirait genererCodeProduit(), sans construire de chaîne intermédiaire.
+ */
+bool validerCodeProduit(string_view p_code, string_view p_nom, double p_prix)
+{
+    if (p_code.length() != TAILLE_CODE_PRODUIT || p_code.substr(0, 4) != "PRD-" || p_code[8] != '-') {
+        return false;
+    }
+
+    char lettres[4];
+    int cle = 0;
+    if (calculerLettresEtCle(p_nom, p_prix, lettres, cle) != 4) {
+        return false;
+    }
+
+    return p_code[4] == lettres[0] && p_code[5] == lettres[1] &&
+           p_code[6] == lettres[2] && p_code[7] == lettres[3] &&
+           p_code[9] == '0' + cle / 10 && p_code[10] == '0' + cle % 10;
 }
 
 
@@ -179,55 +195,46 @@ bool validerFormatFichier(std::istream& p_is)
 
     return valide;
 }
-string genererCodeProduit(const string& p_nom, double p_prix)
+/**
+ * \brief Écrit le code produit d'un nom et d'un prix dans un tampon de taille fixe.
+ *
+ *        Forme du code : PRD-XXXX-NN, où XXXX sont les quatre premières lettres du nom
+ *        et NN la clé de contrôle. Si le nom compte moins de quatre lettres, le code est
+ *        plus court (et donc invalide).
+ *
+ * \return Le nombre de caractères écrits dans p_code.
+ */
+size_t ecrireCodeProduit(string_view p_nom, double p_prix, TamponCodeProduit& p_code)
 {
-    string code = "PRD-";
-    string name;
-    int somme = 0;
+    char lettres[4];
+    int cle = 0;
+    size_t nbLettres = calculerLettresEtCle(p_nom, p_prix, lettres, cle);
 
-    // Extraire les 4 premières lettres alphabétiques du nom, en majuscules
-    for (char c : p_nom)
-    {
-        if (isalpha(static_cast<unsigned char>(c)))
-        {
-            name += static_cast<char>(toupper(static_cast<unsigned char>(c)));
-            if (name.size() == 4)
-            {
-                break;
-            }
-        }
+    size_t taille = 0;
+    for (char c : {'P', 'R', 'D', '-'}) {
+        p_code[taille++] = c;
     }
-
- 
-    for (char c : name)
-    {
-        int valeur = static_cast<int>(c) - 64; // 'A'=65 → 1, etc.
-        somme += valeur;
+    for (size_t i = 0; i < nbLettres; ++i) {
+        p_code[taille++] = lettres[i];
     }
-
-    code += name + "-";
-
-  
-    int totalCents = static_cast<int>(std::round(p_prix * 100));
-    int cents = totalCents % 100;
-    int dizaine = cents / 10;
-    int unite  = cents % 10;
-
-    somme += dizaine + unite;
-
-
-    int cle = somme % 100;
-
-    if (cle < 10)
-    {
-        code += "0";
-    }
-    code += to_string(cle);
-
-    return code;
+    p_code[taille++] = '-';
+    p_code[taille++] = static_cast<char>('0' + cle / 10);
+    p_code[taille++] = static_cast<char>('0' + cle % 10);
+    return taille;
 }
 
-
+/**
+ * \brief Génère le code produit d'un nom et d'un prix.
+ *
+ *        Le code tient dans l'optimisation des petites chaînes de std::string :
+ *        la chaîne retournée ne fait pas d'allocation.
+ */
+string genererCodeProduit(string_view p_nom, double p_prix)
+{
+    TamponCodeProduit code;
+    size_t taille = ecrireCodeProduit(p_nom, p_prix, code);
+    return string(code.data(), taille);
 }
 
 
+}
@@ -1,17 +1,44 @@
 
-
 #ifndef VALIDATIONFORMAT_H
 #define VALIDATIONFORMAT_H
 
+#include <array>
+#include <cstddef>
 #include <istream>
 #include <string>
+#include <string_view>
 namespace util {
-bool validerCodeProduit(const std::string& p_code, const std::string& p_nom, double p_prix); 
+
+/** \brief Nombre de caractères d’un code produit valide (PRD-XXXX-NN). */
+const std::size_t TAILLE_CODE_PRODUIT = 11;
+
+/** \brief Tampon pouvant contenir un code produit complet, sans allocation. */
+typedef std::array<char, TAILLE_CODE_PRODUIT> TamponCodeProduit;
+
+bool validerCodeProduit(std::string_view p_code, std::string_view p_nom, double p_prix); 
 
 bool validerFormatFichier(std::istream& p_is);
 
 
-std::string genererCodeProduit(const std::string& p_nom, double p_prix);
+std::string genererCodeProduit(std::string_view p_nom, double p_prix);
+std::size_t ecrireCodeProduit(std::string_view p_nom, double p_prix, TamponCodeProduit& p_code);
+
+/**
+ * \brief Noyau de calcul utilisé par les traitements par lot des codes produits.
+ *
+ * AUTOMATIQUE choisit, à l’exécution, le meilleur noyau pris en charge par le processeur.
+ */
+enum class NoyauCodesProduits { AUTOMATIQUE, SCALAIRE, SSE42, AVX2 };
+
+bool noyauCodesProduitsDisponible(NoyauCodesProduits p_noyau);
+NoyauCodesProduits reqNoyauCodesProduitsAutomatique();
+
+void genererCodesProduits(const std::string_view* p_noms, const double* p_prix, std::size_t p_nb,
+                          TamponCodeProduit* p_codes, std::size_t* p_tailles,
+                          NoyauCodesProduits p_noyau = NoyauCodesProduits::AUTOMATIQUE);
+std::size_t validerCodesProduits(const std::string_view* p_codes, const std::string_view* p_noms,
+                                 const double* p_prix, std::size_t p_nb, bool* p_valides,
+                                 NoyauCodesProduits p_noyau = NoyauCodesProduits::AUTOMATIQUE);
 
 }
 #endif /* VALIDATIONFORMAT_H */
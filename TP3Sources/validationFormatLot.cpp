@@ -0,0 +1,383 @@
+/**
+ * \file validationFormatLot.cpp
+ * \author Omar Mahamat
+ * \date 16 octobre 2026
+ * \brief Génération et validation des codes produits par lot.
+ *
+ * Le travail se fait en deux passes sur le lot :
+ *  - les quatre premières lettres de chaque description sont d’abord extraites, par blocs
+ *    de 16 octets pour le noyau SSE4.2 ;
+ *  - la clé de chaque code (somme des lettres et des chiffres des cents, modulo 100) est
+ *    ensuite calculée ; le noyau AVX2 la calcule pour quatre produits à la fois.
+ * Le noyau est choisi à l’exécution selon le processeur.
+ * Un noyau scalaire sert de repli sur les autres plateformes. Les résultats sont
+ * identiques à ceux de ecrireCodeProduit() et de validerCodeProduit().
+ */
+
+#include "validationFormat.h"
+#include "ContratException.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CODES_PRODUITS_X86
+#endif
+
+using namespace std;
+
+namespace util {
+
+namespace {
+
+/**
+ * \brief Lettres retenues pour le code d’un produit du lot.
+ */
+struct LettresCode
+{
+    char lettres[4];
+    uint32_t nbLettres;
+};
+
+// Le noyau AVX2 lit les lettres de quatre produits en un seul vecteur de 32 octets.
+static_assert(sizeof(LettresCode) == 8, "format des lettres inattendu");
+
+typedef void (*NoyauExtraction)(const string_view* p_noms, size_t p_nb, LettresCode* p_lettres);
+typedef void (*NoyauCles)(const double* p_prix, const LettresCode* p_lettres, size_t p_nb, int* p_cles);
+
+/**
+ * \brief Extrait au plus quatre lettres ASCII de chaque nom, en majuscules; les lettres
+ *        manquantes valent zéro.
+ */
+void extraireLettresScalaire(const string_view* p_noms, size_t p_nb, LettresCode* p_lettres)
+{
+    for (size_t i = 0; i < p_nb; ++i) {
+        LettresCode& resultat = p_lettres[i];
+        resultat = LettresCode();
+        for (char c : p_noms[i]) {
+            char majuscule = (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+            if (majuscule >= 'A' && majuscule <= 'Z') {
+                resultat.lettres[resultat.nbLettres++] = majuscule;
+                if (resultat.nbLettres == 4) break;
+            }
+        }
+    }
+}
+
+/**
+ * \brief Calcule la clé de chaque code : somme des rangs des lettres et des deux chiffres
+ *        des cents du prix, modulo 100.
+ */
+void calculerClesScalaire(const double* p_prix, const LettresCode* p_lettres, size_t p_nb, int* p_cles)
+{
+    for (size_t i = 0; i < p_nb; ++i) {
+        long long totalCents = static_cast<long long>(round(p_prix[i] * 100));
+        int cents = static_cast<int>(totalCents % 100);
+        int somme = cents / 10 + cents % 10;
+        for (size_t j = 0; j < p_lettres[i].nbLettres; ++j) {
+            somme += p_lettres[i].lettres[j] - 64;
+        }
+        p_cles[i] = somme % 100;
+    }
+}
+
+#ifdef CODES_PRODUITS_X86
+
+/**
+ * \brief Recopie, en majuscules, les lettres désignées par un masque de positions.
+ */
+inline void recopierLettres(const char* p_bloc, unsigned int p_masque, LettresCode& p_resultat)
+{
+    while (p_masque != 0 && p_resultat.nbLettres < 4) {
+        unsigned int position = static_cast<unsigned int>(__builtin_ctz(p_masque));
+        p_resultat.lettres[p_resultat.nbLettres++] = static_cast<char>(p_bloc[position] & ~0x20);
+        p_masque &= p_masque - 1;
+    }
+}
+
+/**
+ * \brief Recopie p_nb octets (moins de 32) par deux copies de taille fixe qui se chevauchent,
+ *        que le compilateur traduit en simples chargements, sans appel à memcpy.
+ */
+inline void recopierCourt(char* p_destination, const char* p_source, size_t p_nb)
+{
+    if (p_nb >= 16) {
+        memcpy(p_destination, p_source, 16);
+        memcpy(p_destination + p_nb - 16, p_source + p_nb - 16, 16);
+    }
+    else if (p_nb >= 8) {
+        memcpy(p_destination, p_source, 8);
+        memcpy(p_destination + p_nb - 8, p_source + p_nb - 8, 8);
+    }
+    else if (p_nb >= 4) {
+        memcpy(p_destination, p_source, 4);
+        memcpy(p_destination + p_nb - 4, p_source + p_nb - 4, 4);
+    }
+    else {
+        for (size_t i = 0; i < p_nb; ++i) {
+            p_destination[i] = p_source[i];
+        }
+    }
+}
+
+/**
+ * \brief Retourne l’adresse d’un bloc de p_taille octets (au plus 32) lisible à partir de p_debut.
+ *
+ *        Un bloc entier est lu en place. La fin d’un nom plus courte que le bloc est
+ *        recopiée dans p_copie, complétée par des zéros : lire au-delà de la fin du nom
+ *        serait un comportement indéfini, même sans franchir de frontière de page.
+ */
+inline const char* blocLisible(const char* p_debut, size_t p_disponible, size_t p_taille, char* p_copie)
+{
+    if (p_disponible >= p_taille) {
+        return p_debut;
+    }
+    memset(p_copie, 0, p_taille);
+    recopierCourt(p_copie, p_debut, p_disponible);
+    return p_copie;
+}
+
+/**
+ * \brief Extraction par blocs de 16 octets avec PCMPESTRM en mode intervalles (A-Z, a-z).
+ */
+__attribute__((target("sse4.2")))
+void extraireLettresSse42(const string_view* p_noms, size_t p_nb, LettresCode* p_lettres)
+{
+    const __m128i intervalles = _mm_setr_epi8('A', 'Z', 'a', 'z', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    for (size_t i = 0; i < p_nb; ++i) {
+        string_view nom = p_noms[i];
+        LettresCode& resultat = p_lettres[i];
+        resultat = LettresCode();
+        for (size_t debut = 0; debut < nom.size() && resultat.nbLettres < 4; debut += 16) {
+            char copie[16];
+            size_t disponible = nom.size() - debut;
+            const char* bloc = blocLisible(nom.data() + debut, disponible, 16, copie);
+            __m128i octets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bloc));
+            __m128i masque = _mm_cmpestrm(intervalles, 4, octets, static_cast<int>(min<size_t>(16, disponible)),
+                                          _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_BIT_MASK);
+            recopierLettres(bloc, static_cast<unsigned int>(_mm_cvtsi128_si32(masque)), resultat);
+        }
+    }
+}
+
+/**
+ * \brief Calcul des clés de quatre produits à la fois.
+ *
+ *        Les cents sont calculés en double, exactement tant que |prix * 100| < 2^40 :
+ *        round() est reproduit par une troncature corrigée d’une unité, et les divisions
+ *        entières par une division tronquée. Les lettres de quatre produits, lues en un
+ *        seul vecteur, sont additionnées par VPMADDUBSW, dont les poids retranchent 64 par
+ *        lettre. Un groupe qui contient un prix hors de cet intervalle, ou qui n’est pas un
+ *        nombre, est confié au noyau scalaire, comme la fin du lot.
+ */
+__attribute__((target("avx2")))
+void calculerClesAvx2(const double* p_prix, const LettresCode* p_lettres, size_t p_nb, int* p_cles)
+{
+    const __m256d signe = _mm256_set1_pd(-0.0);
+    const __m256d limite = _mm256_set1_pd(1099511627776.0);
+    const __m256d demi = _mm256_set1_pd(0.5);
+    const __m256d un = _mm256_set1_pd(1);
+    const __m256d dix = _mm256_set1_pd(10);
+    const __m256d neuf = _mm256_set1_pd(9);
+    const __m256d cent = _mm256_set1_pd(100);
+    // Poids des octets d’un LettresCode : 1 pour chaque lettre, -64 pour nbLettres.
+    const __m256i poids = _mm256_set1_epi64x(0x000000C001010101LL);
+    const __m256i uns = _mm256_set1_epi16(1);
+    const __m256i paires = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m128i quatreVingtDixNeuf = _mm_set1_epi32(99);
+    const __m128i cent32 = _mm_set1_epi32(100);
+    const int TRONCATURE = _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC;
+
+    size_t i = 0;
+    for (; i + 4 <= p_nb; i += 4) {
+        __m256d cents = _mm256_mul_pd(_mm256_loadu_pd(p_prix + i), cent);
+        if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(signe, cents), limite, _CMP_LT_OQ)) != 0xF) {
+            calculerClesScalaire(p_prix + i, p_lettres + i, 4, p_cles + i);
+            continue;
+        }
+        __m256d tronque = _mm256_round_pd(cents, TRONCATURE);
+        __m256d ecart = _mm256_andnot_pd(signe, _mm256_sub_pd(cents, tronque));
+        __m256d unitee = _mm256_or_pd(un, _mm256_and_pd(signe, cents));
+        __m256d totalCents = _mm256_add_pd(tronque, _mm256_and_pd(_mm256_cmp_pd(ecart, demi, _CMP_GE_OQ), unitee));
+        __m256d centimes = _mm256_sub_pd(totalCents,
+                                         _mm256_mul_pd(cent, _mm256_round_pd(_mm256_div_pd(totalCents, cent), TRONCATURE)));
+        // dizaines + unités = centimes - 9 * dizaines
+        __m256d dizaines = _mm256_round_pd(_mm256_div_pd(centimes, dix), TRONCATURE);
+        __m128i sommesCents = _mm256_cvttpd_epi32(_mm256_sub_pd(centimes, _mm256_mul_pd(neuf, dizaines)));
+
+        __m256i lettres = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_lettres + i));
+        __m256i sommes = _mm256_madd_epi16(_mm256_maddubs_epi16(lettres, poids), uns);
+        sommes = _mm256_add_epi32(sommes, _mm256_srli_epi64(sommes, 32));
+        __m128i sommesLettres = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(sommes, paires));
+
+        __m128i cles = _mm_add_epi32(sommesLettres, sommesCents);
+        cles = _mm_sub_epi32(cles, _mm_and_si128(_mm_cmpgt_epi32(cles, quatreVingtDixNeuf), cent32));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_cles + i), cles);
+    }
+    calculerClesScalaire(p_prix + i, p_lettres + i, p_nb - i, p_cles + i);
+}
+
+#endif
+
+/**
+ * \brief Noyaux retenus pour un traitement par lot.
+ */
+struct Noyaux
+{
+    NoyauExtraction extraire;
+    NoyauCles calculerCles;
+};
+
+NoyauCodesProduits noyauEffectif(NoyauCodesProduits p_noyau)
+{
+    return p_noyau == NoyauCodesProduits::AUTOMATIQUE ? reqNoyauCodesProduitsAutomatique() : p_noyau;
+}
+
+Noyaux choisirNoyaux(NoyauCodesProduits p_noyau)
+{
+    PRECONDITION(noyauCodesProduitsDisponible(p_noyau));
+    switch (noyauEffectif(p_noyau)) {
+#ifdef CODES_PRODUITS_X86
+    case NoyauCodesProduits::AVX2:
+        // Le noyau scalaire s’arrête à la quatrième lettre : aucune extraction vectorielle
+        // mesurée ne le bat, seul le calcul des clés gagne à traiter quatre produits à la fois.
+        return {extraireLettresScalaire, calculerClesAvx2};
+    case NoyauCodesProduits::SSE42:
+        return {extraireLettresSse42, calculerClesScalaire};
+#endif
+    default:
+        return {extraireLettresScalaire, calculerClesScalaire};
+    }
+}
+
+/**
+ * \brief Extrait les lettres et calcule la clé de chaque produit d’un lot.
+ */
+void preparerLot(const string_view* p_noms, const double* p_prix, size_t p_nb, NoyauCodesProduits p_noyau,
+                 vector<LettresCode>& p_lettres, vector<int>& p_cles)
+{
+    Noyaux noyaux = choisirNoyaux(p_noyau);
+    p_lettres.resize(p_nb);
+    p_cles.resize(p_nb);
+    noyaux.extraire(p_noms, p_nb, p_lettres.data());
+    noyaux.calculerCles(p_prix, p_lettres.data(), p_nb, p_cles.data());
+}
+
+} // namespace
+
+/**
+ * \brief Indique si un noyau peut être utilisé sur le processeur courant.
+ * \param[in] p_noyau noyau à vérifier
+ * \return true si le noyau est pris en charge (AUTOMATIQUE et SCALAIRE le sont toujours).
+ */
+bool noyauCodesProduitsDisponible(NoyauCodesProduits p_noyau)
+{
+    switch (p_noyau) {
+#ifdef CODES_PRODUITS_X86
+    case NoyauCodesProduits::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case NoyauCodesProduits::SSE42:
+        return __builtin_cpu_supports("sse4.2");
+#else
+    case NoyauCodesProduits::AVX2:
+    case NoyauCodesProduits::SSE42:
+        return false;
+#endif
+    default:
+        return true;
+    }
+}
+
+/**
+ * \brief Retourne le noyau retenu lorsque AUTOMATIQUE est demandé.
+ * \return AVX2 si disponible, sinon SSE42 si disponible, sinon SCALAIRE.
+ */
+NoyauCodesProduits reqNoyauCodesProduitsAutomatique()
+{
+    static const NoyauCodesProduits noyau =
+        noyauCodesProduitsDisponible(NoyauCodesProduits::AVX2) ? NoyauCodesProduits::AVX2 :
+        noyauCodesProduitsDisponible(NoyauCodesProduits::SSE42) ? NoyauCodesProduits::SSE42 :
+        NoyauCodesProduits::SCALAIRE;
+    return noyau;
+}
+
+/**
+ * \brief Génère les codes produits d’un lot de descriptions et de prix.
+ *
+ *        Chaque code est identique à celui que produirait ecrireCodeProduit() pour la même
+ *        description et le même prix.
+ *
+ * \param[in] p_noms descriptions des produits (p_nb éléments)
+ * \param[in] p_prix prix des produits (p_nb éléments)
+ * \param[in] p_nb nombre de produits du lot
+ * \param[out] p_codes codes générés (p_nb éléments)
+ * \param[out] p_tailles nombre de caractères de chaque code (11, ou moins si la description
+ *             compte moins de quatre lettres)
+ * \param[in] p_noyau noyau de calcul à utiliser
+ *
+ * \pre noyauCodesProduitsDisponible(p_noyau)
+ */
+void genererCodesProduits(const std::string_view* p_noms, const double* p_prix, std::size_t p_nb,
+                          TamponCodeProduit* p_codes, std::size_t* p_tailles, NoyauCodesProduits p_noyau)
+{
+    vector<LettresCode> lettres;
+    vector<int> cles;
+    preparerLot(p_noms, p_prix, p_nb, p_noyau, lettres, cles);
+
+    for (size_t i = 0; i < p_nb; ++i) {
+        int cle = cles[i];
+
+        TamponCodeProduit& code = p_codes[i];
+        memcpy(code.data(), "PRD-", 4);
+        memcpy(code.data() + 4, lettres[i].lettres, lettres[i].nbLettres);
+        size_t taille = 4 + lettres[i].nbLettres;
+        code[taille++] = '-';
+        code[taille++] = static_cast<char>('0' + cle / 10);
+        code[taille++] = static_cast<char>('0' + cle % 10);
+        p_tailles[i] = taille;
+    }
+}
+
+/**
+ * \brief Valide les codes produits d’un lot.
+ *
+ *        Chaque résultat est identique à celui de validerCodeProduit() pour le même code,
+ *        la même description et le même prix.
+ *
+ * \param[in] p_codes codes à valider (p_nb éléments)
+ * \param[in] p_noms descriptions des produits (p_nb éléments)
+ * \param[in] p_prix prix des produits (p_nb éléments)
+ * \param[in] p_nb nombre de produits du lot
+ * \param[out] p_valides résultat de la validation de chaque code (p_nb éléments)
+ * \param[in] p_noyau noyau de calcul à utiliser
+ * \return Le nombre de codes valides.
+ *
+ * \pre noyauCodesProduitsDisponible(p_noyau)
+ */
+std::size_t validerCodesProduits(const std::string_view* p_codes, const std::string_view* p_noms,
+                                 const double* p_prix, std::size_t p_nb, bool* p_valides, NoyauCodesProduits p_noyau)
+{
+    vector<LettresCode> lettres;
+    vector<int> cles;
+    preparerLot(p_noms, p_prix, p_nb, p_noyau, lettres, cles);
+
+    size_t nbValides = 0;
+    for (size_t i = 0; i < p_nb; ++i) {
+        string_view code = p_codes[i];
+        bool valide = code.size() == TAILLE_CODE_PRODUIT && memcmp(code.data(), "PRD-", 4) == 0 && code[8] == '-';
+        if (valide) {
+            valide = lettres[i].nbLettres == 4 && memcmp(code.data() + 4, lettres[i].lettres, 4) == 0;
+            if (valide) {
+                int cle = cles[i];
+                valide = code[9] == '0' + cle / 10 && code[10] == '0' + cle % 10;
+            }
+        }
+        p_valides[i] = valide;
+        nbValides += valide ? 1 : 0;
+    }
+    return nbValides;
+}
+
+} // namespace util